@@ -1,5 +1,7 @@
 #include "CommunicateMesh.hpp"
-#include <map>
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
 #include <vector>
 #include "Communication.hpp"
 #include "com/SharedPointer.hpp"
@@ -12,295 +14,212 @@ namespace precice
 {
 namespace com
 {
+namespace
+{
+/// Version of the packed mesh format, has to be incremented on every change of the layout
+const int MESH_FORMAT_VERSION = 1;
+
+/// Flag of the packed mesh format, set if the global indices are stored as their first value only
+const int CONSECUTIVE_GLOBAL_INDICES = 1;
+
+/// Number of ints in the header of a packed mesh
+const int HEADER_SIZE = 6;
+
+/// Number of ints used to store one double
+const int INTS_PER_DOUBLE = sizeof(double) / sizeof(int);
+static_assert(sizeof(double) == INTS_PER_DOUBLE * sizeof(int), "A double has to fit exactly into a number of ints.");
+} // namespace
+
 CommunicateMesh::CommunicateMesh(
     com::PtrCommunication communication)
     : _communication(communication)
 {
 }
 
-void CommunicateMesh::sendMesh(
-    const mesh::Mesh &mesh,
-    int               rankReceiver)
+void CommunicateMesh::packMesh(const mesh::Mesh &mesh, std::vector<int> &blob)
 {
-  TRACE(mesh.getName(), rankReceiver);
-  int dim = mesh.getDimensions();
-
-  int numberOfVertices = mesh.vertices().size();
-  _communication->send(numberOfVertices, rankReceiver);
-  if (not mesh.vertices().empty()) {
-    std::vector<double> coords(numberOfVertices * dim);
-    std::vector<int> globalIDs(numberOfVertices);
-    for (int i = 0; i < numberOfVertices; i++) {
-      for (int d = 0; d < dim; d++) {
-        coords[i * dim + d] = mesh.vertices()[i].getCoords()[d];
-      }
-      globalIDs[i] = mesh.vertices()[i].getGlobalIndex();
-    }
-    _communication->send(coords, rankReceiver);
-    _communication->send(globalIDs, rankReceiver);
+  int dim               = mesh.getDimensions();
+  int numberOfVertices  = mesh.vertices().size();
+  int numberOfEdges     = mesh.edges().size();
+  int numberOfTriangles = dim == 3 ? mesh.triangles().size() : 0;
+
+  bool consecutive = true;
+  for (int i = 1; i < numberOfVertices && consecutive; i++) {
+    consecutive = mesh.vertices()[i].getGlobalIndex() == mesh.vertices()[0].getGlobalIndex() + i;
+  }
+  int numberOfGlobalIndices = consecutive ? std::min(numberOfVertices, 1) : numberOfVertices;
+
+  size_t offset = blob.size();
+  blob.resize(offset + HEADER_SIZE + numberOfVertices * dim * INTS_PER_DOUBLE + numberOfGlobalIndices
+              + 2 * numberOfEdges + 3 * numberOfTriangles);
+  int *out = blob.data() + offset;
+  *out++   = MESH_FORMAT_VERSION;
+  *out++   = consecutive ? CONSECUTIVE_GLOBAL_INDICES : 0;
+  *out++   = dim;
+  *out++   = numberOfVertices;
+  *out++   = numberOfEdges;
+  *out++   = numberOfTriangles;
+
+  std::unordered_map<int, int> vertexPositions;
+  vertexPositions.reserve(numberOfVertices);
+  for (const mesh::Vertex &vertex : mesh.vertices()) {
+    vertexPositions.emplace(vertex.getID(), vertexPositions.size());
+    std::memcpy(out, vertex.getCoords().data(), dim * sizeof(double));
+    out += dim * INTS_PER_DOUBLE;
+  }
+  for (int i = 0; i < numberOfGlobalIndices; i++) {
+    *out++ = mesh.vertices()[i].getGlobalIndex();
   }
 
-  int numberOfEdges = mesh.edges().size();
-  _communication->send(numberOfEdges, rankReceiver);
-  if (not mesh.edges().empty()) {
-    //we need to send the vertexIDs first such that the right edges can be created later
-    //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-    std::vector<int> vertexIDs(numberOfVertices);
-    for (int i = 0; i < numberOfVertices; i++) {
-      vertexIDs[i] = mesh.vertices()[i].getID();
-    }
-    _communication->send(vertexIDs, rankReceiver);
-
-    std::vector<int> edgeIDs(numberOfEdges * 2);
-    for (int i = 0; i < numberOfEdges; i++) {
-      edgeIDs[i * 2]     = mesh.edges()[i].vertex(0).getID();
-      edgeIDs[i * 2 + 1] = mesh.edges()[i].vertex(1).getID();
-    }
-    _communication->send(edgeIDs, rankReceiver);
+  std::unordered_map<int, int> edgePositions;
+  edgePositions.reserve(numberOfEdges);
+  for (const mesh::Edge &edge : mesh.edges()) {
+    edgePositions.emplace(edge.getID(), edgePositions.size());
+    *out++ = vertexPositions.at(edge.vertex(0).getID());
+    *out++ = vertexPositions.at(edge.vertex(1).getID());
   }
 
   if (dim == 3) {
-    int numberOfTriangles = mesh.triangles().size();
-    _communication->send(numberOfTriangles, rankReceiver);
-    if (not mesh.triangles().empty()) {
-      //we need to send the edgeIDs first such that the right edges can be created later
-      //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-      std::vector<int> edgeIDs(numberOfEdges);
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeIDs[i] = mesh.edges()[i].getID();
-      }
-      _communication->send(edgeIDs, rankReceiver);
-
-      std::vector<int> triangleIDs(numberOfTriangles * 3);
-      for (int i = 0; i < numberOfTriangles; i++) {
-        triangleIDs[i * 3]     = mesh.triangles()[i].edge(0).getID();
-        triangleIDs[i * 3 + 1] = mesh.triangles()[i].edge(1).getID();
-        triangleIDs[i * 3 + 2] = mesh.triangles()[i].edge(2).getID();
+    for (const mesh::Triangle &triangle : mesh.triangles()) {
+      for (int i = 0; i < 3; i++) {
+        *out++ = edgePositions.at(triangle.edge(i).getID());
       }
-      _communication->send(triangleIDs, rankReceiver);
     }
   }
+  assertion(out == blob.data() + blob.size());
 }
 
-void CommunicateMesh::receiveMesh(
-    mesh::Mesh &mesh,
-    int         rankSender)
+bool CommunicateMesh::isSupportedFormatVersion(const int *blob)
 {
-  TRACE(mesh.getName(), rankSender);
-  int dim = mesh.getDimensions();
-
-  std::vector<mesh::Vertex *>   vertices;
-  std::map<int, mesh::Vertex *> vertexMap;
-  int                           numberOfVertices = 0;
-  _communication->receive(numberOfVertices, rankSender);
-  DEBUG("Number of vertices to receive: " << numberOfVertices);
+  return blob[0] == MESH_FORMAT_VERSION;
+}
 
-  if (numberOfVertices > 0) {
-    std::vector<double> vertexCoords;
-    std::vector<int> globalIDs;
-    _communication->receive(vertexCoords, rankSender);
-    _communication->receive(globalIDs, rankSender);
+int CommunicateMesh::unpackMesh(mesh::Mesh &mesh, const int *blob)
+{
+  const int *in = blob;
+  int version   = *in++;
+  CHECK(isSupportedFormatVersion(blob),
+        "Received mesh " << mesh.getName() << " in format version " << version << ", but expected version "
+                         << MESH_FORMAT_VERSION << ". Please use the same version of preCICE for all participants.");
+  int flags             = *in++;
+  int dim               = *in++;
+  int numberOfVertices  = *in++;
+  int numberOfEdges     = *in++;
+  int numberOfTriangles = *in++;
+  assertion(dim == mesh.getDimensions(), dim, mesh.getDimensions());
+  DEBUG("Number of vertices, edges, and triangles to receive: "
+        << numberOfVertices << ", " << numberOfEdges << ", " << numberOfTriangles);
+
+  mesh.reserve(numberOfVertices, numberOfEdges, numberOfTriangles);
+
+  std::vector<mesh::Vertex *> vertices(numberOfVertices);
+  Eigen::VectorXd             coords(dim);
+  for (int i = 0; i < numberOfVertices; i++) {
+    std::memcpy(coords.data(), in, dim * sizeof(double));
+    in += dim * INTS_PER_DOUBLE;
+    vertices[i] = &mesh.createVertex(coords);
+  }
+  if (flags & CONSECUTIVE_GLOBAL_INDICES) {
+    int first = numberOfVertices > 0 ? *in++ : 0;
     for (int i = 0; i < numberOfVertices; i++) {
-      Eigen::VectorXd coords(dim);
-      for (int d = 0; d < dim; d++) {
-        coords[d] = vertexCoords[i * dim + d];
-      }
-      mesh::Vertex &v = mesh.createVertex(coords);
-      assertion(v.getID() >= 0, v.getID());
-      v.setGlobalIndex(globalIDs[i]);
-      vertices.push_back(&v);
+      vertices[i]->setGlobalIndex(first + i);
     }
-  }
-
-  int                       numberOfEdges = 0;
-  std::vector<mesh::Edge *> edges;
-  _communication->receive(numberOfEdges, rankSender);
-  DEBUG("Number of edges to receive: " << numberOfEdges);
-  if (numberOfEdges > 0) {
-    std::vector<int> vertexIDs;
-    _communication->receive(vertexIDs, rankSender);
+  } else {
     for (int i = 0; i < numberOfVertices; i++) {
-      vertexMap[vertexIDs[i]] = vertices[i];
+      vertices[i]->setGlobalIndex(*in++);
     }
+  }
 
-    std::vector<int> edgeIDs;
-    _communication->receive(edgeIDs, rankSender);
-    for (int i = 0; i < numberOfEdges; i++) {
-      assertion(vertexMap.find(edgeIDs[i * 2]) != vertexMap.end());
-      assertion(vertexMap.find(edgeIDs[i * 2 + 1]) != vertexMap.end());
-      assertion(edgeIDs[i * 2] != edgeIDs[i * 2 + 1]);
-      mesh::Edge &e = mesh.createEdge(*vertexMap[edgeIDs[i * 2]], *vertexMap[edgeIDs[i * 2 + 1]]);
-      edges.push_back(&e);
-    }
+  std::vector<mesh::Edge *> edges(numberOfEdges);
+  for (int i = 0; i < numberOfEdges; i++, in += 2) {
+    assertion(in[0] < numberOfVertices && in[1] < numberOfVertices, in[0], in[1], numberOfVertices);
+    assertion(in[0] != in[1], in[0]);
+    edges[i] = &mesh.createEdge(*vertices[in[0]], *vertices[in[1]]);
   }
 
-  if (dim == 3) {
-    int numberOfTriangles = 0;
-    _communication->receive(numberOfTriangles, rankSender);
-    DEBUG("Number of Triangles to receive: " << numberOfTriangles);
-    DEBUG("Number of Edges: " << edges.size());
-    if (numberOfTriangles > 0) {
-      assertion((edges.size() > 0) || (numberOfTriangles == 0));
-      std::vector<int> edgeIDs;
-      _communication->receive(edgeIDs, rankSender);
-      std::map<int, mesh::Edge *> edgeMap;
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeMap[edgeIDs[i]] = edges[i];
-      }
+  for (int i = 0; i < numberOfTriangles; i++, in += 3) {
+    assertion(in[0] < numberOfEdges && in[1] < numberOfEdges && in[2] < numberOfEdges, in[0], in[1], in[2], numberOfEdges);
+    mesh.createTriangle(*edges[in[0]], *edges[in[1]], *edges[in[2]]);
+  }
+  return in - blob;
+}
 
-      std::vector<int> triangleIDs;
-      _communication->receive(triangleIDs, rankSender);
+void CommunicateMesh::sendMesh(
+    const mesh::Mesh &mesh,
+    int               rankReceiver)
+{
+  TRACE(mesh.getName(), rankReceiver);
+  std::vector<int> blob;
+  packMesh(mesh, blob);
+  _communication->send(blob, rankReceiver);
+}
 
-      for (int i = 0; i < numberOfTriangles; i++) {
-        assertion(edgeMap.find(triangleIDs[i * 3]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 1]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 2]) != edgeMap.end());
-        assertion(triangleIDs[i * 3] != triangleIDs[i * 3 + 1]);
-        assertion(triangleIDs[i * 3 + 1] != triangleIDs[i * 3 + 2]);
-        assertion(triangleIDs[i * 3 + 2] != triangleIDs[i * 3]);
-        mesh.createTriangle(*edgeMap[triangleIDs[i * 3]], *edgeMap[triangleIDs[i * 3 + 1]], *edgeMap[triangleIDs[i * 3 + 2]]);
-      }
-    }
-  }
+void CommunicateMesh::receiveMesh(
+    mesh::Mesh &mesh,
+    int         rankSender)
+{
+  TRACE(mesh.getName(), rankSender);
+  std::vector<int> blob;
+  _communication->receive(blob, rankSender);
+  int consumed = unpackMesh(mesh, blob.data());
+  assertion(consumed == static_cast<int>(blob.size()), consumed, blob.size());
 }
 
 void CommunicateMesh::broadcastSendMesh(const mesh::Mesh &mesh)
 {
   TRACE(mesh.getName());
-  int dim = mesh.getDimensions();
-
-  int numberOfVertices = mesh.vertices().size();
-  _communication->broadcast(numberOfVertices);
-  if (numberOfVertices > 0) {
-    std::vector<double> coords(numberOfVertices * dim);
-    std::vector<int> globalIDs(numberOfVertices);
-    for (int i = 0; i < numberOfVertices; i++) {
-      for (int d = 0; d < dim; d++) {
-        coords[i * dim + d] = mesh.vertices()[i].getCoords()[d];
-      }
-      globalIDs[i] = mesh.vertices()[i].getGlobalIndex();
-    }
-    _communication->broadcast(coords);
-    _communication->broadcast(globalIDs);
-  }
-
-  int numberOfEdges = mesh.edges().size();
-  _communication->broadcast(numberOfEdges);
-  if (numberOfEdges > 0) {
-    //we need to send the vertexIDs first such that the right edges can be created later
-    //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-    std::vector<int> vertexIDs(numberOfVertices);
-    for (int i = 0; i < numberOfVertices; i++) {
-      vertexIDs[i] = mesh.vertices()[i].getID();
-    }
-    _communication->broadcast(vertexIDs);
-
-    std::vector<int> edgeIDs(numberOfEdges * 2);
-    for (int i = 0; i < numberOfEdges; i++) {
-      edgeIDs[i * 2]     = mesh.edges()[i].vertex(0).getID();
-      edgeIDs[i * 2 + 1] = mesh.edges()[i].vertex(1).getID();
-    }
-    _communication->broadcast(edgeIDs);
-  }
-
-  if (dim == 3) {
-    int numberOfTriangles = mesh.triangles().size();
-    _communication->broadcast(numberOfTriangles);
-    if (numberOfTriangles > 0) {
-      //we need to send the edgeIDs first such that the right edges can be created later
-      //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-      std::vector<int> edgeIDs(numberOfEdges);
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeIDs[i] = mesh.edges()[i].getID();
-      }
-      _communication->broadcast(edgeIDs);
-
-      std::vector<int> triangleIDs(numberOfTriangles * 3);
-      for (int i = 0; i < numberOfTriangles; i++) {
-        triangleIDs[i * 3]     = mesh.triangles()[i].edge(0).getID();
-        triangleIDs[i * 3 + 1] = mesh.triangles()[i].edge(1).getID();
-        triangleIDs[i * 3 + 2] = mesh.triangles()[i].edge(2).getID();
-      }
-      _communication->broadcast(triangleIDs);
-    }
-  }
+  std::vector<int> blob;
+  packMesh(mesh, blob);
+  _communication->broadcast(blob);
 }
 
 void CommunicateMesh::broadcastReceiveMesh(
     mesh::Mesh &mesh)
 {
   TRACE(mesh.getName());
-  int dim             = mesh.getDimensions();
-  int rankBroadcaster = 0;
-
-  std::vector<mesh::Vertex *>   vertices;
-  std::map<int, mesh::Vertex *> vertexMap;
-  int                           numberOfVertices = 0;
-  _communication->broadcast(numberOfVertices, rankBroadcaster);
-
-  if (numberOfVertices > 0) {
-    std::vector<double> vertexCoords;
-    std::vector<int> globalIDs;
-    _communication->broadcast(vertexCoords, rankBroadcaster);
-    _communication->broadcast(globalIDs, rankBroadcaster);
-    for (int i = 0; i < numberOfVertices; i++) {
-      Eigen::VectorXd coords(dim);
-      for (int d = 0; d < dim; d++) {
-        coords[d] = vertexCoords[i * dim + d];
-      }
-      mesh::Vertex &v = mesh.createVertex(coords);
-      assertion(v.getID() >= 0, v.getID());
-      v.setGlobalIndex(globalIDs[i]);
-      vertices.push_back(&v);
-    }
-  }
+  int              rankBroadcaster = 0;
+  std::vector<int> blob;
+  _communication->broadcast(blob, rankBroadcaster);
+  int consumed = unpackMesh(mesh, blob.data());
+  assertion(consumed == static_cast<int>(blob.size()), consumed, blob.size());
+}
 
-  int                       numberOfEdges = 0;
-  std::vector<mesh::Edge *> edges;
-  _communication->broadcast(numberOfEdges, rankBroadcaster);
-  if (numberOfEdges > 0) {
-    std::vector<int> vertexIDs;
-    _communication->broadcast(vertexIDs, rankBroadcaster);
-    for (int i = 0; i < numberOfVertices; i++) {
-      vertexMap[vertexIDs[i]] = vertices[i];
-    }
+void CommunicateMesh::gatherSendMesh(
+    const mesh::Mesh &mesh,
+    int               rankMaster)
+{
+  TRACE(mesh.getName(), rankMaster);
+  std::vector<int> blob;
+  packMesh(mesh, blob);
+  _communication->gather(blob, rankMaster);
+}
 
-    std::vector<int> edgeIDs;
-    _communication->broadcast(edgeIDs, rankBroadcaster);
-    for (int i = 0; i < numberOfEdges; i++) {
-      assertion(vertexMap.find(edgeIDs[i * 2]) != vertexMap.end());
-      assertion(vertexMap.find(edgeIDs[i * 2 + 1]) != vertexMap.end());
-      assertion(edgeIDs[i * 2] != edgeIDs[i * 2 + 1]);
-      mesh::Edge &e = mesh.createEdge(*vertexMap[edgeIDs[i * 2]], *vertexMap[edgeIDs[i * 2 + 1]]);
-      edges.push_back(&e);
-    }
+void CommunicateMesh::gatherReceiveMesh(
+    mesh::Mesh &mesh)
+{
+  TRACE(mesh.getName());
+  std::vector<int> blobs, sizes;
+  _communication->gather(blobs, sizes);
+
+  // Reserve storage for all sub-meshes at once, unpackMesh() would otherwise grow it once per rank
+  int offset        = 0;
+  int vertexCount   = 0;
+  int edgeCount     = 0;
+  int triangleCount = 0;
+  for (int size : sizes) {
+    vertexCount += blobs[offset + 3];
+    edgeCount += blobs[offset + 4];
+    triangleCount += blobs[offset + 5];
+    offset += size;
   }
-
-  if (dim == 3) {
-    int numberOfTriangles = 0;
-    _communication->broadcast(numberOfTriangles, rankBroadcaster);
-    if (numberOfTriangles > 0) {
-      assertion((edges.size() > 0) || (numberOfTriangles == 0));
-      std::vector<int> edgeIDs;
-      _communication->broadcast(edgeIDs, rankBroadcaster);
-      std::map<int, mesh::Edge *> edgeMap;
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeMap[edgeIDs[i]] = edges[i];
-      }
-
-      std::vector<int> triangleIDs;
-      _communication->broadcast(triangleIDs, rankBroadcaster);
-
-      for (int i = 0; i < numberOfTriangles; i++) {
-        assertion(edgeMap.find(triangleIDs[i * 3]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 1]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 2]) != edgeMap.end());
-        assertion(triangleIDs[i * 3] != triangleIDs[i * 3 + 1]);
-        assertion(triangleIDs[i * 3 + 1] != triangleIDs[i * 3 + 2]);
-        assertion(triangleIDs[i * 3 + 2] != triangleIDs[i * 3]);
-        mesh.createTriangle(*edgeMap[triangleIDs[i * 3]], *edgeMap[triangleIDs[i * 3 + 1]], *edgeMap[triangleIDs[i * 3 + 2]]);
-      }
-    }
+  mesh.reserve(vertexCount, edgeCount, triangleCount);
+
+  offset = 0;
+  for (size_t rank = 0; rank < sizes.size(); rank++) {
+    int consumed = unpackMesh(mesh, blobs.data() + offset);
+    assertion(consumed == sizes[rank], consumed, sizes[rank]);
+    DEBUG("Received sub-mesh of rank " << rank + 1 << ", global vertexCount: " << mesh.vertices().size());
+    offset += sizes[rank];
   }
 }
 
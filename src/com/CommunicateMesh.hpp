@@ -2,8 +2,15 @@
 
 #include "com/SharedPointer.hpp"
 #include "logging/Logger.hpp"
+#include <vector>
 #include "mesh/Mesh.hpp"
 
+// Forward declaration to friend the boost test struct
+namespace CommunicationTests {
+namespace MeshTests {
+struct WrongFormatVersion;
+}}
+
 namespace precice
 {
 namespace com
@@ -33,6 +40,20 @@ public:
   void broadcastReceiveMesh(
       mesh::Mesh &mesh);
 
+  /**
+   * @brief Sends the mesh to the master, which has to call gatherReceiveMesh().
+   *
+   * All slaves need to call this function. The mesh is packed by packMesh(), the master
+   * receives the blobs of all slaves with a single gather.
+   */
+  void gatherSendMesh(
+      const mesh::Mesh &mesh,
+      int               rankMaster);
+
+  /// Receives the meshes of all slaves at once and adds them to mesh in rank order.
+  void gatherReceiveMesh(
+      mesh::Mesh &mesh);
+
   void sendBoundingBox(
       const mesh::Mesh::BoundingBox &bb,
       int                            rankReceiver);
@@ -41,8 +62,33 @@ public:
       mesh::Mesh::BoundingBox &bb,
       int                      rankSender);
 
+  friend struct CommunicationTests::MeshTests::WrongFormatVersion;
+
 private:
   logging::Logger _log{"com::CommunicateMesh"};
+
+  /**
+   * @brief Appends the mesh to blob, which is sent in one message.
+   *
+   * The blob starts with a header (format version, flags, dimensions, number of vertices,
+   * edges and triangles), followed by the coordinates as raw doubles, the global indices, the
+   * edges as pairs of vertex positions, and the triangles as triples of edge positions.
+   * Positions are local to the blob, such that they do not depend on the IDs of the sender and
+   * the receiver can add the mesh to a non-empty mesh. Global indices, which increase by one,
+   * are stored as their first value only.
+   */
+  void packMesh(
+      const mesh::Mesh &mesh,
+      std::vector<int> &blob);
+
+  /// Returns true, if the mesh packed in blob has the format version of this preCICE build.
+  static bool isSupportedFormatVersion(
+      const int *blob);
+
+  /// Adds a mesh packed by packMesh() to mesh, returns the number of consumed ints.
+  int unpackMesh(
+      mesh::Mesh &mesh,
+      const int * blob);
   
   /// Communication means used for the transfer of the geometry.
   com::PtrCommunication _communication;
@@ -286,5 +286,25 @@ void Communication::broadcast(std::vector<double> &v, int rankBroadcaster)
   broadcast(v.data(), size, rankBroadcaster);
 }
 
+void Communication::gather(std::vector<int> &itemsToReceive, std::vector<int> &sizes)
+{
+  TRACE();
+  itemsToReceive.clear();
+  sizes.resize(getRemoteCommunicatorSize());
+
+  std::vector<int> items;
+  for (size_t rank = 0; rank < getRemoteCommunicatorSize(); ++rank) {
+    receive(items, rank + _rankOffset);
+    sizes[rank] = items.size();
+    itemsToReceive.insert(itemsToReceive.end(), items.begin(), items.end());
+  }
+}
+
+void Communication::gather(std::vector<int> const &itemsToSend, int rankMaster)
+{
+  TRACE();
+  send(itemsToSend, rankMaster + _rankOffset);
+}
+
 } // namespace com
 } // namespace precice
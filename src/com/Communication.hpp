@@ -56,6 +56,17 @@ public:
     return _isConnected;
   }
 
+  /**
+   * @brief Returns true, if the connection can be set up in a separate thread.
+   *
+   * Connections of distinct communications may then be set up concurrently. MPI is not
+   * initialized with thread support, hence connections using MPI cannot.
+   */
+  virtual bool isConnectionThreadSafe() const
+  {
+    return false;
+  }
+
   /**
    * @brief Returns the number of processes in the remote communicator.
    *
@@ -191,6 +202,17 @@ public:
 
   virtual void broadcast(std::vector<double> const &v);
   virtual void broadcast(std::vector<double>& v, int rankBroadcaster);
+
+  /**
+   * @brief Gathers the vectors of all other ranks at the master, every other rank has to call gather.
+   *
+   * @param[out] itemsToReceive Concatenation of all received vectors in rank order
+   * @param[out] sizes Size of the vector received from each rank
+   */
+  virtual void gather(std::vector<int> &itemsToReceive, std::vector<int> &sizes);
+
+  /// Sends a vector of arbitrary size to the master, which has to call gather
+  virtual void gather(std::vector<int> const &itemsToSend, int rankMaster);
   
   /// Sends a std::string to process with given rank.
   virtual void send(std::string const &itemToSend, int rankReceiver) = 0;
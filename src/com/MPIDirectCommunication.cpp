@@ -1,6 +1,7 @@
 #ifndef PRECICE_NO_MPI
 
 #include "MPIDirectCommunication.hpp"
+#include <numeric>
 #include "utils/Parallel.hpp"
 #include "utils/assertion.hpp"
 
@@ -259,6 +260,34 @@ void MPIDirectCommunication::broadcast(bool &itemToReceive, int rankBroadcaster)
   itemToReceive = item;
 }
 
+void MPIDirectCommunication::gather(std::vector<int> &itemsToReceive, std::vector<int> &sizes)
+{
+  TRACE();
+  int remoteSize = 0;
+  MPI_Comm_remote_size(_communicator, &remoteSize);
+  sizes.resize(remoteSize);
+  itemsToReceive.clear();
+  if (remoteSize == 0)
+    return;
+  // gather the sizes first, such that the master can receive all vectors with one MPI_Gatherv
+  MPI_Gather(nullptr, 0, MPI_INT, sizes.data(), 1, MPI_INT, MPI_ROOT, _communicator);
+
+  std::vector<int> displacements(remoteSize, 0);
+  std::partial_sum(sizes.begin(), sizes.end() - 1, displacements.begin() + 1);
+  itemsToReceive.resize(displacements.back() + sizes.back());
+  MPI_Gatherv(nullptr, 0, MPI_INT, itemsToReceive.data(), sizes.data(), displacements.data(),
+              MPI_INT, MPI_ROOT, _communicator);
+}
+
+void MPIDirectCommunication::gather(std::vector<int> const &itemsToSend, int rankMaster)
+{
+  TRACE(itemsToSend.size());
+  int size = itemsToSend.size();
+  MPI_Gather(&size, 1, MPI_INT, nullptr, 0, MPI_INT, rankMaster, _communicator);
+  MPI_Gatherv(const_cast<int *>(itemsToSend.data()), size, MPI_INT, nullptr, nullptr, nullptr,
+              MPI_INT, rankMaster, _communicator);
+}
+
 MPI_Comm &MPIDirectCommunication::communicator(int rank)
 {
   return _communicator;
@@ -106,6 +106,11 @@ public:
 
   virtual void broadcast(bool &itemToReceive, int rankBroadcaster) override;
 
+  /// Gathers the sizes with MPI_Gather and the vectors with a single MPI_Gatherv
+  virtual void gather(std::vector<int> &itemsToReceive, std::vector<int> &sizes) override;
+
+  virtual void gather(std::vector<int> const &itemsToSend, int rankMaster) override;
+
 private:
   virtual MPI_Comm &communicator(int rank = 0) override;
 
@@ -1,6 +1,7 @@
 #ifndef PRECICE_NO_MPI
 
 #include "MPIRequest.hpp"
+#include "utils/assertion.hpp"
 
 namespace precice
 {
@@ -24,6 +25,27 @@ void MPIRequest::wait()
 {
   MPI_Wait(&_request, MPI_STATUS_IGNORE);
 }
+
+size_t MPIRequest::waitAnyOf(std::vector<PtrRequest> const &requests)
+{
+  std::vector<MPI_Request> handles;
+  std::vector<size_t>      positions;
+  for (size_t i = 0; i < requests.size(); i++) {
+    if (requests[i]) {
+      assertion(dynamic_cast<MPIRequest *>(requests[i].get()) != nullptr, i);
+      handles.push_back(static_cast<MPIRequest &>(*requests[i])._request);
+      positions.push_back(i);
+    }
+  }
+
+  int index = MPI_UNDEFINED;
+  MPI_Waitany(handles.size(), handles.data(), &index, MPI_STATUS_IGNORE);
+  assertion(index != MPI_UNDEFINED);
+
+  // MPI_Waitany has released the completed request and set its handle to MPI_REQUEST_NULL
+  static_cast<MPIRequest &>(*requests[positions[index]])._request = handles[index];
+  return positions[index];
+}
 } // namespace com
 } // namespace precice
 
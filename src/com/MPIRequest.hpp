@@ -17,6 +17,10 @@ public:
 
   void wait() override;
 
+protected:
+  /// Waits for all given requests at once using MPI_Waitany.
+  size_t waitAnyOf(std::vector<PtrRequest> const &requests) override;
+
 private:
   MPI_Request _request;
 };
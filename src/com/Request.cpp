@@ -1,10 +1,19 @@
 #include "Request.hpp"
+#include <condition_variable>
+#include <mutex>
+#include "utils/assertion.hpp"
 
 namespace precice
 {
 namespace com
 {
 
+namespace
+{
+std::mutex              completionMutex;
+std::condition_variable completionCondition;
+} // namespace
+
 void Request::wait(std::vector<PtrRequest> &requests)
 {
   for (auto request : requests) {
@@ -12,8 +21,43 @@ void Request::wait(std::vector<PtrRequest> &requests)
   }
 }
 
+size_t Request::waitAny(std::vector<PtrRequest> const &requests)
+{
+  for (auto const &request : requests) {
+    if (request) {
+      return request->waitAnyOf(requests);
+    }
+  }
+  assertion(false, "Waiting for any of zero requests would block forever.");
+  return requests.size();
+}
+
 Request::~Request()
 {
 }
+
+size_t Request::waitAnyOf(std::vector<PtrRequest> const &requests)
+{
+  size_t                       index = 0;
+  std::unique_lock<std::mutex> lock(completionMutex);
+
+  // notifyCompletion() takes completionMutex, hence no completion can slip in
+  // between testing the requests and going to sleep.
+  completionCondition.wait(lock, [&requests, &index] {
+    for (index = 0; index < requests.size(); index++) {
+      if (requests[index] && requests[index]->test()) {
+        return true;
+      }
+    }
+    return false;
+  });
+  return index;
+}
+
+void Request::notifyCompletion()
+{
+  std::lock_guard<std::mutex> lock(completionMutex);
+  completionCondition.notify_all();
+}
 } // namespace com
 } // namespace precice
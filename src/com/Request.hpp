@@ -13,11 +13,30 @@ class Request
 public:
   static void wait(std::vector<PtrRequest> &requests);
 
+  /**
+   * @brief Blocks until one of the given requests has completed and returns its position.
+   *
+   * Empty entries are ignored, but at least one entry has to be set. All requests have
+   * to stem from the same kind of communication.
+   */
+  static size_t waitAny(std::vector<PtrRequest> const &requests);
+
   virtual ~Request();
 
   virtual bool test() = 0;
 
   virtual void wait() = 0;
+
+protected:
+  /**
+   * @brief Implements waitAny() for the given requests, one of them is this request.
+   *
+   * The default implementation sleeps until a request calls notifyCompletion().
+   */
+  virtual size_t waitAnyOf(std::vector<PtrRequest> const &requests);
+
+  /// Wakes up all threads blocked in the default implementation of waitAnyOf().
+  static void notifyCompletion();
 };
 } // namespace com
 } // namespace precice
@@ -26,6 +26,12 @@ public:
 
   virtual size_t getRemoteCommunicatorSize() override;
 
+  /// Sockets and address files are private to the communication, hence the connection can be set up in any thread.
+  virtual bool isConnectionThreadSafe() const override
+  {
+    return true;
+  }
+
   virtual void acceptConnection(std::string const &acceptorName,
                                 std::string const &requesterName,
                                 int                acceptorRank) override;
@@ -18,6 +18,7 @@ void SocketRequest::complete()
   }
 
   _completeCondition.notify_one();
+  notifyCompletion();
 }
 
 bool SocketRequest::test()
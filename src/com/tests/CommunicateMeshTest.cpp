@@ -188,6 +188,208 @@ BOOST_AUTO_TEST_CASE(BroadcastVertexEdgeTriangleMesh,
   }
 }
 
+BOOST_AUTO_TEST_CASE(GatherVertexEdgeTriangleMesh,
+                     * testing::MinRanks(3))
+{
+  utils::Parallel::synchronizeProcesses();
+  assertion(utils::Parallel::getCommunicatorSize() > 2);
+  mesh::PropertyContainer::resetPropertyIDCounter();
+
+  std::string participant0("master");
+  std::string participant1("slaves");
+
+  int dim = 3;
+  int rank = utils::Parallel::getProcessRank();
+
+  // Every slave holds one triangle, shifted by its rank. The ID offset tests that the
+  // connectivity does not depend on the IDs of the sending mesh.
+  mesh::Mesh sendMesh("Sent Mesh", dim, false);
+  for (int i = 0; i < rank; i++) {
+    sendMesh.createVertex(Eigen::VectorXd::Constant(dim, -1));
+  }
+  mesh::Vertex &v0 = sendMesh.createVertex(Eigen::VectorXd::Constant(dim, rank));
+  mesh::Vertex &v1 = sendMesh.createVertex(Eigen::VectorXd::Constant(dim, rank + 0.5));
+  mesh::Vertex &v2 = sendMesh.createVertex(Eigen::Vector3d(rank, rank, 0));
+  mesh::Edge &e0 = sendMesh.createEdge(v0, v1);
+  mesh::Edge &e1 = sendMesh.createEdge(v1, v2);
+  mesh::Edge &e2 = sendMesh.createEdge(v2, v0);
+  sendMesh.createTriangle(e0, e1, e2);
+
+  std::vector<int> involvedRanks = {0, 1, 2};
+  MPI_Comm         comm          = utils::Parallel::getRestrictedCommunicator(involvedRanks);
+
+  if (rank < 3) {
+    utils::Parallel::setGlobalCommunicator(comm);
+    com::PtrCommunication com(new com::MPIDirectCommunication());
+    CommunicateMesh       comMesh(com);
+
+    if (rank == 0) {
+      mesh::Mesh recvMesh("Received Mesh", dim, false);
+      recvMesh.createVertex(Eigen::VectorXd::Constant(dim, 9));
+      utils::Parallel::splitCommunicator(participant0);
+      com->acceptConnection(participant0, participant1, rank);
+      comMesh.gatherReceiveMesh(recvMesh);
+      BOOST_TEST(recvMesh.vertices().size() == 1 + (1 + 3) + (2 + 3));
+      BOOST_TEST(recvMesh.edges().size() == 2 * 3);
+      BOOST_TEST(recvMesh.triangles().size() == 2);
+      std::vector<int> firstVertex = {-1, 2, 7};
+      for (int slave = 1; slave < 3; slave++) {
+        int first = firstVertex[slave];
+        BOOST_TEST(testing::equals(recvMesh.vertices()[first].getCoords(), Eigen::VectorXd::Constant(dim, slave)));
+        BOOST_TEST(testing::equals(recvMesh.edges()[(slave - 1) * 3].vertex(0).getCoords(), Eigen::VectorXd::Constant(dim, slave)));
+        BOOST_TEST(testing::equals(recvMesh.edges()[(slave - 1) * 3].vertex(1).getCoords(), Eigen::VectorXd::Constant(dim, slave + 0.5)));
+        BOOST_TEST(recvMesh.triangles()[slave - 1].edge(0).getID() == recvMesh.edges()[(slave - 1) * 3].getID());
+        BOOST_TEST(recvMesh.triangles()[slave - 1].edge(2).getID() == recvMesh.edges()[(slave - 1) * 3 + 2].getID());
+      }
+    } else {
+      utils::Parallel::splitCommunicator(participant1);
+      com->requestConnection(participant0, participant1, rank - 1, 2);
+      comMesh.gatherSendMesh(sendMesh, 0);
+    }
+    com->closeConnection();
+
+    utils::Parallel::clearGroups();
+    utils::Parallel::setGlobalCommunicator(utils::Parallel::getCommunicatorWorld());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(NonConsecutiveGlobalIndices,
+                     * testing::MinRanks(2))
+{
+  utils::Parallel::synchronizeProcesses();
+  assertion(utils::Parallel::getCommunicatorSize() > 1);
+  mesh::PropertyContainer::resetPropertyIDCounter();
+
+  std::string participant0("rank0");
+  std::string participant1("rank1");
+
+  int dim = 3;
+  mesh::Mesh sendMesh("Sent Mesh", dim, false);
+  mesh::Vertex &v0 = sendMesh.createVertex(Eigen::Vector3d(0.5, 0, 0));
+  mesh::Vertex &v1 = sendMesh.createVertex(Eigen::Vector3d(0, 1.5, 0));
+  mesh::Vertex &v2 = sendMesh.createVertex(Eigen::Vector3d(0, 0, 2.5));
+  mesh::Vertex &v3 = sendMesh.createVertex(Eigen::Vector3d(1, 1, 1));
+  std::vector<int> globalIndices = {7, 3, 8, 20};
+  for (size_t i = 0; i < globalIndices.size(); i++) {
+    sendMesh.vertices()[i].setGlobalIndex(globalIndices[i]);
+  }
+  mesh::Edge &e0 = sendMesh.createEdge(v0, v1);
+  mesh::Edge &e1 = sendMesh.createEdge(v1, v2);
+  mesh::Edge &e2 = sendMesh.createEdge(v2, v0);
+  mesh::Edge &e3 = sendMesh.createEdge(v3, v0);
+  mesh::Triangle &t0 = sendMesh.createTriangle(e0, e1, e2);
+
+  std::vector<int> involvedRanks = {0, 1};
+  MPI_Comm         comm          = utils::Parallel::getRestrictedCommunicator(involvedRanks);
+
+  if (utils::Parallel::getProcessRank() < 2) {
+    utils::Parallel::setGlobalCommunicator(comm);
+    com::PtrCommunication com(new com::MPIDirectCommunication());
+    CommunicateMesh       comMesh(com);
+
+    if (utils::Parallel::getProcessRank() == 0) {
+      utils::Parallel::splitCommunicator(participant0);
+      com->acceptConnection(participant0, participant1, utils::Parallel::getProcessRank());
+      comMesh.sendMesh(sendMesh, 0);
+    } else if (utils::Parallel::getProcessRank() == 1) {
+      mesh::Mesh recvMesh("Received Mesh", dim, false);
+      utils::Parallel::splitCommunicator(participant1);
+      com->requestConnection(participant0, participant1, 0, 1);
+      comMesh.receiveMesh(recvMesh, 0);
+      BOOST_TEST(recvMesh.vertices().size() == 4);
+      for (size_t i = 0; i < globalIndices.size(); i++) {
+        BOOST_TEST(recvMesh.vertices()[i] == sendMesh.vertices()[i]);
+        BOOST_TEST(recvMesh.vertices()[i].getGlobalIndex() == globalIndices[i]);
+      }
+      BOOST_TEST(recvMesh.edges().size() == 4);
+      BOOST_TEST(recvMesh.edges()[0] == e0);
+      BOOST_TEST(recvMesh.edges()[1] == e1);
+      BOOST_TEST(recvMesh.edges()[2] == e2);
+      BOOST_TEST(recvMesh.edges()[3] == e3);
+      BOOST_TEST(recvMesh.triangles().size() == 1);
+      BOOST_TEST(recvMesh.triangles()[0] == t0);
+    }
+    com->closeConnection();
+
+    utils::Parallel::clearGroups();
+    utils::Parallel::setGlobalCommunicator(utils::Parallel::getCommunicatorWorld());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ConsecutiveGlobalIndices,
+                     * testing::MinRanks(2))
+{
+  utils::Parallel::synchronizeProcesses();
+  assertion(utils::Parallel::getCommunicatorSize() > 1);
+  mesh::PropertyContainer::resetPropertyIDCounter();
+
+  std::string participant0("rank0");
+  std::string participant1("rank1");
+
+  int dim = 2;
+  mesh::Mesh sendMesh("Sent Mesh", dim, false);
+  for (int i = 0; i < 5; i++) {
+    mesh::Vertex &v = sendMesh.createVertex(Eigen::VectorXd::Constant(dim, i));
+    v.setGlobalIndex(11 + i);
+  }
+
+  std::vector<int> involvedRanks = {0, 1};
+  MPI_Comm         comm          = utils::Parallel::getRestrictedCommunicator(involvedRanks);
+
+  if (utils::Parallel::getProcessRank() < 2) {
+    utils::Parallel::setGlobalCommunicator(comm);
+    com::PtrCommunication com(new com::MPIDirectCommunication());
+    CommunicateMesh       comMesh(com);
+
+    if (utils::Parallel::getProcessRank() == 0) {
+      utils::Parallel::splitCommunicator(participant0);
+      com->acceptConnection(participant0, participant1, utils::Parallel::getProcessRank());
+      comMesh.sendMesh(sendMesh, 0);
+      comMesh.sendMesh(sendMesh, 0);
+    } else if (utils::Parallel::getProcessRank() == 1) {
+      utils::Parallel::splitCommunicator(participant1);
+      com->requestConnection(participant0, participant1, 0, 1);
+
+      // Header, coordinates, and the first global index only
+      std::vector<int> blob;
+      com->receive(blob, 0);
+      int intsPerDouble = sizeof(double) / sizeof(int);
+      BOOST_TEST(blob.size() == 6 + 5 * dim * intsPerDouble + 1);
+      BOOST_TEST(blob.back() == 11);
+
+      mesh::Mesh recvMesh("Received Mesh", dim, false);
+      comMesh.receiveMesh(recvMesh, 0);
+      BOOST_TEST(recvMesh.vertices().size() == 5);
+      for (int i = 0; i < 5; i++) {
+        BOOST_TEST(recvMesh.vertices()[i] == sendMesh.vertices()[i]);
+        BOOST_TEST(recvMesh.vertices()[i].getGlobalIndex() == 11 + i);
+      }
+    }
+    com->closeConnection();
+
+    utils::Parallel::clearGroups();
+    utils::Parallel::setGlobalCommunicator(utils::Parallel::getCommunicatorWorld());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(WrongFormatVersion,
+                     * testing::OnMaster())
+{
+  mesh::PropertyContainer::resetPropertyIDCounter();
+
+  int dim = 2;
+  mesh::Mesh sendMesh("Sent Mesh", dim, false);
+  sendMesh.createVertex(Eigen::VectorXd::Constant(dim, 1));
+
+  // packing and unpacking is local, no communication is needed
+  CommunicateMesh  comMesh(nullptr);
+  std::vector<int> blob;
+  comMesh.packMesh(sendMesh, blob);
+  BOOST_TEST(CommunicateMesh::isSupportedFormatVersion(blob.data()));
+
+  blob[0]++;
+  BOOST_TEST(not CommunicateMesh::isSupportedFormatVersion(blob.data()));
+}
 
 BOOST_AUTO_TEST_SUITE_END() // Mesh
 BOOST_AUTO_TEST_SUITE_END() // Communication
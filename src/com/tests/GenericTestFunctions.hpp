@@ -1,5 +1,7 @@
 #pragma once
 
+#include "com/Request.hpp"
+
 using namespace precice;
 
 /// Generic test function that is called from the tests for MPIPortsCommunication,
@@ -415,3 +417,47 @@ void TestSendReceiveFourProcessesServerClientV2()
   }
   }
 }
+
+/// Tests waiting for the first of several asynchronous receives from clients
+template<typename T>
+void TestWaitAny()
+{
+  T communication;
+  const int rank = utils::Parallel::getProcessRank();
+
+  switch (rank) {
+  case 0: {
+    communication.acceptConnectionAsServer("A", "B", rank, 2);
+    std::vector<int> messages(2, -1);
+    std::vector<com::PtrRequest> requests(2);
+    // Clients are addressed by the ranks they passed to requestConnectionAsClient
+    for (int client = 0; client < 2; client++) {
+      requests[client] = communication.aReceive(messages[client], client);
+    }
+
+    // The first client only sends after it has been told to
+    BOOST_TEST(com::Request::waitAny(requests) == 1);
+    BOOST_TEST(messages[1] == 20);
+    requests[1].reset();
+    communication.send(1, 0);
+    BOOST_TEST(com::Request::waitAny(requests) == 0);
+    BOOST_TEST(messages[0] == 10);
+    communication.closeConnection();
+    break;
+  }
+  case 1: {
+    communication.requestConnectionAsClient("A", "B", {0}, rank - 1);
+    int go = 0;
+    communication.receive(go, 0);
+    communication.send(10, 0);
+    communication.closeConnection();
+    break;
+  }
+  case 2: {
+    communication.requestConnectionAsClient("A", "B", {0}, rank - 1);
+    communication.send(20, 0);
+    communication.closeConnection();
+    break;
+  }
+  }
+}
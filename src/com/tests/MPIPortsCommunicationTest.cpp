@@ -62,6 +62,13 @@ BOOST_AUTO_TEST_CASE(SendReceiveFourProcessesServerClientV2,
   TestSendReceiveFourProcessesServerClientV2<MPIPortsCommunication>();
 }
 
+BOOST_AUTO_TEST_CASE(WaitAny,
+                     * testing::MinRanks(3)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  TestWaitAny<MPIPortsCommunication>();
+}
+
 BOOST_AUTO_TEST_SUITE_END() // MPIPortsCommunication
 
 BOOST_AUTO_TEST_SUITE_END() // Communication
@@ -56,6 +56,13 @@ BOOST_AUTO_TEST_CASE(SendReceiveFourProcessesServerClientV2,
   TestSendReceiveFourProcessesServerClientV2<SocketCommunication>();
 }
 
+BOOST_AUTO_TEST_CASE(WaitAny,
+                     * testing::MinRanks(3)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  TestWaitAny<SocketCommunication>();
+}
+
 
 BOOST_AUTO_TEST_SUITE_END() // Socket
 BOOST_AUTO_TEST_SUITE_END() // Communication
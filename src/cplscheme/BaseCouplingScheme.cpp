@@ -1,5 +1,6 @@
 #include "BaseCouplingScheme.hpp"
 #include <Eigen/Core>
+#include <algorithm>
 #include <limits>
 #include <sstream>
 #include "com/Communication.hpp"
@@ -305,45 +306,70 @@ void BaseCouplingScheme::finalize()
 }
 
 void BaseCouplingScheme::setExtrapolationOrder(
-    int order)
+    int               order,
+    ExtrapolationType type)
 {
-  CHECK((order == 0) || (order == 1) || (order == 2),
-        "Extrapolation order has to be  0, 1, or 2!");
+  if (type == PolynomialExtrapolation) {
+    CHECK((order >= 0) && (order <= MAX_POLYNOMIAL_EXTRAPOLATION_ORDER),
+          "Order of polynomial extrapolation has to be between 0 and " << MAX_POLYNOMIAL_EXTRAPOLATION_ORDER << "!");
+  } else {
+    CHECK((order == 0) || (order == 1) || (order == 2),
+          "Extrapolation order has to be  0, 1, or 2!");
+  }
   _extrapolationOrder = order;
+  _extrapolationType  = type;
 }
 
 // @todo extrapolation of data should only be done for the fine cplData -> then copied to the coarse cplData
 void BaseCouplingScheme::extrapolateData(DataMap &data)
 {
   TRACE(_timesteps);
-  if ((_extrapolationOrder == 1) || getTimesteps() == 2) { //timesteps is increased before extrapolate is called
-    INFO("Performing first order extrapolation");
-    for (DataMap::value_type &pair : data) {
-      DEBUG("Extrapolate data: " << pair.first);
-      assertion(pair.second->oldValues.cols() > 1);
-      Eigen::VectorXd &values       = *pair.second->values;
-      pair.second->oldValues.col(0) = values;  // = x^t
-      values *= 2.0;                           // = 2*x^t
-      values -= pair.second->oldValues.col(1); // = 2*x^t - x^(t-1)
-      utils::shiftSetFirst(pair.second->oldValues, values);
+  assertion(_extrapolationOrder > 0, _extrapolationOrder);
+
+  // At the begin of the simulation, less timesteps than needed are available and the order is reduced.
+  // timesteps is increased before extrapolate is called.
+  int order = _extrapolationOrder;
+  if (_extrapolationType == PolynomialExtrapolation) {
+    order = std::min(order, std::max(getTimesteps() - 1, 1));
+  } else if (getTimesteps() == 2) {
+    order = 1;
+  }
+
+  // weights of x^t, x^(t-1), ..., x^(t-order)
+  std::vector<double> weights;
+  if (_extrapolationType == PolynomialExtrapolation) {
+    INFO("Performing polynomial extrapolation of order " << order);
+    // Lagrange extrapolation for equidistant timesteps: x^(t+1) = sum_k (-1)^k binom(order+1, k+1) x^(t-k)
+    double binomial = order + 1;
+    for (int k = 0; k <= order; k++) {
+      weights.push_back((k % 2 == 0) ? binomial : -binomial);
+      binomial *= static_cast<double>(order - k) / static_cast<double>(k + 2);
     }
-  } else if (_extrapolationOrder == 2) {
+  } else if (order == 1) {
+    INFO("Performing first order extrapolation");
+    weights = {2.0, -1.0}; // = 2*x^t - x^(t-1)
+  } else if (order == 2) {
     INFO("Performing second order extrapolation");
-    for (DataMap::value_type &pair : data) {
-      assertion(pair.second->oldValues.cols() > 2);
-      Eigen::VectorXd &values     = *pair.second->values;
-      auto             valuesOld1 = pair.second->oldValues.col(1);
-      auto             valuesOld2 = pair.second->oldValues.col(2);
-
-      pair.second->oldValues.col(0) = values; // = x^t
-      values *= 2.5;                          // = 2.5 x^t
-      values -= valuesOld1 * 2.0;             // = 2.5x^t - 2x^(t-1)
-      values += valuesOld2 * 0.5;             // = 2.5x^t - 2x^(t-1) + 0.5x^(t-2)
-      utils::shiftSetFirst(pair.second->oldValues, values);
-    }
+    weights = {2.5, -2.0, 0.5}; // = 2.5x^t - 2x^(t-1) + 0.5x^(t-2)
   } else {
     ERROR("Called extrapolation with order != 1,2!");
   }
+
+  for (DataMap::value_type &pair : data) {
+    DEBUG("Extrapolate data: " << pair.first);
+    CouplingData &cplData = *pair.second;
+    assertion(cplData.timestepValues.cols() > order, cplData.timestepValues.cols(), order);
+    Eigen::VectorXd &values = *cplData.values;
+    cplData.storeTimestep(values); // = x^t
+    values *= weights[0];
+    for (int k = 1; k <= order; k++) {
+      values += weights[k] * cplData.pastTimestep(k);
+    }
+    // the extrapolated values are the old values of the first iteration
+    if (cplData.oldValues.cols() > 0) {
+      cplData.oldValues.col(0) = values;
+    }
+  }
 }
 
 bool BaseCouplingScheme::hasTimestepLength() const
@@ -559,10 +585,14 @@ void BaseCouplingScheme::setupDataMatrices(DataMap &data)
   if (_extrapolationOrder > 0) {
     for (DataMap::value_type &pair : data) {
       int cols = pair.second->oldValues.cols();
-      DEBUG("Add cols: " << pair.first << ", cols: " << cols);
+      DEBUG("Add history: " << pair.first << ", cols: " << cols);
       assertion(cols <= 1, cols);
-      utils::append(pair.second->oldValues,
-                    (Eigen::MatrixXd) Eigen::MatrixXd::Zero(pair.second->values->size(), _extrapolationOrder + 1 - cols));
+      if (cols < 1) {
+        utils::append(pair.second->oldValues,
+                      (Eigen::MatrixXd) Eigen::MatrixXd::Zero(pair.second->values->size(), 1));
+      }
+      // x^t and the order previous timesteps
+      pair.second->setupTimestepHistory(_extrapolationOrder + 1);
     }
   }
 }
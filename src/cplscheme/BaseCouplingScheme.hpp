@@ -69,6 +69,13 @@ public:
                       Implicit,
                       Undefined };
 
+  /// Predictors for the extrapolation of coupling data, see setExtrapolationOrder().
+  enum ExtrapolationType { DefaultExtrapolation,
+                           PolynomialExtrapolation };
+
+  /// Maximal order of the polynomial extrapolation, higher orders amplify noise in the data too much.
+  static const int MAX_POLYNOMIAL_EXTRAPOLATION_ORDER = 5;
+
   /**
    * @brief Adds another coupling scheme in parallel to this scheme.
    *
@@ -242,9 +249,11 @@ public:
    *
    * The standard predictor is of order zero, i.e., simply the converged values
    * of the last timestep are taken as initial guess for the coupling iterations.
-   * Currently, an order 1 predictor is implement besides that.
+   * The default extrapolation supports order 1 (linear) and 2. The polynomial
+   * extrapolation fits a polynomial of the given order through the last order+1
+   * timesteps and supports orders up to MAX_POLYNOMIAL_EXTRAPOLATION_ORDER.
    */
-  void setExtrapolationOrder(int order);
+  void setExtrapolationOrder(int order, ExtrapolationType type = DefaultExtrapolation);
 
   typedef std::map<int, PtrCouplingData> DataMap; // move that back to protected
 
@@ -542,6 +551,9 @@ private:
   /// Extrapolation order of coupling data for first iteration of every dt.
   int _extrapolationOrder = 0;
 
+  /// Predictor used for the extrapolation of coupling data.
+  ExtrapolationType _extrapolationType = DefaultExtrapolation;
+
   int _validDigits;
 
   /// True, if local participant is the one starting the explicit scheme.
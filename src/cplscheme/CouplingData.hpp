@@ -15,9 +15,21 @@ struct CouplingData
   /// Data values of current iteration.
   Eigen::VectorXd* values;
 
-  /// Data values of previous iteration (1st col) and previous timesteps.
+  /// Data values of previous iteration (1st col).
   DataMatrix oldValues;
 
+  /**
+   * @brief Converged data values of previous timesteps, used for extrapolation.
+   *
+   * The columns are used as ring buffer of fixed capacity, i.e., storing the values of a new
+   * timestep overwrites the oldest column instead of shifting all columns.
+   * Use storeTimestep() and pastTimestep() to access it.
+   */
+  DataMatrix timestepValues;
+
+  /// Column of timestepValues holding the most recent timestep.
+  int latestTimestep = 0;
+
   mesh::PtrMesh mesh;
 
   ///  True, if the data values are initialized by a participant.
@@ -50,6 +62,32 @@ struct CouplingData
       assertion ( values != NULL );
       assertion ( mesh.use_count()>0);
     }
+
+  /// Allocates the storage for depth previous timesteps, initialized with zero.
+  void setupTimestepHistory(int depth)
+  {
+    assertion(depth > 0, depth);
+    timestepValues = DataMatrix::Zero(values->size(), depth);
+    latestTimestep = 0;
+  }
+
+  /// Stores the values of a converged timestep and drops the oldest one. Does nothing if no history is allocated.
+  void storeTimestep(const Eigen::VectorXd& timestep)
+  {
+    if (timestepValues.cols() == 0)
+      return;
+    assertion(timestep.size() == timestepValues.rows(), timestep.size(), timestepValues.rows());
+    latestTimestep = (latestTimestep + 1) % timestepValues.cols();
+    timestepValues.col(latestTimestep) = timestep;
+  }
+
+  /// Returns the values of the k-th last stored timestep, k = 0 is the most recent one.
+  DataMatrix::ColXpr pastTimestep(int k)
+  {
+    const int depth = timestepValues.cols();
+    assertion(k >= 0 && k < depth, k, depth);
+    return timestepValues.col((latestTimestep - k + depth) % depth);
+  }
 };
 
 }} // namespace precice, cplscheme
@@ -112,7 +112,7 @@ void MultiCouplingScheme::initializeData()
         for (DataMap::value_type & pair : dataMap){
           pair.second->oldValues.col(0) = *pair.second->values;
           // For extrapolation, treat the initial value as old timestep value
-          utils::shiftSetFirst(pair.second->oldValues, *pair.second->values);
+          pair.second->storeTimestep(*pair.second->values);
         }
       }
     }
@@ -123,7 +123,7 @@ void MultiCouplingScheme::initializeData()
         for (DataMap::value_type & pair : dataMap) {
           pair.second->oldValues.col(0) = *pair.second->values;
           // For extrapolation, treat the initial value as old timestep value
-          utils::shiftSetFirst(pair.second->oldValues, *pair.second->values);
+          pair.second->storeTimestep(*pair.second->values);
         }
       }
     }
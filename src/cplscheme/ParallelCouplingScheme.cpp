@@ -119,7 +119,7 @@ void ParallelCouplingScheme::initializeData()
                     break;
           pair.second->oldValues.col(0) = *pair.second->values;
           // For extrapolation, treat the initial value as old timestep value
-          utils::shiftSetFirst(pair.second->oldValues, *pair.second->values);
+          pair.second->storeTimestep(*pair.second->values);
         }
       }
     }
@@ -130,7 +130,7 @@ void ParallelCouplingScheme::initializeData()
                     break;
           pair.second->oldValues.col(0) = *pair.second->values;
           // For extrapolation, treat the initial value as old timestep value
-          utils::shiftSetFirst(pair.second->oldValues, *pair.second->values);
+          pair.second->storeTimestep(*pair.second->values);
         }
       }
       sendData(getM2N());
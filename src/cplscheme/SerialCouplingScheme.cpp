@@ -131,7 +131,7 @@ void SerialCouplingScheme::initializeData()
         break;
       pair.second->oldValues.col(0) = *pair.second->values;
       // For extrapolation, treat the initial value as old timestep value
-      utils::shiftSetFirst(pair.second->oldValues, *pair.second->values);
+      pair.second->storeTimestep(*pair.second->values);
     }
 
     // The second participant sends the initialized data to the first particpant
@@ -7,6 +7,7 @@
 namespace CplSchemeTests {
 namespace SerialImplicitCouplingSchemeTests{
 struct testExtrapolateData;
+struct testPolynomialExtrapolation;
 }}
 
 
@@ -58,6 +59,7 @@ public:
   logging::Logger _log{"cplschemes::SerialCouplingSchemes"};
 
   friend struct CplSchemeTests::SerialImplicitCouplingSchemeTests::testExtrapolateData;  // For whitebox tests
+  friend struct CplSchemeTests::SerialImplicitCouplingSchemeTests::testPolynomialExtrapolation;  // For whitebox tests
 
 };
 
@@ -73,6 +73,8 @@ CouplingSchemeConfiguration::CouplingSchemeConfiguration(
       VALUE_MULTI("multi"),
       VALUE_FIXED("fixed"),
       VALUE_FIRST_PARTICIPANT("first-participant"),
+      VALUE_DEFAULT("default"),
+      VALUE_POLYNOMIAL("polynomial"),
       _config(),
       _meshConfig(meshConfig),
       _m2nConfig(m2nConfig),
@@ -247,6 +249,11 @@ void CouplingSchemeConfiguration::xmlTagCallback(
   } else if (tag.getName() == TAG_EXTRAPOLATION) {
     assertion(_config.type == VALUE_SERIAL_IMPLICIT || _config.type == VALUE_PARALLEL_IMPLICIT || _config.type == VALUE_MULTI);
     _config.extrapolationOrder = tag.getIntAttributeValue(ATTR_VALUE);
+    if (tag.getStringAttributeValue(ATTR_TYPE) == VALUE_POLYNOMIAL) {
+      _config.extrapolationType = BaseCouplingScheme::PolynomialExtrapolation;
+    } else {
+      _config.extrapolationType = BaseCouplingScheme::DefaultExtrapolation;
+    }
   }
 }
 
@@ -545,6 +552,15 @@ void CouplingSchemeConfiguration::addTagExtrapolation(
   XMLTag            tagExtrapolation(*this, TAG_EXTRAPOLATION, XMLTag::OCCUR_NOT_OR_ONCE);
   XMLAttribute<int> attrValue(ATTR_VALUE);
   tagExtrapolation.addAttribute(attrValue);
+  XMLAttribute<std::string> attrType(ATTR_TYPE);
+  attrType.setDefaultValue(VALUE_DEFAULT);
+  ValidatorEquals<std::string> validDefault(VALUE_DEFAULT);
+  ValidatorEquals<std::string> validPolynomial(VALUE_POLYNOMIAL);
+  attrType.setValidator(validDefault || validPolynomial);
+  attrType.setDocumentation("Type of the predictor. \"" + VALUE_DEFAULT + "\" supports orders 1 and 2, \""
+                            + VALUE_POLYNOMIAL + "\" extrapolates a polynomial through the last order+1 timesteps "
+                            "and supports orders up to " + std::to_string(BaseCouplingScheme::MAX_POLYNOMIAL_EXTRAPOLATION_ORDER) + ".");
+  tagExtrapolation.addAttribute(attrType);
   tagExtrapolation.setDocumentation("Sets order of predictor of interface values for first participant.");
   tag.addSubtag(tagExtrapolation);
 }
@@ -676,7 +692,7 @@ PtrCouplingScheme CouplingSchemeConfiguration::createSerialImplicitCouplingSchem
       _config.maxTime, _config.maxTimesteps, _config.timestepLength,
       _config.validDigits, _config.participants[0], _config.participants[1],
       accessor, m2n, _config.dtMethod, BaseCouplingScheme::Implicit, _config.maxIterations);
-  scheme->setExtrapolationOrder(_config.extrapolationOrder);
+  scheme->setExtrapolationOrder(_config.extrapolationOrder, _config.extrapolationType);
 
   addDataToBeExchanged(*scheme, accessor);
 
@@ -717,7 +733,7 @@ PtrCouplingScheme CouplingSchemeConfiguration::createParallelImplicitCouplingSch
       _config.maxTime, _config.maxTimesteps, _config.timestepLength,
       _config.validDigits, _config.participants[0], _config.participants[1],
       accessor, m2n, _config.dtMethod, BaseCouplingScheme::Implicit, _config.maxIterations);
-  scheme->setExtrapolationOrder(_config.extrapolationOrder);
+  scheme->setExtrapolationOrder(_config.extrapolationOrder, _config.extrapolationType);
 
   addDataToBeExchanged(*scheme, accessor);
 
@@ -766,7 +782,7 @@ PtrCouplingScheme CouplingSchemeConfiguration::createMultiCouplingScheme(
         _config.maxTime, _config.maxTimesteps, _config.timestepLength,
         _config.validDigits, accessor, m2ns, _config.dtMethod,
         _config.maxIterations);
-    scheme->setExtrapolationOrder(_config.extrapolationOrder);
+    scheme->setExtrapolationOrder(_config.extrapolationOrder, _config.extrapolationType);
 
     MultiCouplingScheme *castedScheme = dynamic_cast<MultiCouplingScheme *>(scheme);
     addMultiDataToBeExchanged(*castedScheme, accessor);
@@ -777,7 +793,7 @@ PtrCouplingScheme CouplingSchemeConfiguration::createMultiCouplingScheme(
         _config.maxTime, _config.maxTimesteps, _config.timestepLength,
         _config.validDigits, accessor, _config.controller,
         accessor, m2n, _config.dtMethod, BaseCouplingScheme::Implicit, _config.maxIterations);
-    scheme->setExtrapolationOrder(_config.extrapolationOrder);
+    scheme->setExtrapolationOrder(_config.extrapolationOrder, _config.extrapolationType);
 
     addDataToBeExchanged(*scheme, accessor);
   }
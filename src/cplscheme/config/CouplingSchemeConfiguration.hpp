@@ -124,6 +124,8 @@ private:
   const std::string VALUE_MULTI;
   const std::string VALUE_FIXED;
   const std::string VALUE_FIRST_PARTICIPANT;
+  const std::string VALUE_DEFAULT;
+  const std::string VALUE_POLYNOMIAL;
 
   struct Config {
     std::string                   type;
@@ -143,6 +145,7 @@ private:
     std::vector<std::tuple<int, bool, std::string, int, impl::PtrConvergenceMeasure>> convMeasures;
     int                                                                               maxIterations = -1;
     int                                                                               extrapolationOrder = 0;
+    BaseCouplingScheme::ExtrapolationType                                             extrapolationType  = BaseCouplingScheme::DefaultExtrapolation;
 
   } _config;
 
@@ -48,6 +48,7 @@ PostProcessingConfiguration::PostProcessingConfiguration(
       ATTR_IMVJCHUNKSIZE("chunk-size"),
       ATTR_RSLS_REUSEDTSTEPS("reused-timesteps-at-restart"),
       ATTR_RSSVD_TRUNCATIONEPS("truncation-threshold"),
+      ATTR_RSSVD_MAXRANK("max-rank"),
       ATTR_PRECOND_NONCONST_TIMESTEPS("freeze-after"),
       VALUE_CONSTANT("constant"),
       VALUE_AITKEN("aitken"),
@@ -234,6 +235,8 @@ void PostProcessingConfiguration::xmlTagCallback(
       _config.imvjRestartType           = impl::MVQNPostProcessing::RS_LS;
     } else if (f == VALUE_SVD_RESTART) {
       _config.imvjRSSVD_truncationEps = callingTag.getDoubleAttributeValue(ATTR_RSSVD_TRUNCATIONEPS);
+      _config.imvjRSSVD_maxRank       = callingTag.getIntAttributeValue(ATTR_RSSVD_MAXRANK);
+      CHECK(_config.imvjRSSVD_maxRank >= 0, "The maximum rank of the IMVJ restart mode RS-SVD must not be negative.");
       _config.imvjRestartType         = impl::MVQNPostProcessing::RS_SVD;
     } else if (f == VALUE_SLIDE_RESTART) {
       _config.imvjRestartType = impl::MVQNPostProcessing::RS_SLIDE;
@@ -320,7 +323,8 @@ void PostProcessingConfiguration::xmlEndTagCallback(
               _config.imvjRestartType,
               _config.imvjChunkSize,
               _config.imvjRSLS_reustedTimesteps,
-              _config.imvjRSSVD_truncationEps));
+              _config.imvjRSSVD_truncationEps,
+              _config.imvjRSSVD_maxRank));
 #else
       ERROR("Post processing IQN-IMVJ only works if preCICE is compiled with MPI");
 #endif
@@ -497,6 +501,7 @@ void PostProcessingConfiguration::addTypeSpecificSubtags(
                                     "  RS-ZERO:    IMVJ runs in restart mode. After M time steps all Jacobain information is dropped, restart with no information\n"
                                     "  RS-LS:      IMVJ runs in restart mode. After M time steps a IQN-LS like approximation for the initial guess of the Jacobian is computed.\n"
                                     "  RS-SVD:     IMVJ runs in restart mode. After M time steps a truncated SVD of the Jacobian is updated.\n"
+                                    "              With truncation-threshold 0 and max-rank 0, no modes are dropped and the updates are the same as for no-restart.\n"
                                     "  RS-SLIDE:   IMVJ runs in sliding window restart mode.\n");
     XMLAttribute<int> attrChunkSize(ATTR_IMVJCHUNKSIZE);
     attrChunkSize.setDocumentation("Specifies the number of time steps M after which the IMVJ restarts, if run in restart-mode. Defaul value is M=8.");
@@ -505,11 +510,17 @@ void PostProcessingConfiguration::addTypeSpecificSubtags(
     attrReusedTimeStepsAtRestart.setDocumentation("If IMVJ restart-mode=RS-LS, the number of reused time steps at restart can be specified.");
     attrReusedTimeStepsAtRestart.setDefaultValue(8);
     XMLAttribute<double> attrRSSVD_truncationEps(ATTR_RSSVD_TRUNCATIONEPS);
-    attrRSSVD_truncationEps.setDocumentation("If IMVJ restart-mode=RS-SVD, the truncation threshold for the updated SVD can be set.");
+    attrRSSVD_truncationEps.setDocumentation("If IMVJ restart-mode=RS-SVD, the truncation threshold for the updated SVD can be set. Modes with small singular values "
+                                             "are dropped, which keeps the rank of the SVD low. A threshold of 0 keeps all modes, the rank is then only bounded by the number of interface DOFs.");
     attrRSSVD_truncationEps.setDefaultValue(1e-4);
+    XMLAttribute<int> attrRSSVD_maxRank(ATTR_RSSVD_MAXRANK);
+    attrRSSVD_maxRank.setDocumentation("If IMVJ restart-mode=RS-SVD, the maximum number of modes of the updated SVD can be set. Modes with the smallest "
+                                       "singular values are dropped beyond it, which caps the memory of the Jacobian to 2 * max-rank * interface DOFs. 0 means unlimited.");
+    attrRSSVD_maxRank.setDefaultValue(0);
     tagIMVJRESTART.addAttribute(attrChunkSize);
     tagIMVJRESTART.addAttribute(attrReusedTimeStepsAtRestart);
     tagIMVJRESTART.addAttribute(attrRSSVD_truncationEps);
+    tagIMVJRESTART.addAttribute(attrRSSVD_maxRank);
     tag.addSubtag(tagIMVJRESTART);
 
     XMLTag            tagMaxUsedIter(*this, TAG_MAX_USED_ITERATIONS, XMLTag::OCCUR_ONCE);
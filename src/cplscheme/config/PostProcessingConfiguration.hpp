@@ -73,6 +73,7 @@ private:
   const std::string ATTR_IMVJCHUNKSIZE;
   const std::string ATTR_RSLS_REUSEDTSTEPS;
   const std::string ATTR_RSSVD_TRUNCATIONEPS;
+  const std::string ATTR_RSSVD_MAXRANK;
   const std::string ATTR_PRECOND_NONCONST_TIMESTEPS;
 
   const std::string VALUE_CONSTANT;
@@ -121,6 +122,7 @@ private:
     int                   imvjRestartType = 0;
     int                   imvjChunkSize = 0;
     int                   imvjRSLS_reustedTimesteps = 0;
+    int                   imvjRSSVD_maxRank = 0;
     int                   precond_nbNonConstTSteps = -1;
     double                singularityLimit= 0;
     double                imvjRSSVD_truncationEps = 0;
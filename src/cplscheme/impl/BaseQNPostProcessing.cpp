@@ -301,7 +301,8 @@ void BaseQNPostProcessing::performPostProcessing(
 {
   TRACE(_dataIDs.size(), cplData.size());
   
-  utils::Event e("cpl.computeQuasiNewtonUpdate", precice::syncMode);
+  static const utils::EventID updateEvent = utils::EventRegistry::instance().getEventID("cpl.computeQuasiNewtonUpdate");
+  utils::Event e(updateEvent, precice::syncMode);
 
   assertion(_oldResiduals.size() == _oldXTilde.size(), _oldResiduals.size(), _oldXTilde.size());
   assertion(_values.size() == _oldXTilde.size(), _values.size(), _oldXTilde.size());
@@ -361,9 +362,7 @@ void BaseQNPostProcessing::performPostProcessing(
       // re-computation of QR decomposition from _matrixV = _matrixVBackup
       // this occurs very rarely, to be precise, it occurs only if the coupling terminates
       // after the first iteration and the matrix data from time step t-2 has to be used
-      _preconditioner->apply(_matrixV);
-      _qrV.reset(_matrixV, getLSSystemRows());
-      _preconditioner->revert(_matrixV);
+      _qrV.reset(_matrixV, _preconditioner->diagonal(), getLSSystemRows());
       _resetLS = true; // need to recompute _Wtil, Q, R (only for IMVJ efficient update)
     }
 
@@ -381,12 +380,12 @@ void BaseQNPostProcessing::performPostProcessing(
      */
 
     _preconditioner->update(false, _values, _residuals);
-    // apply scaling to V, V' := P * V (only needed to reset the QR-dec of V)
-    _preconditioner->apply(_matrixV);
 
+    // the QR-dec is the decomposition of the scaled matrix P * V. V itself stays unscaled,
+    // the scaling is applied to its columns inside the QR kernels (only needed to reset the QR-dec of V)
     if (_preconditioner->requireNewQR()) {
       if (not(_filter == PostProcessing::QR2FILTER)) { //for QR2 filter, there is no need to do this twice
-        _qrV.reset(_matrixV, getLSSystemRows());
+        _qrV.reset(_matrixV, _preconditioner->diagonal(), getLSSystemRows());
       }
       _preconditioner->newQRfulfilled();
     }
@@ -394,9 +393,6 @@ void BaseQNPostProcessing::performPostProcessing(
     // apply the configured filter to the LS system
     applyFilter();
 
-    // revert scaling of V, in computeQNUpdate all data objects are unscaled.
-    _preconditioner->revert(_matrixV);
-
     /**
      * compute quasi-Newton update
      * PRECONDITION: All objects are unscaled, except the matrices within the QR-dec of V.
@@ -417,10 +413,17 @@ void BaseQNPostProcessing::performPostProcessing(
     if (_firstIteration && _timestepsReused == 0 && not _forceInitialRelaxation) {
       // save current matrix data in case the coupling for the next time step will terminate
       // after the first iteration (no new data, i.e., V = W = 0)
+      // If the matrices are cleared below anyway, they are handed over to the backup without copying.
       if (getLSSystemCols() > 0) {
-        _matrixColsBackup = _matrixCols;
-        _matrixVBackup    = _matrixV;
-        _matrixWBackup    = _matrixW;
+        if (_firstTimeStep) {
+          _matrixColsBackup = _matrixCols;
+          _matrixVBackup    = _matrixV;
+          _matrixWBackup    = _matrixW;
+        } else {
+          _matrixColsBackup.swap(_matrixCols);
+          _matrixVBackup.swap(_matrixV);
+          _matrixWBackup.swap(_matrixW);
+        }
       }
       // if no time steps reused, the matrix data needs to be cleared as it was only needed for the
       // QN-step in the first iteration (idea: rather perform QN-step with information from last converged
@@ -470,7 +473,7 @@ void BaseQNPostProcessing::applyFilter()
   } else {
     // do: filtering of least-squares system to maintain good conditioning
     std::vector<int> delIndices(0);
-    _qrV.applyFilter(_singularityLimit, delIndices, _matrixV);
+    _qrV.applyFilter(_singularityLimit, delIndices, _matrixV, _preconditioner->diagonal());
     // start with largest index (as V,W matrices are shrinked and shifted
     for (int i = delIndices.size() - 1; i >= 0; i--) {
 
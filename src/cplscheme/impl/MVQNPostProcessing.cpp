@@ -38,7 +38,8 @@ MVQNPostProcessing::MVQNPostProcessing(
     int               imvjRestartType,
     int               chunkSize,
     int               RSLSreusedTimesteps,
-    double            RSSVDtruncationEps)
+    double            RSSVDtruncationEps,
+    int               RSSVDmaxRank)
     : BaseQNPostProcessing(initialRelaxation, forceInitialRelaxation, maxIterationsUsed, timestepsReused,
                            filter, singularityLimit, dataIDs, preconditioner),
       //  _secondaryOldXTildes(),
@@ -64,6 +65,7 @@ MVQNPostProcessing::MVQNPostProcessing(
       //_info2(),
       _avgRank(0)
 {
+  _svdJ.setMaxRank(RSSVDmaxRank);
 }
 
 // ==================================================================================
@@ -179,7 +181,7 @@ void MVQNPostProcessing::initialize(
   _Wtil = Eigen::MatrixXd::Zero(entries, 0);
 
   if (utils::MasterSlave::_masterMode || (not utils::MasterSlave::_masterMode && not utils::MasterSlave::_slaveMode))
-    _infostringstream << " IMVJ restart mode: " << _imvjRestart << "\n chunk size: " << _chunkSize << "\n trunc eps: " << _svdJ.getThreshold() << "\n R_RS: " << _RSLSreusedTimesteps << "\n--------\n"
+    _infostringstream << " IMVJ restart mode: " << _imvjRestart << "\n chunk size: " << _chunkSize << "\n trunc eps: " << _svdJ.getThreshold() << "\n max rank: " << _svdJ.getMaxRank() << "\n R_RS: " << _RSLSreusedTimesteps << "\n--------\n"
                       << std::endl;
 }
 
@@ -785,19 +787,16 @@ void MVQNPostProcessing::specializedIterationsConverged(
     // call to computeQNUpdate. Need to call this before the preconditioner is updated.
 
     // |= REBUILD QR-dec if needed     ============|
-    // apply scaling to V, V' := P * V (only needed to reset the QR-dec of V)
-    _preconditioner->apply(_matrixV);
-
+    // the QR-dec of V' := P * V is rebuilt from the unscaled V, the scaling is applied within the QR kernels
     if (_preconditioner->requireNewQR()) {
       if (not(_filter == PostProcessing::QR2FILTER)) { //for QR2 filter, there is no need to do this twice
-        _qrV.reset(_matrixV, getLSSystemRows());
+        _qrV.reset(_matrixV, _preconditioner->diagonal(), getLSSystemRows());
       }
       _preconditioner->newQRfulfilled();
     }
     // apply the configured filter to the LS system
     // as it changed in BaseQNPostProcessing::iterationsConverged()
     BaseQNPostProcessing::applyFilter();
-    _preconditioner->revert(_matrixV);
     // |===================          ============|
 
     //              ------- RESTART/ JACOBIAN ASSEMBLY -------
@@ -849,6 +848,12 @@ void MVQNPostProcessing::specializedIterationsConverged(
   }
 }
 
+// ==================================================================================
+int MVQNPostProcessing::getSVDRank()
+{
+  return _svdJ.isSVDinitialized() ? _svdJ.rank() : 0;
+}
+
 // ==================================================================================
 void MVQNPostProcessing::removeMatrixColumn(
     int columnIndex)
@@ -55,7 +55,8 @@ public:
       int               imvjRestartType,
       int               chunkSize,
       int               RSLSreusedTimesteps,
-      double            RSSVDtruncationEps);
+      double            RSSVDtruncationEps,
+      int               RSSVDmaxRank);
 
   /**
     * @brief Destructor, empty.
@@ -75,6 +76,9 @@ public:
     */
   virtual void specializedIterationsConverged(DataMap &cplData);
 
+  /// @brief returns the rank of the truncated SVD of the Jacobian, if run in restart-mode RS-SVD.
+  int getSVDRank();
+
 private:
   /// @brief stores the approximation of the inverse Jacobian of the system at current time step.
   Eigen::MatrixXd _invJacobian;
@@ -123,6 +127,8 @@ private:
     *  - RS-ZERO:    imvj is run in restart-mode. After M time steps all stored matrices are dropped
     *  - RS-LS:      imvj in restart-mode. After M time steps restart with LS approximation for initial Jacobian
     *  - RS-SVD:     imvj in restart mode. After M time steps, update of an truncated SVD of the Jacobian.
+    *                The SVD is truncated by a threshold and a maximum rank, which caps the memory. Without
+    *                both, the updates are the same as for NO_RESTART.
     */
   int _imvjRestartType;
 
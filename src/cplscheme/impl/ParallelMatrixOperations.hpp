@@ -8,6 +8,7 @@
 #include "utils/MasterSlave.hpp"
 #include "utils/assertion.hpp"
 #include <Eigen/Core>
+#include <algorithm>
 
 namespace precice
 {
@@ -137,81 +138,92 @@ private:
     assertion(leftMatrix.rows() == rightMatrix.cols(), leftMatrix.rows(), rightMatrix.cols());
     assertion(result.rows() == p, result.rows(), p);
 
-    //int nextProc = (utils::MasterSlave::_rank + 1) % utils::MasterSlave::_size;
-    int prevProc = (utils::MasterSlave::_rank - 1 < 0) ? utils::MasterSlave::_size - 1 : utils::MasterSlave::_rank - 1;
-    int rows_rcv = (prevProc > 0) ? offsets[prevProc + 1] - offsets[prevProc] : offsets[1];
-    //Eigen::MatrixXd leftMatrix_rcv = Eigen::MatrixXd::Zero(rows_rcv, q);
-    Eigen::MatrixXd leftMatrix_rcv(rows_rcv, q);
+    int rank = utils::MasterSlave::_rank;
+    int size = utils::MasterSlave::_size;
 
-    com::PtrRequest requestSend;
+    // the blocks of leftMatrix (W_til) are cycled through two receive buffers, which are only
+    // allocated once, large enough to hold the largest block
+    int maxRows = 0;
+    for (int proc = 0; proc < size; proc++) {
+      maxRows = std::max(maxRows, offsets[proc + 1] - offsets[proc]);
+    }
+    for (auto &buffer : _cyclicBuffers) {
+      if (buffer.size() < maxRows * q)
+        buffer.resize(maxRows * q);
+    }
+
+    com::PtrRequest requestSendLocal;
+    com::PtrRequest requestSend[2];
     com::PtrRequest requestRcv;
+    int             current = 0;
 
     // initiate asynchronous send operation of leftMatrix (W_til) --> nextProc (this data is needed in cycle 1)    dim: n_local x cols
     if (leftMatrix.size() > 0)
-      requestSend = _cyclicCommRight->aSend(leftMatrix.data(), leftMatrix.size(), 0);
+      requestSendLocal = _cyclicCommRight->aSend(leftMatrix.data(), leftMatrix.size(), 0);
 
     // initiate asynchronous receive operation for leftMatrix (W_til) from previous processor --> W_til      dim: rows_rcv x cols
-    if (leftMatrix_rcv.size() > 0)
-      requestRcv = _cyclicCommLeft->aReceive(leftMatrix_rcv.data(), leftMatrix_rcv.size(), 0);
+    int prevProc = (rank - 1 < 0) ? size - 1 : rank - 1;
+    int rows_rcv = offsets[prevProc + 1] - offsets[prevProc];
+    if (rows_rcv * q > 0)
+      requestRcv = _cyclicCommLeft->aReceive(_cyclicBuffers[current].data(), rows_rcv * q, 0);
 
     // compute diagonal blocks where all data is local and no communication is needed
     // compute block matrices of J_inv of size (n_til x n_til), n_til = local n
-    Eigen::MatrixXd diagBlock(leftMatrix.rows(), leftMatrix.rows());
-    diagBlock.noalias() = leftMatrix * rightMatrix;
-
-    // set block at corresponding row-index on proc
-    int off = offsets[utils::MasterSlave::_rank];
-    assertion(result.cols() == diagBlock.cols(), result.cols(), diagBlock.cols());
-    result.block(off, 0, diagBlock.rows(), diagBlock.cols()) = diagBlock;
+    int off = offsets[rank];
+    assertion(result.cols() == rightMatrix.cols(), result.cols(), rightMatrix.cols());
+    result.block(off, 0, leftMatrix.rows(), rightMatrix.cols()).noalias() = leftMatrix * rightMatrix;
 
     /**
-		 * cyclic send-receive operation
-		 */
-    for (int cycle = 1; cycle < utils::MasterSlave::_size; cycle++) {
+     * cyclic send-receive operation, the block of the next cycle is in flight while the current one is multiplied
+     */
+    for (int cycle = 1; cycle < size; cycle++) {
+
+      // compute proc that owned the current block of leftMatrix (W_til) at the very beginning
+      int sourceProc = (rank - cycle < 0) ? size + (rank - cycle) : rank - cycle;
+      rows_rcv       = offsets[sourceProc + 1] - offsets[sourceProc];
 
       // wait until W_til from previous processor is fully received
-      if (requestSend != NULL)
-        requestSend->wait();
-      if (requestRcv != NULL)
+      if (requestRcv != nullptr) {
         requestRcv->wait();
-
-      // leftMatrix (leftMatrix_rcv) is available - needed for local multiplication and hand over to next proc
-      Eigen::MatrixXd leftMatrix_copy(leftMatrix_rcv);
-
-      // initiate async send to hand over leftMatrix (W_til) to the next proc (this data will be needed in the next cycle)    dim: n_local x cols
-      if (cycle < utils::MasterSlave::_size - 1) {
-        if (leftMatrix_copy.size() > 0)
-          requestSend = _cyclicCommRight->aSend(leftMatrix_copy.data(), leftMatrix_copy.size(), 0);
+        requestRcv = nullptr;
       }
+      Eigen::Map<Eigen::MatrixXd> leftMatrix_rcv(_cyclicBuffers[current].data(), rows_rcv, q);
+
+      if (cycle < size - 1) {
+        // initiate async send to hand over leftMatrix (W_til) to the next proc (this data will be needed in the next cycle)
+        if (leftMatrix_rcv.size() > 0)
+          requestSend[current] = _cyclicCommRight->aSend(leftMatrix_rcv.data(), leftMatrix_rcv.size(), 0);
+
+        // the other buffer can be reused as soon as it has been handed over to the next proc
+        int next = 1 - current;
+        if (requestSend[next] != nullptr) {
+          requestSend[next]->wait();
+          requestSend[next] = nullptr;
+        }
 
-      // compute proc that owned leftMatrix_rcv (Wtil_rcv) at the very beginning for each cylce
-      int sourceProc_nextCycle = (utils::MasterSlave::_rank - (cycle + 1) < 0) ? utils::MasterSlave::_size + (utils::MasterSlave::_rank - (cycle + 1)) : utils::MasterSlave::_rank - (cycle + 1);
-
-      int sourceProc = (utils::MasterSlave::_rank - cycle < 0) ? utils::MasterSlave::_size + (utils::MasterSlave::_rank - cycle) : utils::MasterSlave::_rank - cycle;
-
-      int rows_rcv_nextCycle = (sourceProc_nextCycle > 0) ? offsets[sourceProc_nextCycle + 1] - offsets[sourceProc_nextCycle] : offsets[1];
-      rows_rcv               = (sourceProc > 0) ? offsets[sourceProc + 1] - offsets[sourceProc] : offsets[1];
-      leftMatrix_rcv         = Eigen::MatrixXd::Zero(rows_rcv_nextCycle, q);
-
-      // initiate asynchronous receive operation for leftMatrix (W_til) from previous processor --> W_til (this data is needed in the next cycle)
-      if (cycle < utils::MasterSlave::_size - 1) {
-        if (leftMatrix_rcv.size() > 0) // only receive data, if data has been sent
-          requestRcv = _cyclicCommLeft->aReceive(leftMatrix_rcv.data(), leftMatrix_rcv.size(), 0);
+        // initiate asynchronous receive operation for leftMatrix (W_til) from previous processor (this data is needed in the next cycle)
+        int sourceProc_nextCycle = (rank - (cycle + 1) < 0) ? size + (rank - (cycle + 1)) : rank - (cycle + 1);
+        int rows_rcv_nextCycle   = offsets[sourceProc_nextCycle + 1] - offsets[sourceProc_nextCycle];
+        if (rows_rcv_nextCycle * q > 0) // only receive data, if data has been sent
+          requestRcv = _cyclicCommLeft->aReceive(_cyclicBuffers[next].data(), rows_rcv_nextCycle * q, 0);
       }
 
-      if (requestSend != NULL)
-        requestSend->wait();
-      // compute block with new local data
-      Eigen::MatrixXd block(rows_rcv, rightMatrix.cols());
-      block.noalias() = leftMatrix_copy * rightMatrix;
-
-      // set block at corresponding index in J_inv
+      // compute block with new local data and set it at corresponding index in J_inv
       // the row-offset of the current block is determined by the proc that sends the part of the W_til matrix
       // note: the direction and ordering of the cyclic sending operation is chosen s.t. the computed block is
       //       local on the current processor (in J_inv).
       off = offsets[sourceProc];
-      assertion(result.cols() == block.cols(), result.cols(), block.cols());
-      result.block(off, 0, block.rows(), block.cols()) = block;
+      result.block(off, 0, rows_rcv, rightMatrix.cols()).noalias() = leftMatrix_rcv * rightMatrix;
+
+      current = 1 - current;
+    }
+
+    // leftMatrix and the buffers must not be touched before all sends are completed
+    if (requestSendLocal != nullptr)
+      requestSendLocal->wait();
+    for (auto &request : requestSend) {
+      if (request != nullptr)
+        request->wait();
     }
   }
 
@@ -312,6 +324,9 @@ private:
   com::PtrCommunication _cyclicCommRight = nullptr;
 
   bool _needCycliclComm = true;
+
+  /// Receive buffers of the cyclic communication in _multiplyNN, used alternately
+  Eigen::VectorXd _cyclicBuffers[2];
 };
 }
 }
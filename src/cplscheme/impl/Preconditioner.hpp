@@ -197,6 +197,17 @@ public:
     return _weights;
   }
 
+  /**
+   * @brief Returns the weights as diagonal of the operator P, i.e., apply(M) equals diagonal().asDiagonal() * M
+   *
+   * Allows to apply the preconditioner lazily, e.g., to the columns of V while they are inserted into
+   * the QR-decomposition, instead of scaling and reverting the whole matrix.
+   */
+  Eigen::Map<const Eigen::VectorXd> diagonal() const
+  {
+    return Eigen::Map<const Eigen::VectorXd>(_weights.data(), _weights.size());
+  }
+
   bool isConst()
   {
     return _freezed;
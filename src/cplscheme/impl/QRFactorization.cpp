@@ -2,6 +2,8 @@
 #include "com/Communication.hpp"
 #include "cplscheme/impl/BaseQNPostProcessing.hpp"
 
+#include <Eigen/Cholesky>
+#include <Eigen/Eigenvalues>
 #include <algorithm> // std::sort
 #include <cmath>
 #include <iostream>
@@ -97,7 +99,16 @@ QRFactorization::QRFactorization(
 {
 }
 
-void QRFactorization::applyFilter(double singularityLimit, std::vector<int> &delIndices, Eigen::MatrixXd &V)
+void QRFactorization::applyFilter(double singularityLimit, std::vector<int> &delIndices, Eigen::MatrixXd const &V)
+{
+  applyFilter(singularityLimit, delIndices, V, Eigen::VectorXd());
+}
+
+void QRFactorization::applyFilter(
+    double                                   singularityLimit,
+    std::vector<int> &                       delIndices,
+    Eigen::MatrixXd const &                  V,
+    Eigen::Ref<const Eigen::VectorXd> const &scaling)
 {
   TRACE();
   delIndices.resize(0);
@@ -135,14 +146,18 @@ void QRFactorization::applyFilter(double singularityLimit, std::vector<int> &del
       }
     }
   } else if (_filter == PostProcessing::QR2FILTER) {
+    _rows = V.rows();
+
     _Q.resize(0, 0);
     _R.resize(0, 0);
     _cols = 0;
-    _rows = V.rows();
     // starting with the most recent input/output information, i.e., the latest column
     // which is at position 0 in _matrixV (latest information is never filtered out!)
     for (int k = 0; k < V.cols(); k++) {
       Eigen::VectorXd v = V.col(k);
+      if (scaling.size() > 0) {
+        v.array() *= scaling.array();
+      }
       // this is the same as pushBack(v) as _cols grows within the insertion process
       bool inserted = insertColumn(_cols, v, singularityLimit);
       if (!inserted) {
@@ -610,6 +625,59 @@ int QRFactorization::orthogonalize_stable(
   return k;
 }
 
+bool QRFactorization::computeCholQR2(Eigen::MatrixXd const &A, Eigen::Ref<const Eigen::VectorXd> const &scaling)
+{
+  TRACE();
+
+  int m = A.cols();
+  // a quadratic or underdetermined system has no positive definite Gram matrix
+  if (m == 0 || m >= _globalRows) {
+    return false;
+  }
+
+  Eigen::MatrixXd Q;
+  if (scaling.size() > 0) {
+    assertion(scaling.size() == A.rows(), scaling.size(), A.rows());
+    Q = scaling.asDiagonal() * A;
+  } else {
+    Q = A;
+  }
+  Eigen::MatrixXd R = Eigen::MatrixXd::Identity(m, m);
+
+  // the second pass restores the orthogonality of Q that is lost in the first pass
+  for (int pass = 0; pass < 2; pass++) {
+    Eigen::MatrixXd gram = Q.transpose() * Q;
+    if (utils::MasterSlave::_masterMode || utils::MasterSlave::_slaveMode) {
+      Eigen::MatrixXd localGram = gram;
+      utils::MasterSlave::allreduceSum(localGram.data(), gram.data(), m * m);
+    }
+
+    // CholQR2 is only stable if the condition of Q is well below 1/sqrt(machine precision).
+    // The eigenvalues of the small Gram matrix are the squared singular values of Q, which gives
+    // the condition exactly, contrary to the diagonal of the Cholesky factor.
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigenSolver(gram, Eigen::EigenvaluesOnly);
+    Eigen::VectorXd const &                        eigenvalues = eigenSolver.eigenvalues(); // ascending
+    if (eigenSolver.info() != Eigen::Success || eigenvalues(0) <= _cholQRLimit * _cholQRLimit * eigenvalues(m - 1)) {
+      return false;
+    }
+
+    Eigen::LLT<Eigen::MatrixXd> llt(gram);
+    if (llt.info() != Eigen::Success) {
+      return false;
+    }
+    Eigen::MatrixXd Rpass = llt.matrixU();
+
+    Rpass.triangularView<Eigen::Upper>().solveInPlace<Eigen::OnTheRight>(Q);
+    R = Rpass.triangularView<Eigen::Upper>() * R;
+  }
+
+  _Q    = Q;
+  _R    = R.triangularView<Eigen::Upper>();
+  _rows = A.rows();
+  _cols = m;
+  return true;
+}
+
 /**
  * @short computes parameters for givens matrix G for which  (x,y)G = (z,0). replaces (x,y) by (z,0)
  */
@@ -718,6 +786,17 @@ void QRFactorization::reset(
     double                 omega,
     double                 theta,
     double                 sigma)
+{
+  reset(A, Eigen::VectorXd(), globalRows, omega, theta, sigma);
+}
+
+void QRFactorization::reset(
+    Eigen::MatrixXd const &                  A,
+    Eigen::Ref<const Eigen::VectorXd> const &scaling,
+    int                                      globalRows,
+    double                                   omega,
+    double                                   theta,
+    double                                   sigma)
 {
   TRACE();
   _Q.resize(0, 0);
@@ -729,11 +808,19 @@ void QRFactorization::reset(
   _sigma      = sigma;
   _globalRows = globalRows;
 
-  int m   = A.cols();
+  int m = A.cols();
+  if (computeCholQR2(A, scaling)) {
+    return;
+  }
+  DEBUG("CholQR2 failed, the columns are inserted one by one into the QR-decomposition.");
+
   int col = 0, k = 0;
   for (; col < m; k++, col++) {
-    Eigen::VectorXd v        = A.col(col);
-    bool            inserted = insertColumn(k, v);
+    Eigen::VectorXd v = A.col(col);
+    if (scaling.size() > 0) {
+      v.array() *= scaling.array();
+    }
+    bool inserted = insertColumn(k, v);
     if (not inserted) {
       k--;
       DEBUG("column " << col << " has not been inserted in the QR-factorization, failed to orthogonalize.");
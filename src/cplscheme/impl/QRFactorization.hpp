@@ -82,6 +82,9 @@ public:
 
   /**
     * @brief resets the QR factorization to be the factorization of A = QR
+    *
+    * The factorization is computed blockwise with CholQR2 (two global reductions in total).
+    * If A is too ill-conditioned for that, the columns are inserted one by one using Gram-Schmidt.
     */
   void reset(
       Eigen::MatrixXd const &A,
@@ -90,6 +93,20 @@ public:
       double                 theta = 1. / 0.7,
       double                 sigma = std::numeric_limits<double>::min());
 
+  /**
+    * @brief resets the QR factorization to be the factorization of diag(scaling) * A = QR
+    *
+    * The scaling is applied to the columns of A while they are factorized, A itself is not modified.
+    * An empty scaling vector is treated as identity.
+    */
+  void reset(
+      Eigen::MatrixXd const &                  A,
+      Eigen::Ref<const Eigen::VectorXd> const &scaling,
+      int                                      globalRows,
+      double                                   omega = 0,
+      double                                   theta = 1. / 0.7,
+      double                                   sigma = std::numeric_limits<double>::min());
+
   /**
     * @brief inserts a new column at arbitrary position and updates the QR factorization
     * This function works on the memory of v, thus changes the Vector v.
@@ -133,7 +150,19 @@ public:
     * to the defined filter technique. This is done to ensure good conditioning
     * @param [out] delIndices - a vector of indices of deleted columns from the LS-system
     */
-  void applyFilter(double singularityLimit, std::vector<int> &delIndices, Eigen::MatrixXd &V);
+  void applyFilter(double singularityLimit, std::vector<int> &delIndices, Eigen::MatrixXd const &V);
+
+  /**
+    * @brief filters the least squares system, i.e., the decomposition Q*R = diag(scaling)*V.
+    *
+    * Same as above, but the QR2-filter rebuilds the decomposition from the scaled columns of V
+    * without modifying V. An empty scaling vector is treated as identity.
+    */
+  void applyFilter(
+      double                                   singularityLimit,
+      std::vector<int> &                       delIndices,
+      Eigen::MatrixXd const &                  V,
+      Eigen::Ref<const Eigen::VectorXd> const &scaling);
 
   /**
     * @brief returns a matrix representation of the orthogonal matrix Q
@@ -192,6 +221,20 @@ private:
    */
   int orthogonalize(Eigen::VectorXd &v, Eigen::VectorXd &r, double &rho, int colNum);
 
+  /**
+   * @short computes the factorization A = QR of all columns at once using CholQR2, i.e.,
+   *   R1 = chol(A^T A), Q1 = A R1^{-1}, R2 = chol(Q1^T Q1), Q = Q1 R2^{-1}, R = R2 R1.
+   *   In master-slave mode, only the two Gram matrices need to be reduced, instead of several
+   *   reductions per column as with orthogonalize().
+   *
+   *   CholQR2 squares the condition number of A. If the condition number of A, computed from the
+   *   eigenvalues of the Gram matrix, exceeds 1/_cholQRLimit, or if the Gram matrix is not numerically
+   *   positive definite, Q and R are left untouched and false is returned. The caller then has to fall back
+   *   to the column-wise insertion. As the Gram matrices are identical on all ranks, so is the decision.
+   *   If scaling is not empty, diag(scaling) * A is factorized instead of A.
+   */
+  bool computeCholQR2(Eigen::MatrixXd const &A, Eigen::Ref<const Eigen::VectorXd> const &scaling);
+
   /**
   * @short computes parameters for givens matrix G for which  (x,y)G = (z,0). replaces (x,y) by (z,0)
   */
@@ -221,6 +264,9 @@ private:
   bool          _fstream_set;
 
   int _globalRows;
+
+  /// Lower limit for the inverse condition number of A in computeCholQR2(), below it the column-wise insertion is used.
+  static constexpr double _cholQRLimit = 1e-6;
 };
 }
 }
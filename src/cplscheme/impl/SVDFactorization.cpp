@@ -278,6 +278,16 @@ double SVDFactorization::getThreshold()
   return _truncationEps;
 }
 
+void SVDFactorization::setMaxRank(int maxRank)
+{
+  _maxRank = maxRank;
+}
+
+int SVDFactorization::getMaxRank()
+{
+  return _maxRank;
+}
+
 int SVDFactorization::getWaste()
 {
   int r  = _waste;
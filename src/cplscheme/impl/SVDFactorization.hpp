@@ -51,7 +51,7 @@ public:
   /** @brief: updates the SVD decomposition with the rank-1 update A*B^T, i.e.,
     *               _psi * _sigma * _phi^T + A*B^T
     *  and overrides the internal SVD representation. After the update, the SVD is
-    *  truncated according to the threshold _truncationEps
+    *  truncated according to the threshold _truncationEps and to at most _maxRank modes.
     */
   template <typename Derived1, typename Derived2>
   void update(
@@ -164,6 +164,11 @@ public:
         break;
       }
     }
+    // the singular values are sorted, hence the modes beyond the maximum rank are the least important ones
+    if (_maxRank > 0 && _cols > _maxRank) {
+      waste += _cols - _maxRank;
+      _cols = _maxRank;
+    }
     _waste += waste;
 
     _psi.conservativeResize(_rows, _cols);
@@ -218,6 +223,12 @@ public:
   /// @brief: returns the truncation threshold for the SVD
   double getThreshold();
 
+  /// @brief: sets the maximum rank of the truncated SVD, 0 means unlimited
+  void setMaxRank(int maxRank);
+
+  /// @brief: returns the maximum rank of the truncated SVD, 0 means unlimited
+  int getMaxRank();
+
   /// @brief: applies the preconditioner to the factorized and truncated representation of the Jacobian matrix
   //void applyPreconditioner();
 
@@ -279,6 +290,9 @@ private:
   /// Truncation parameter for the updated SVD decomposition
   double _truncationEps;
 
+  /// Maximum number of modes of the updated SVD decomposition, 0 means unlimited
+  int _maxRank = 0;
+
   /// Threshold for the QR2 filter for the QR decomposition.
   double _epsQR2 = 1e-3;
 
@@ -80,6 +80,7 @@ BOOST_AUTO_TEST_CASE(testMVQNPP)
   int restartType = cplscheme::impl::MVQNPostProcessing::NO_RESTART;
   double singularityLimit = 1e-10;
   double svdTruncationEps = 0.0;
+  int    svdMaxRank = 0;
   bool enforceInitialRelaxation = false;
   bool alwaysBuildJacobian = false;
   std::vector<int> dataIDs;
@@ -93,7 +94,7 @@ BOOST_AUTO_TEST_CASE(testMVQNPP)
 
   cplscheme::impl::MVQNPostProcessing pp(initialRelaxation, enforceInitialRelaxation, maxIterationsUsed,
       timestepsReused, filter, singularityLimit, dataIDs, prec, alwaysBuildJacobian,
-      restartType, chunkSize, reusedTimestepsAtRestart, svdTruncationEps);
+      restartType, chunkSize, reusedTimestepsAtRestart, svdTruncationEps, svdMaxRank);
 
   Eigen::VectorXd dvalues;
   Eigen::VectorXd dcol1;
@@ -166,6 +167,93 @@ BOOST_AUTO_TEST_CASE(testMVQNPP)
   BOOST_TEST(testing::equals((*data.at(1)->values)(3), 8.28025852497733250157e-02));
 }
 
+/// Runs IMVJ on a linear fixed-point problem, returns all post-processed values and the rank of the SVD after each time step
+void runLinearIMVJ(int restartType, double truncationEps, int maxRank, int timesteps,
+                   std::vector<Eigen::VectorXd> &results, std::vector<int> &ranks)
+{
+  using DataMap = std::map<int, PtrCouplingData>;
+
+  int                 n         = 10;
+  int                 chunkSize = 1;
+  std::vector<int>    dataIDs{0, 1};
+  std::vector<double> factors(2, 1.0);
+  cplscheme::impl::PtrPreconditioner prec(new cplscheme::impl::ConstantPreconditioner(factors));
+  mesh::PtrMesh dummyMesh(new mesh::Mesh("DummyMesh", 3, false));
+
+  cplscheme::impl::MVQNPostProcessing pp(0.1, false, 50, 6, cplscheme::impl::PostProcessing::QR1FILTER, 1e-10,
+                                         dataIDs, prec, false, restartType, chunkSize, 0, truncationEps, maxRank);
+
+  Eigen::VectorXd dvalues = Eigen::VectorXd::Constant(n, 1.0);
+  Eigen::VectorXd fvalues = Eigen::VectorXd::Constant(n, 0.1);
+  PtrCouplingData dpcd(new CouplingData(&dvalues, dummyMesh, false, 1));
+  PtrCouplingData fpcd(new CouplingData(&fvalues, dummyMesh, false, 1));
+  DataMap         data;
+  data.insert(std::pair<int, PtrCouplingData>(0, dpcd));
+  data.insert(std::pair<int, PtrCouplingData>(1, fpcd));
+  pp.initialize(data);
+
+  for (int t = 0; t < timesteps; t++) {
+    for (int it = 0; it < 4; it++) {
+      // linear fixed-point operator
+      for (int i = 0; i < n; i++) {
+        double d   = dvalues(i);
+        dvalues(i) = 0.5 * d + 0.1 * fvalues(i) + i;
+        fvalues(i) = 0.2 * d - 0.3 * fvalues(i) + t;
+      }
+      pp.performPostProcessing(data);
+      results.push_back(dvalues);
+      results.push_back(fvalues);
+    }
+    pp.iterationsConverged(data);
+    ranks.push_back(pp.getSVDRank());
+    dpcd->oldValues.col(0) = dvalues;
+    fpcd->oldValues.col(0) = fvalues;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testMVQNPPSVDRestartWithoutTruncation)
+{
+  // without truncation, RS-SVD only stores the factors of the Jacobian, the updates have to be the same as with the explicit Jacobian
+  std::vector<Eigen::VectorXd> explicitJacobian, svdFactors;
+  std::vector<int>             explicitRanks, svdRanks;
+  runLinearIMVJ(cplscheme::impl::MVQNPostProcessing::NO_RESTART, 0.0, 0, 4, explicitJacobian, explicitRanks);
+  runLinearIMVJ(cplscheme::impl::MVQNPostProcessing::RS_SVD, 0.0, 0, 4, svdFactors, svdRanks);
+  BOOST_TEST(explicitJacobian.size() == svdFactors.size());
+  for (size_t i = 0; i < explicitJacobian.size(); i++) {
+    BOOST_TEST(testing::equals(explicitJacobian[i], svdFactors[i], 1e-8));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testMVQNPPSVDRestartWithTruncation)
+{
+  // with truncation, the rank of the SVD has to stay bounded, although every time step adds new columns
+  std::vector<Eigen::VectorXd> results;
+  std::vector<int>             ranks, truncatedRanks;
+  runLinearIMVJ(cplscheme::impl::MVQNPostProcessing::RS_SVD, 0.0, 0, 12, results, ranks);
+  runLinearIMVJ(cplscheme::impl::MVQNPostProcessing::RS_SVD, 1e-2, 0, 12, results, truncatedRanks);
+  BOOST_TEST(ranks.back() > ranks[1]);
+  for (size_t t = 1; t < truncatedRanks.size(); t++) {
+    BOOST_TEST(truncatedRanks[t] > 0);
+    BOOST_TEST(truncatedRanks[t] <= truncatedRanks[1]);
+    BOOST_TEST(truncatedRanks[t] < ranks[t]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testMVQNPPSVDRestartWithMaxRank)
+{
+  // without truncation threshold, the maximum rank alone has to cap the SVD and thus the memory of the Jacobian
+  std::vector<Eigen::VectorXd> results;
+  std::vector<int>             ranks, cappedRanks;
+  int                          maxRank = 3;
+  runLinearIMVJ(cplscheme::impl::MVQNPostProcessing::RS_SVD, 0.0, 0, 12, results, ranks);
+  runLinearIMVJ(cplscheme::impl::MVQNPostProcessing::RS_SVD, 0.0, maxRank, 12, results, cappedRanks);
+  BOOST_TEST(ranks.back() > maxRank);
+  for (int rank : cappedRanks) {
+    BOOST_TEST(rank <= maxRank);
+  }
+  BOOST_TEST(cappedRanks.back() == maxRank);
+}
+
 BOOST_AUTO_TEST_CASE(testVIQNPP)
 {
   //use two vectors and see if underrelaxation works
@@ -1,6 +1,8 @@
 #ifndef PRECICE_NO_MPI
 
 #include <Eigen/Core>
+#include <chrono>
+#include <iostream>
 #include "../impl/ParallelMatrixOperations.hpp"
 #include "com/Communication.hpp"
 #include "com/MPIDirectCommunication.hpp"
@@ -343,6 +345,67 @@ BOOST_AUTO_TEST_CASE(ParallelMatrixMatrixOp,  * boost::unit_test::fixture<testin
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+/// Measures the cyclic multiplication W_til * Z = J for growing interface sizes.
+/// Disabled by default, run with different numbers of ranks to also scale the number of ranks.
+BOOST_AUTO_TEST_CASE(ParallelMatrixOperationsBenchmark,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::MasterComFixture>()
+                     * boost::unit_test::disabled())
+{
+  com::PtrCommunication _cyclicCommLeft  = com::PtrCommunication(new com::MPIPortsCommunication("."));
+  com::PtrCommunication _cyclicCommRight = com::PtrCommunication(new com::MPIPortsCommunication("."));
+
+  int rank     = utils::Parallel::getProcessRank();
+  int size     = utils::Parallel::getCommunicatorSize();
+  int prevProc = (rank - 1 < 0) ? size - 1 : rank - 1;
+  if ((rank % 2) == 0) {
+    _cyclicCommLeft->acceptConnection("cyclicComm-" + std::to_string(prevProc), "", rank);
+    _cyclicCommRight->requestConnection("cyclicComm-" + std::to_string(rank), "", 0, 1);
+  } else {
+    _cyclicCommRight->requestConnection("cyclicComm-" + std::to_string(rank), "", 0, 1);
+    _cyclicCommLeft->acceptConnection("cyclicComm-" + std::to_string(prevProc), "", rank);
+  }
+
+  cplscheme::impl::ParallelMatrixOperations parMatrixOps;
+  parMatrixOps.initialize(_cyclicCommLeft, _cyclicCommRight, true);
+
+  int m_global    = 20;
+  int repetitions = 5;
+  for (int n_global : {1000, 2000, 4000, 8000, 16000}) {
+    std::vector<int> vertexOffsets(size + 1, 0);
+    for (int proc = 0; proc < size; proc++) {
+      vertexOffsets[proc + 1] = vertexOffsets[proc] + n_global / size + (proc < n_global % size ? 1 : 0);
+    }
+    int n_local = vertexOffsets[rank + 1] - vertexOffsets[rank];
+
+    Eigen::MatrixXd W_local = Eigen::MatrixXd::Random(n_local, m_global);
+    Eigen::MatrixXd Z_local = Eigen::MatrixXd::Random(m_global, n_local);
+    Eigen::MatrixXd J_local(n_global, n_local);
+
+    utils::Parallel::synchronizeProcesses();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repetitions; i++) {
+      parMatrixOps.multiply(W_local, Z_local, J_local, vertexOffsets, n_global, m_global, n_global);
+    }
+    utils::Parallel::synchronizeProcesses();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    if (utils::MasterSlave::_masterMode) {
+      std::cout << "multiplyNN: ranks = " << size << ", n = " << n_global << ", m = " << m_global
+                << ", time per multiplication = " << elapsed.count() / repetitions << " ms" << std::endl;
+    }
+  }
+
+  if ((rank % 2) == 0) {
+    _cyclicCommLeft->closeConnection();
+    _cyclicCommRight->closeConnection();
+  } else {
+    _cyclicCommRight->closeConnection();
+    _cyclicCommLeft->closeConnection();
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif // PRECICE_NO_MPI
@@ -275,6 +275,7 @@ BOOST_AUTO_TEST_CASE(testVIQNIMVJpp, * testing::OnSize(4) * boost::unit_test::fi
   int reusedTimeStepsAtRestart = 0;
   double singularityLimit = 1e-10;
   double svdTruncationEps = 0.0;
+  int    svdMaxRank = 0;
   bool enforceInitialRelaxation = false;
   bool alwaysBuildJacobian = false;
 
@@ -291,7 +292,7 @@ BOOST_AUTO_TEST_CASE(testVIQNIMVJpp, * testing::OnSize(4) * boost::unit_test::fi
 
   cplscheme::impl::MVQNPostProcessing pp(initialRelaxation, enforceInitialRelaxation, maxIterationsUsed,
       timestepsReused, filter, singularityLimit, dataIDs, prec, alwaysBuildJacobian,
-      restartType, chunkSize, reusedTimeStepsAtRestart, svdTruncationEps);
+      restartType, chunkSize, reusedTimeStepsAtRestart, svdTruncationEps, svdMaxRank);
 
   Eigen::VectorXd dvalues;
   Eigen::VectorXd dcol1;
@@ -504,6 +505,7 @@ BOOST_AUTO_TEST_CASE(testIMVJ_effUpdate_pp, * testing::OnSize(4) * boost::unit_t
   int reusedTimeStepsAtRestart = 0;
   double singularityLimit = 1e-2;
   double svdTruncationEps = 0.0;
+  int    svdMaxRank = 0;
   bool enforceInitialRelaxation = false;
   bool alwaysBuildJacobian = false;
 
@@ -518,7 +520,7 @@ BOOST_AUTO_TEST_CASE(testIMVJ_effUpdate_pp, * testing::OnSize(4) * boost::unit_t
 
   cplscheme::impl::MVQNPostProcessing pp(initialRelaxation, enforceInitialRelaxation, maxIterationsUsed,
       timestepsReused, filter, singularityLimit, dataIDs, _preconditioner, alwaysBuildJacobian,
-      restartType, chunkSize, reusedTimeStepsAtRestart, svdTruncationEps);
+      restartType, chunkSize, reusedTimeStepsAtRestart, svdTruncationEps, svdMaxRank);
 
   Eigen::VectorXd dvalues;
   Eigen::VectorXd doldValues;
@@ -146,4 +146,103 @@ BOOST_AUTO_TEST_CASE(testQRFactorization)
   testQRequalsA(qr_1.matrixQ(), qr_1.matrixR(), A);
 }
 
+BOOST_AUTO_TEST_CASE(testQRFactorizationBlockReset)
+{
+  int             m = 6, n = 8;
+  Eigen::MatrixXd A(n, m);
+
+  // Set values according to a shifted Hilbert matrix, which is well-conditioned.
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < m; j++) {
+      A(i, j) = 1.0 / static_cast<double>(i + j + 1);
+    }
+    if (i < m)
+      A(i, i) += 1.0;
+  }
+
+  // column-wise Gram-Schmidt as reference
+  impl::QRFactorization qr_ref(A, impl::BaseQNPostProcessing::QR2FILTER);
+
+  // blockwise CholQR2
+  impl::QRFactorization qr_block(impl::BaseQNPostProcessing::QR2FILTER);
+  qr_block.reset(A, A.rows());
+  BOOST_TEST(qr_block.cols() == m);
+  testQTQequalsIdentity(qr_block.matrixQ());
+  testQRequalsA(qr_block.matrixQ(), qr_block.matrixR(), A);
+  BOOST_TEST(testing::equals(qr_block.matrixQ(), qr_ref.matrixQ(), 1e-10));
+  BOOST_TEST(testing::equals(qr_block.matrixR(), qr_ref.matrixR(), 1e-10));
+
+  // QR2-filter does not remove any column of a well-conditioned matrix
+  std::vector<int> delIndices;
+  qr_block.applyFilter(1e-2, delIndices, A);
+  BOOST_TEST(delIndices.empty());
+  BOOST_TEST(qr_block.cols() == m);
+  testQRequalsA(qr_block.matrixQ(), qr_block.matrixR(), A);
+
+  // QR2-filter removes a linear dependent column, the remaining columns are factorized column-wise
+  Eigen::MatrixXd B = A;
+  B.col(3)          = B.col(1);
+  qr_block.applyFilter(1e-2, delIndices, B);
+  BOOST_TEST(delIndices.size() == 1);
+  BOOST_TEST(delIndices.front() == 3);
+  BOOST_TEST(qr_block.cols() == m - 1);
+  testQTQequalsIdentity(qr_block.matrixQ());
+}
+
+BOOST_AUTO_TEST_CASE(testQRFactorizationIllConditionedReset)
+{
+  int             m = 6, n = 8;
+  Eigen::MatrixXd A(n, m);
+
+  // Hilbert matrix, its condition is too large for CholQR2
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < m; j++) {
+      A(i, j) = 1.0 / static_cast<double>(i + j + 1);
+    }
+  }
+
+  // reset() falls back to the column-wise Gram-Schmidt
+  impl::QRFactorization qr_ref(A, impl::BaseQNPostProcessing::QR2FILTER);
+  impl::QRFactorization qr_block(impl::BaseQNPostProcessing::QR2FILTER);
+  qr_block.reset(A, A.rows());
+  BOOST_TEST(qr_block.cols() == m);
+  testQTQequalsIdentity(qr_block.matrixQ());
+  BOOST_TEST(testing::equals(qr_block.matrixQ(), qr_ref.matrixQ(), 1e-14));
+  BOOST_TEST(testing::equals(qr_block.matrixR(), qr_ref.matrixR(), 1e-14));
+}
+
+BOOST_AUTO_TEST_CASE(testQRFactorizationScaledReset)
+{
+  int             m = 4, n = 8;
+  Eigen::MatrixXd A(n, m);
+  Eigen::VectorXd scaling(n);
+
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < m; j++) {
+      A(i, j) = 1.0 / static_cast<double>(i + j + 1);
+    }
+    if (i < m)
+      A(i, i) += 1.0;
+    // weights of two sub-vectors with different magnitude, as for a preconditioner
+    scaling(i) = (i < n / 2) ? 1e2 : 1e-3;
+  }
+  Eigen::MatrixXd scaledA = scaling.asDiagonal() * A;
+
+  // scaling applied within the QR kernels, A is not modified
+  impl::QRFactorization qr_scaled(impl::BaseQNPostProcessing::QR2FILTER);
+  Eigen::MatrixXd       Acopy = A;
+  qr_scaled.reset(A, scaling, A.rows());
+  BOOST_TEST(testing::equals(A, Acopy));
+  BOOST_TEST(qr_scaled.cols() == m);
+  testQTQequalsIdentity(qr_scaled.matrixQ());
+  testQRequalsA(qr_scaled.matrixQ(), qr_scaled.matrixR(), scaledA);
+
+  // QR2-filter rebuilds the decomposition from the scaled columns
+  std::vector<int> delIndices;
+  qr_scaled.applyFilter(1e-2, delIndices, A, scaling);
+  BOOST_TEST(delIndices.empty());
+  BOOST_TEST(qr_scaled.cols() == m);
+  testQRequalsA(qr_scaled.matrixQ(), qr_scaled.matrixR(), scaledA);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -451,25 +451,28 @@ BOOST_AUTO_TEST_CASE(testExtrapolateData)
   CouplingData* cplData = scheme.getSendData(dataID);
   BOOST_CHECK(cplData); // no nullptr
   BOOST_TEST(cplData->values->size() == 1);
-  BOOST_TEST(cplData->oldValues.cols() == 2);
+  BOOST_TEST(cplData->oldValues.cols() == 1);
   BOOST_TEST(cplData->oldValues.rows() == 1);
+  BOOST_TEST(cplData->timestepValues.cols() == 2);
+  BOOST_TEST(cplData->timestepValues.rows() == 1);
   BOOST_TEST(testing::equals((*cplData->values)[0], 0.0));
   BOOST_TEST(testing::equals(cplData->oldValues(0,0), 0.0));
-  BOOST_TEST(testing::equals(cplData->oldValues(0,1), 0.0));
+  BOOST_TEST(testing::equals(cplData->pastTimestep(0)(0), 0.0));
 
   (*cplData->values)[0] = 1.0;
   scheme.setTimesteps(scheme.getTimesteps() + 1);
   scheme.extrapolateData(scheme.getSendData());
   BOOST_TEST(testing::equals((*cplData->values)[0], 2.0));
   BOOST_TEST(testing::equals(cplData->oldValues(0,0), 2.0));
-  BOOST_TEST(testing::equals(cplData->oldValues(0,1), 1.0));
+  BOOST_TEST(testing::equals(cplData->pastTimestep(0)(0), 1.0));
 
   (*cplData->values)[0] = 4.0;
   scheme.setTimesteps(scheme.getTimesteps() + 1);
   scheme.extrapolateData(scheme.getSendData());
   BOOST_TEST(testing::equals((*cplData->values)[0], 7.0));
   BOOST_TEST(testing::equals(cplData->oldValues(0,0), 7.0));
-  BOOST_TEST(testing::equals(cplData->oldValues(0,1), 4.0));
+  BOOST_TEST(testing::equals(cplData->pastTimestep(0)(0), 4.0));
+  BOOST_TEST(testing::equals(cplData->pastTimestep(1)(0), 1.0));
 
   // Test second order extrapolation
   *cplData->values = Eigen::VectorXd::Zero(cplData->values->size());
@@ -484,28 +487,78 @@ BOOST_AUTO_TEST_CASE(testExtrapolateData)
   cplData = scheme2.getSendData(dataID);
   BOOST_CHECK(cplData); // no nullptr
   BOOST_TEST(cplData->values->size() == 1);
-  BOOST_TEST(cplData->oldValues.cols() == 3);
+  BOOST_TEST(cplData->oldValues.cols() == 1);
   BOOST_TEST(cplData->oldValues.rows() == 1);
+  BOOST_TEST(cplData->timestepValues.cols() == 3);
   BOOST_TEST(testing::equals((*cplData->values)[0], 0.0 ));
   BOOST_TEST(testing::equals(cplData->oldValues(0,0), 0.0 ));
-  BOOST_TEST(testing::equals(cplData->oldValues(0,1), 0.0 ));
-  BOOST_TEST(testing::equals(cplData->oldValues(0,2), 0.0 ));
+  BOOST_TEST(testing::equals(cplData->pastTimestep(0)(0), 0.0 ));
+  BOOST_TEST(testing::equals(cplData->pastTimestep(1)(0), 0.0 ));
 
   (*cplData->values)[0] = 1.0;
   scheme2.setTimesteps(scheme2.getTimesteps() + 1);
   scheme2.extrapolateData(scheme2.getSendData());
   BOOST_TEST(testing::equals((*cplData->values)[0], 2.0 ));
   BOOST_TEST(testing::equals(cplData->oldValues(0,0), 2.0 ));
-  BOOST_TEST(testing::equals(cplData->oldValues(0,1), 1.0 ));
-  BOOST_TEST(testing::equals(cplData->oldValues(0,2), 0.0 ));
+  BOOST_TEST(testing::equals(cplData->pastTimestep(0)(0), 1.0 ));
+  BOOST_TEST(testing::equals(cplData->pastTimestep(1)(0), 0.0 ));
 
   (*cplData->values)[0] = 4.0;
   scheme2.setTimesteps(scheme2.getTimesteps() + 1);
   scheme2.extrapolateData(scheme2.getSendData());
   BOOST_TEST(testing::equals((*cplData->values)[0], 8.0 ));
   BOOST_TEST(testing::equals(cplData->oldValues(0,0), 8.0 ));
-  BOOST_TEST(testing::equals(cplData->oldValues(0,1), 4.0 ));
-  BOOST_TEST(testing::equals(cplData->oldValues(0,2), 1.0 ));
+  BOOST_TEST(testing::equals(cplData->pastTimestep(0)(0), 4.0 ));
+  BOOST_TEST(testing::equals(cplData->pastTimestep(1)(0), 1.0 ));
+}
+
+BOOST_AUTO_TEST_CASE(testPolynomialExtrapolation)
+{
+  using namespace mesh;
+
+  PtrMesh mesh(new Mesh("MyMesh", 3, false));
+  PtrData data = mesh->createData("MyData", 1);
+  int dataID = data->getID();
+  mesh->createVertex(Eigen::Vector3d::Zero());
+  mesh->allocateDataValues();
+
+  double maxTime = CouplingScheme::UNDEFINED_TIME;
+  int maxTimesteps = 1;
+  double dt = 1.0;
+  std::string first = "First";
+  std::string second = "Second";
+  std::string accessor = second;
+  com::PtrCommunication com(new com::MPIDirectCommunication());
+  m2n::PtrM2N globalCom(new m2n::M2N(com, m2n::DistributedComFactory::SharedPointer()));
+  int maxIterations = 1;
+
+  SerialCouplingScheme scheme(maxTime, maxTimesteps, dt, 16, first, second,
+      accessor, globalCom, constants::FIXED_DT,
+      BaseCouplingScheme::Implicit, maxIterations);
+
+  scheme.addDataToSend(data, mesh, true);
+  scheme.setExtrapolationOrder(3, BaseCouplingScheme::PolynomialExtrapolation);
+  scheme.setupDataMatrices(scheme.getSendData());
+  CouplingData* cplData = scheme.getSendData(dataID);
+  BOOST_CHECK(cplData); // no nullptr
+  BOOST_TEST(cplData->timestepValues.cols() == 4);
+
+  // Data of the timesteps t = 1, 2, ... follows the cubic polynomial f(t) = t^3 - 2t.
+  // Once enough timesteps are available, the cubic extrapolation predicts f(t+1) exactly.
+  auto f = [](double t) { return t * t * t - 2.0 * t; };
+  std::vector<double> expected = {2.0 * f(1.0), 3.0 * f(2.0) - 3.0 * f(1.0)};
+  for (int t = 1; t <= 6; t++) {
+    (*cplData->values)[0] = f(t);
+    scheme.setTimesteps(scheme.getTimesteps() + 1);
+    scheme.extrapolateData(scheme.getSendData());
+    BOOST_TEST(testing::equals(cplData->pastTimestep(0)(0), f(t)));
+    BOOST_TEST(testing::equals(cplData->oldValues(0,0), (*cplData->values)[0]));
+    if (t <= 2) {
+      BOOST_TEST(testing::equals((*cplData->values)[0], expected[t - 1]));
+    } else if (t >= 4) {
+      BOOST_TEST(testing::equals((*cplData->values)[0], f(t + 1)));
+    }
+  }
 }
 
 /// Test that runs on 2 processors.
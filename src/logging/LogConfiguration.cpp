@@ -2,6 +2,9 @@
 
 #include <fstream>
 #include <string>
+#include <regex>
+#include <cstdlib>
+#include <stdexcept>
 
 #include <boost/program_options.hpp>
 
@@ -12,8 +15,10 @@
 #include <boost/log/expressions.hpp>
 #include <boost/log/attributes/mutable_constant.hpp>
 #include <boost/log/utility/setup/console.hpp>
+#include <boost/log/sinks/async_frontend.hpp>
 #include <boost/log/support/date_time.hpp>
 
+#include "LogMacros.hpp"
 #include "versions.hpp"
 #include "utils/assertion.hpp"
 #include "utils/String.hpp"
@@ -21,6 +26,18 @@
 namespace precice {
 namespace logging {
 
+boost::log::trivial::severity_level minimumSeverity = boost::log::trivial::severity_level::trace;
+
+thread_local bool throwOnError = false;
+
+void exitOnError(const std::string &message)
+{
+  if (throwOnError) {
+    throw std::runtime_error(message);
+  }
+  std::exit(-1);
+}
+
 /// A custom formatter that handles the TimeStamp format string
 class timestamp_formatter_factory :
     public boost::log::basic_formatter_factory<char, boost::posix_time::ptime>
@@ -111,6 +128,36 @@ public:
   }
 };
 
+using AsyncSink = boost::log::sinks::asynchronous_sink<StreamBackend>;
+
+/// Asynchronous sinks, which have been added by setupLogging
+std::vector<boost::shared_ptr<AsyncSink>> asyncSinks;
+
+/// Stops the threads of all asynchronous sinks, after writing all pending records.
+void stopAsyncSinks()
+{
+  for (auto & sink : asyncSinks) {
+    boost::log::core::get()->remove_sink(sink);
+    sink->stop();
+    sink->flush();
+  }
+  asyncSinks.clear();
+}
+
+boost::log::trivial::severity_level lowestAcceptedSeverity(std::string const & filter)
+{
+  using boost::log::trivial::severity_level;
+  static const std::regex severityFilter(R"(\s*%Severity%\s*(>=?)\s*(trace|debug|info|warning|error|fatal)\s*)");
+  std::smatch match;
+  if (not std::regex_match(filter, match, severityFilter))
+    return severity_level::trace;
+  severity_level level = severity_level::trace;
+  boost::log::trivial::from_string(match[2].str().c_str(), match[2].length(), level);
+  if (match[1] == ">" and level < severity_level::fatal)
+    level = static_cast<severity_level>(level + 1);
+  return level;
+}
+
 
 /// Reads a log file, returns a logging configuration.
 LoggingConfiguration readLogConfFile(std::string const & filename)
@@ -168,6 +215,9 @@ void BackendConfiguration::setOption(std::string key, std::string value)
   if (key == "enabled") {
     enabled = utils::convertStringToBool(value);
   }
+  if (key == "asynchronous") {
+    asynchronous = utils::convertStringToBool(value);
+  }
 }
 
 
@@ -191,6 +241,7 @@ void setupLogging(LoggingConfiguration configs, bool enabled)
     << bl::expressions::message;
 
   // Reset
+  stopAsyncSinks();
   bl::core::get()->remove_all_sinks();
   bl::core::get()->reset_filter();
 
@@ -199,6 +250,13 @@ void setupLogging(LoggingConfiguration configs, bool enabled)
   // Add the default config
   if (configs.empty())
     configs.emplace_back();
+
+  // Messages below the lowest severity accepted by any sink are skipped before formatting
+  minimumSeverity = bl::trivial::severity_level::fatal;
+  for (const auto& config : configs)
+    minimumSeverity = std::min(minimumSeverity, lowestAcceptedSeverity(config.filter));
+  if (not enabled)
+    minimumSeverity = bl::trivial::severity_level::fatal;
   
   for (const auto& config : configs) {
     boost::shared_ptr<StreamBackend> backend;
@@ -212,11 +270,24 @@ void setupLogging(LoggingConfiguration configs, bool enabled)
     }
     assertion(backend != nullptr, "The logging backend was not initialized properly. Check your log config.");
     backend->auto_flush(true);
-    using sink_t =  boost::log::sinks::synchronous_sink<StreamBackend>;          
-    boost::shared_ptr<sink_t> sink(new sink_t(backend));
-    sink->set_formatter(boost::log::parse_formatter(config.format));
-    sink->set_filter(boost::log::parse_filter(config.filter));
-    boost::log::core::get()->add_sink(sink);
+    if (config.asynchronous) {
+      // Records are written by a separate thread, s.t. slow outputs do not block the caller
+      static bool registered = false;
+      if (not registered)
+        registered = std::atexit(stopAsyncSinks) == 0;
+      boost::shared_ptr<AsyncSink> sink(new AsyncSink(backend));
+      sink->set_formatter(boost::log::parse_formatter(config.format));
+      sink->set_filter(boost::log::parse_filter(config.filter));
+      boost::log::core::get()->add_sink(sink);
+      asyncSinks.push_back(sink);
+    }
+    else {
+      using sink_t =  boost::log::sinks::synchronous_sink<StreamBackend>;          
+      boost::shared_ptr<sink_t> sink(new sink_t(backend));
+      sink->set_formatter(boost::log::parse_formatter(config.format));
+      sink->set_filter(boost::log::parse_filter(config.filter));
+      boost::log::core::get()->add_sink(sink);
+    }
   }
 
   // Printing PRECICE_VERSION as first line of the log
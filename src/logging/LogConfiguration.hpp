@@ -2,6 +2,7 @@
 
 #include <string>
 #include <vector>
+#include <boost/log/trivial.hpp>
 
 namespace precice {
 namespace logging {
@@ -19,6 +20,8 @@ struct BackendConfiguration
   std::string filter = default_filter;
   std::string format = default_formatter;
   bool enabled = true;
+  /// Writes the records from a separate thread, s.t. logging never blocks on slow outputs.
+  bool asynchronous = false;
 
   /// Sets on option, overwrites default values.
   void setOption(std::string key, std::string value);
@@ -27,6 +30,13 @@ struct BackendConfiguration
 /// Holds the configuration of the logging system
 using LoggingConfiguration = std::vector<BackendConfiguration>;
 
+/// Returns the lowest severity, which passes the filter.
+/**
+ * Only filters of the form "%Severity% > level" or "%Severity% >= level" are analyzed,
+ * for all others it is assumed that any severity might pass.
+ */
+boost::log::trivial::severity_level lowestAcceptedSeverity(std::string const & filter);
+
 /// Reads a log configuration file, returns vector of BackEndConfiguration
 LoggingConfiguration readLogConfFile(std::string const & filename);
 
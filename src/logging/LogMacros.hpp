@@ -10,31 +10,74 @@
 
 #include <boost/vmd/is_empty.hpp>
 
+#include <sstream>
 #include <string>
 #include "utils/MasterSlave.hpp"
 #include "utils/prettyprint.hpp" // so that we can put std::vector et. al. on ostream
 
 #include "Tracer.hpp"
 
-
-#define WARN(message) do {                                  \
-    LOG_LOCATION;                                                       \
-    BOOST_LOG_SEV(_log, boost::log::trivial::severity_level::warning)   \
-      << message;                                                       \
+/// Messages with a lower severity are removed at compile time, from 0 (trace) to 4 (error).
+#ifndef PRECICE_MIN_LOG_SEVERITY
+#define PRECICE_MIN_LOG_SEVERITY 0
+#endif
+
+namespace precice {
+namespace logging {
+
+/// Lowest severity accepted by any sink, as determined by setupLogging().
+extern boost::log::trivial::severity_level minimumSeverity;
+
+/**
+ * @brief If set, ERROR() throws a std::runtime_error on the calling thread instead of exiting.
+ *
+ * Worker threads set it, s.t. the program is not exited from a thread other than the main
+ * thread. The main thread has to report the caught errors.
+ */
+extern thread_local bool throwOnError;
+
+/// Exits the program after an error was logged, throws std::runtime_error(message) if throwOnError is set.
+[[noreturn]] void exitOnError(const std::string &message);
+
+/**
+ * @brief Sets the attributes File, Line and Function of the calling thread.
+ *
+ * The attributes are thread-scoped, s.t. threads can log concurrently and every record
+ * carries the location of its own thread.
+ */
+void setLocation(const char *file, int line, const char *function);
+
+}} // namespace precice, logging
+
+/// Checks the compile and runtime minimum severity, before any formatting or LOG_LOCATION takes place.
+#define LOG_ENABLED(severity)                                           \
+  (boost::log::trivial::severity_level::severity >= PRECICE_MIN_LOG_SEVERITY \
+   and boost::log::trivial::severity_level::severity >= precice::logging::minimumSeverity)
+
+#define WARN(message) do {                                              \
+    if (LOG_ENABLED(warning)) {                                         \
+      LOG_LOCATION;                                                     \
+      BOOST_LOG_SEV(_log, boost::log::trivial::severity_level::warning) \
+        << message;                                                     \
+    }                                                                   \
   } while (false)
 
 #define INFO(message)                                                   \
-  if (not precice::utils::MasterSlave::_slaveMode) {                    \
+  if (LOG_ENABLED(info) and not precice::utils::MasterSlave::_slaveMode) { \
     LOG_LOCATION;                                                       \
     BOOST_LOG_SEV(_log, boost::log::trivial::severity_level::info)      \
       << message;                                                       \
   }
 
+// Errors are never filtered. Asynchronous sinks are flushed, s.t. the message is not lost on exit.
 #define ERROR(message) do {                                             \
     LOG_LOCATION;                                                       \
+    std::ostringstream _errorStream_;                                   \
+    _errorStream_ << message;                                           \
     BOOST_LOG_SEV(_log, boost::log::trivial::severity_level::error)     \
-      << message;                                                       \
-    std::exit(-1);                                                        \
+      << _errorStream_.str();                                           \
+    boost::log::core::get()->flush();                                   \
+    precice::logging::exitOnError(_errorStream_.str());                 \
   } while (false)
 
 #define CHECK(check, message)                      \
@@ -50,9 +93,11 @@
 #else // NDEBUG
 
 #define DEBUG(message) do {                                             \
-    LOG_LOCATION;                                                       \
-    BOOST_LOG_SEV(_log, boost::log::trivial::severity_level::debug)     \
-      << message;                                                       \
+    if (LOG_ENABLED(debug)) {                                           \
+      LOG_LOCATION;                                                     \
+      BOOST_LOG_SEV(_log, boost::log::trivial::severity_level::debug)   \
+        << message;                                                     \
+    }                                                                   \
   } while (false)
 
 /// Helper macro, used by TRACE
@@ -61,26 +106,21 @@
 
 // Do not put do {...} while (false) here, it will destroy the _tracer_ right after creation
 #define TRACE(...)                                                      \
-  LOG_LOCATION;                                                         \
   BOOST_LOG_FUNCTION();                                                 \
   precice::logging::Tracer _tracer_(_log, __func__, __FILE__,__LINE__); \
-  BOOST_LOG_SEV(_log, boost::log::trivial::severity_level::trace) << "Entering " << __func__ \
-  BOOST_PP_IF(BOOST_VMD_IS_EMPTY(__VA_ARGS__),                          \
-              BOOST_PP_EMPTY(),                                         \
-              BOOST_PP_SEQ_FOR_EACH_I(LOG_ARGUMENT,, BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__)));
+  if (LOG_ENABLED(trace)) {                                             \
+    LOG_LOCATION;                                                       \
+    BOOST_LOG_SEV(_log, boost::log::trivial::severity_level::trace) << "Entering " << __func__ \
+    BOOST_PP_IF(BOOST_VMD_IS_EMPTY(__VA_ARGS__),                        \
+                BOOST_PP_EMPTY(),                                       \
+                BOOST_PP_SEQ_FOR_EACH_I(LOG_ARGUMENT,, BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__))); \
+  }
 
 
 #endif // ! NDEBUG
 
 
-#define LOG_LOCATION do {                                               \
-    boost::log::attribute_cast<boost::log::attributes::mutable_constant<int>>( \
-      boost::log::core::get()->get_global_attributes()["Line"]).set(__LINE__); \
-    boost::log::attribute_cast<boost::log::attributes::mutable_constant<std::string>>( \
-      boost::log::core::get()->get_global_attributes()["File"]).set(__FILE__); \
-    boost::log::attribute_cast<boost::log::attributes::mutable_constant<std::string>>( \
-      boost::log::core::get()->get_global_attributes()["Function"]).set(__func__); \
-  } while (false)
+#define LOG_LOCATION precice::logging::setLocation(__FILE__, __LINE__, __func__)
 
   
 
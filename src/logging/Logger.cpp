@@ -22,4 +22,31 @@ Logger::Logger(std::string module)
   log::core::get()->add_global_attribute("Function", attrs::mutable_constant<std::string>(""));
 }
 
+namespace {
+
+/// The location attributes of one thread, they take precedence over the global ones of the same name.
+struct LocationAttributes
+{
+  LocationAttributes()
+  {
+    boost::log::core::get()->add_thread_attribute("Line", line);
+    boost::log::core::get()->add_thread_attribute("File", file);
+    boost::log::core::get()->add_thread_attribute("Function", function);
+  }
+
+  boost::log::attributes::mutable_constant<int> line{0};
+  boost::log::attributes::mutable_constant<std::string> file{std::string()};
+  boost::log::attributes::mutable_constant<std::string> function{std::string()};
+};
+
+}
+
+void setLocation(const char *file, int line, const char *function)
+{
+  static thread_local LocationAttributes attributes;
+  attributes.line.set(line);
+  attributes.file.set(file);
+  attributes.function.set(function);
+}
+
 }}
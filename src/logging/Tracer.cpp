@@ -1,5 +1,4 @@
 #include "Tracer.hpp"
-#include <boost/log/attributes/mutable_constant.hpp>
 
 namespace precice {
 namespace logging {
@@ -7,8 +6,8 @@ namespace logging {
 Tracer::Tracer
 (
   Logger &log,
-  std::string function,
-  std::string file,
+  const char* function,
+  const char* file,
   long line
   )
   :
@@ -21,13 +20,10 @@ Tracer::Tracer
 Tracer::~Tracer()
 {
   using namespace boost::log;
+  if (not LOG_ENABLED(trace))
+    return;
 
-  attribute_cast<attributes::mutable_constant<int>>(core::get()->get_global_attributes()["Line"]).set(_line);
-
-  attribute_cast<attributes::mutable_constant<std::string>>(core::get()->get_global_attributes()["File"]).set(_file);
-
-  attribute_cast<attributes::mutable_constant<std::string>>(core::get()->get_global_attributes()["Function"]).set(_function);
-
+  setLocation(_file, _line, _function);
   BOOST_LOG_SEV(_log, trivial::severity_level::trace) << "Leaving " << _function;
 }
 
@@ -8,16 +8,17 @@ class Tracer
 {
 public:  
   
-  Tracer (Logger &log, std::string function, std::string file, long line);
+  /// Stores references only, function and file are expected to be string literals.
+  Tracer (Logger &log, const char* function, const char* file, long line);
   ~Tracer();
 
 private:
 
-  Logger _log;
+  Logger & _log;
 
-  std::string _function;
+  const char* _function;
 
-  std::string _file;
+  const char* _file;
 
   long _line;
 
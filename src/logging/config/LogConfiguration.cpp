@@ -45,6 +45,11 @@ LogConfiguration::LogConfiguration
   attrFilter.setDefaultValue(precice::logging::BackendConfiguration::default_filter);
   tagSink.addAttribute(attrFilter);
   
+  XMLAttribute<bool> attrAsynchronous("asynchronous");
+  attrAsynchronous.setDocumentation("Writes the messages from a separate thread, s.t. slow outputs do not block the simulation");
+  attrAsynchronous.setDefaultValue(false);
+  tagSink.addAttribute(attrAsynchronous);
+
   XMLAttribute<bool> attrEnabled("enabled");
   attrEnabled.setDocumentation("Enables the sink");
   attrEnabled.setDefaultValue(true);
@@ -66,6 +71,7 @@ void LogConfiguration::xmlTagCallback
     config.setOption("output", tag.getStringAttributeValue("output"));
     config.setOption("filter", tag.getStringAttributeValue("filter"));
     config.setOption("format", tag.getStringAttributeValue("format"));
+    config.setOption("asynchronous", tag.getBooleanAttributeValue("asynchronous") ? "true" : "false");
     config.setOption("enabled", "true"); // Not needed, but correct.
     _logconfig.push_back(config);
   }
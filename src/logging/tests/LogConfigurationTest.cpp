@@ -0,0 +1,179 @@
+#include <boost/filesystem.hpp>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "logging/LogConfiguration.hpp"
+#include "logging/Logger.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using boost::log::trivial::severity_level;
+
+BOOST_AUTO_TEST_SUITE(LoggingTests)
+BOOST_AUTO_TEST_SUITE(LogConfigurationTests)
+
+namespace {
+
+logging::Logger _log("logging::tests");
+
+/// Returns a configuration of a file sink, which only writes the messages
+logging::BackendConfiguration fileConfiguration(std::string const & filename, std::string const & filter)
+{
+  logging::BackendConfiguration config;
+  config.type   = "file";
+  config.output = filename;
+  config.filter = filter;
+  config.format = "%Message%";
+  return config;
+}
+
+std::vector<std::string> readLines(std::string const & filename)
+{
+  std::vector<std::string> lines;
+  std::ifstream file(filename);
+  std::string line;
+  while (std::getline(file, line))
+    lines.push_back(line);
+  return lines;
+}
+
+std::string uniqueFilename()
+{
+  namespace fs = boost::filesystem;
+  return (fs::temp_directory_path() / fs::unique_path("precice-log-%%%%-%%%%.log")).string();
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(LowestAcceptedSeverity)
+{
+  BOOST_TEST(logging::lowestAcceptedSeverity("%Severity% > debug") == severity_level::info);
+  BOOST_TEST(logging::lowestAcceptedSeverity("%Severity% >= debug") == severity_level::debug);
+  BOOST_TEST(logging::lowestAcceptedSeverity(" %Severity%>=warning ") == severity_level::warning);
+  BOOST_TEST(logging::lowestAcceptedSeverity("%Severity% > trace") == severity_level::debug);
+  BOOST_TEST(logging::lowestAcceptedSeverity("%Severity% > fatal") == severity_level::fatal);
+
+  // Filters that are not analyzed might accept any severity
+  BOOST_TEST(logging::lowestAcceptedSeverity("") == severity_level::trace);
+  BOOST_TEST(logging::lowestAcceptedSeverity("%Severity% < info") == severity_level::trace);
+  BOOST_TEST(logging::lowestAcceptedSeverity("%Severity% > info and %Rank% = 0") == severity_level::trace);
+  BOOST_TEST(logging::lowestAcceptedSeverity("%Rank% = 0") == severity_level::trace);
+}
+
+BOOST_AUTO_TEST_CASE(SkipFilteredMessages)
+{
+  std::string const filename = uniqueFilename();
+  int evaluations = 0;
+  auto evaluate = [&evaluations]() { return ++evaluations; };
+
+  // The lowest severity of all sinks is accepted
+  logging::setupLogging({fileConfiguration(filename, "%Severity% >= warning"),
+                         fileConfiguration(filename + ".2", "%Severity% > error")});
+  BOOST_TEST(logging::minimumSeverity == severity_level::warning);
+
+  INFO("Skipped " << evaluate());
+  DEBUG("Skipped " << evaluate());
+  BOOST_TEST(evaluations == 0);
+  WARN("Written " << evaluate());
+  BOOST_TEST(evaluations == 1);
+
+  // Nothing is evaluated, if logging is disabled
+  logging::setupLogging({fileConfiguration(filename + ".3", "%Severity% >= trace")}, false);
+  BOOST_TEST(logging::minimumSeverity == severity_level::fatal);
+  WARN("Skipped " << evaluate());
+  BOOST_TEST(evaluations == 1);
+
+  logging::setupLogging();
+  std::vector<std::string> expected{"Written 1"};
+  BOOST_TEST(readLines(filename) == expected, boost::test_tools::per_element());
+  BOOST_TEST(readLines(filename + ".2").empty());
+  BOOST_TEST(readLines(filename + ".3").empty());
+  std::remove(filename.c_str());
+  std::remove((filename + ".2").c_str());
+  std::remove((filename + ".3").c_str());
+}
+
+BOOST_AUTO_TEST_CASE(AsynchronousSink)
+{
+  std::string const filename = uniqueFilename();
+  auto config = fileConfiguration(filename, "%Severity% >= warning");
+  config.asynchronous = true;
+  logging::setupLogging({config});
+  for (int i = 0; i < 1000; i++)
+    WARN("Message " << i);
+
+  // Setting up the logging again stops the asynchronous sinks as on exit, which writes all pending records
+  logging::setupLogging();
+  std::vector<std::string> lines = readLines(filename);
+  BOOST_TEST(lines.size() == 1000);
+  BOOST_TEST(lines.back() == "Message 999");
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentLocations)
+{
+  std::string const filename = uniqueFilename();
+  auto config = fileConfiguration(filename, "%Severity% >= warning");
+  config.format = "%Line% %Message%";
+  logging::setupLogging({config});
+
+  // Every message is its own line number, which has to match the Line attribute of its thread
+  auto logLines = [](int count) {
+    logging::Logger _log("logging::tests");
+    for (int i = 0; i < count; i++) {
+      WARN(__LINE__);
+      WARN(__LINE__);
+    }
+  };
+  std::thread first(logLines, 1000);
+  std::thread second(logLines, 1000);
+  logLines(1000);
+  first.join();
+  second.join();
+
+  logging::setupLogging();
+  std::vector<std::string> lines = readLines(filename);
+  BOOST_TEST(lines.size() == 6000);
+  int mismatches = 0;
+  for (auto & line : lines) {
+    auto separator = line.find(' ');
+    if (line.substr(0, separator) != line.substr(separator + 1))
+      mismatches++;
+  }
+  BOOST_TEST(mismatches == 0);
+  std::remove(filename.c_str());
+}
+
+#ifndef NDEBUG
+
+namespace {
+
+int tracedFunction(int argument)
+{
+  TRACE(argument);
+  return argument;
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(Tracer)
+{
+  std::string const filename = uniqueFilename();
+  logging::setupLogging({fileConfiguration(filename, "%Severity% >= trace")});
+  tracedFunction(42);
+  logging::setupLogging();
+
+  std::vector<std::string> lines = readLines(filename);
+  BOOST_TEST_REQUIRE(lines.size() == 4);
+  BOOST_TEST(lines[1] == "Entering tracedFunction");
+  BOOST_TEST(lines[2] == "  Argument 0: argument == 42");
+  BOOST_TEST(lines[3] == "Leaving tracedFunction");
+  std::remove(filename.c_str());
+}
+
+#endif // not NDEBUG
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,38 @@
+// Removes all messages below warning at compile time in this translation unit
+#undef PRECICE_MIN_LOG_SEVERITY
+#define PRECICE_MIN_LOG_SEVERITY 3
+
+#include <string>
+#include "logging/LogConfiguration.hpp"
+#include "logging/Logger.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+
+BOOST_AUTO_TEST_SUITE(LoggingTests)
+
+namespace {
+logging::Logger _log("logging::tests");
+}
+
+BOOST_AUTO_TEST_CASE(MinLogSeverity)
+{
+  int evaluations = 0;
+  auto evaluate = [&evaluations]() { return ++evaluations; };
+
+  // Accept all severities at runtime, s.t. only the compile time minimum filters
+  logging::BackendConfiguration config;
+  config.filter = "%Severity% >= trace";
+  config.output = "stderr";
+  logging::setupLogging({config});
+
+  DEBUG("Removed " << evaluate());
+  INFO("Removed " << evaluate());
+  BOOST_TEST(evaluations == 0);
+  WARN("Kept " << evaluate());
+  BOOST_TEST(evaluations == 1);
+
+  logging::setupLogging();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -43,13 +43,8 @@ void M2N::acceptMasterConnection(
 
   Event e("m2n.acceptMasterConnection", precice::syncMode);
 
-  if (not utils::MasterSlave::_slaveMode) {
-    assertion(_masterCom.use_count() > 0);
-    _masterCom->acceptConnection(acceptorName, requesterName, utils::MasterSlave::_rank);
-    _isMasterConnected = _masterCom->isConnected();
-  }
-
-  utils::MasterSlave::broadcast(_isMasterConnected);
+  connectMasters(acceptorName, requesterName, false);
+  broadcastMasterConnection();
 }
 
 void M2N::requestMasterConnection(
@@ -60,16 +55,39 @@ void M2N::requestMasterConnection(
 
   Event e("m2n.requestMasterConnection", precice::syncMode);
 
+  connectMasters(acceptorName, requesterName, true);
+  broadcastMasterConnection();
+}
+
+void M2N::connectMasters(
+    const std::string &acceptorName,
+    const std::string &requesterName,
+    bool               isRequesting)
+{
+  TRACE(acceptorName, requesterName, isRequesting);
+
   if (not utils::MasterSlave::_slaveMode) {
     assertion(_masterCom.use_count() > 0);
-
-    _masterCom->requestConnection(acceptorName, requesterName, 0, 1);
+    if (isRequesting) {
+      _masterCom->requestConnection(acceptorName, requesterName, 0, 1);
+    } else {
+      _masterCom->acceptConnection(acceptorName, requesterName, utils::MasterSlave::_rank);
+    }
     _isMasterConnected = _masterCom->isConnected();
   }
+}
 
+void M2N::broadcastMasterConnection()
+{
+  TRACE();
   utils::MasterSlave::broadcast(_isMasterConnected);
 }
 
+bool M2N::isMasterConnectionThreadSafe() const
+{
+  return _masterCom->isConnectionThreadSafe();
+}
+
 void M2N::acceptSlavesConnection(
     const std::string &acceptorName,
     const std::string &requesterName)
@@ -151,7 +169,8 @@ void M2N::send(
         _masterCom->send(ack, 0);
       }
     }
-    Event e("m2n.sendData", precice::syncMode);
+    static const utils::EventID sendDataEvent = utils::EventRegistry::instance().getEventID("m2n.sendData");
+    Event e(sendDataEvent, precice::syncMode);
     _distComs[meshID]->send(itemsToSend, size, valueDimension);
   } else { //coupling mode
     assertion(_isMasterConnected);
@@ -194,7 +213,8 @@ void M2N::receive(double *itemsToReceive,
         _masterCom->receive(ack, 0);
       }
     }
-    Event e("m2n.receiveData", precice::syncMode);
+    static const utils::EventID receiveDataEvent = utils::EventRegistry::instance().getEventID("m2n.receiveData");
+    Event e(receiveDataEvent, precice::syncMode);
     _distComs[meshID]->receive(itemsToReceive, size, valueDimension);
   } else { //coupling mode
     assertion(_isMasterConnected);
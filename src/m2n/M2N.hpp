@@ -46,6 +46,28 @@ public:
   void requestMasterConnection(const std::string &acceptorName,
                                const std::string &requesterName);
 
+  /**
+   * @brief Connects the master to the master of the remote participant, without informing the slaves.
+   *
+   * Sets up the connection of acceptMasterConnection() or requestMasterConnection() on the
+   * master rank only. It may run in a separate thread, if isMasterConnectionThreadSafe(), which
+   * has to set logging::throwOnError and report errors on the main thread.
+   * Has to be followed by broadcastMasterConnection() on all ranks.
+   *
+   * @param[in] acceptorName Name of the accepting participant.
+   * @param[in] requesterName Name of the requesting participant.
+   * @param[in] isRequesting True, if the calling participant is the requester.
+   */
+  void connectMasters(const std::string &acceptorName,
+                      const std::string &requesterName,
+                      bool               isRequesting);
+
+  /// Informs the slaves, whether connectMasters() has connected the masters.
+  void broadcastMasterConnection();
+
+  /// Returns true, if connectMasters() can be called from a separate thread.
+  bool isMasterConnectionThreadSafe() const;
+
   /**
    * @brief Connects to another participant, which has to call requestConnection().
    *
@@ -1,4 +1,5 @@
 #include "PointToPointCommunication.hpp"
+#include <algorithm>
 #include <vector>
 #include <thread>
 #include "com/Communication.hpp"
@@ -46,46 +47,6 @@ void receive(mesh::Mesh::VertexDistribution &m,
   }
 }
 
-void broadcastSend(mesh::Mesh::VertexDistribution const &m,
-                   com::PtrCommunication                  communication = utils::MasterSlave::_communication)
-{
-  communication->broadcast(static_cast<int>(m.size()));
-
-  for (auto const &i : m) {
-    auto const &rank    = i.first;
-    auto const &indices = i.second;
-    communication->broadcast(rank);
-    communication->broadcast(indices);
-  }
-}
-
-void broadcastReceive(mesh::Mesh::VertexDistribution &m,
-                      int                              rankBroadcaster,
-                      com::PtrCommunication            communication = utils::MasterSlave::_communication)
-{
-  m.clear();
-  int size = 0;
-  communication->broadcast(size, rankBroadcaster);
-
-  while (size--) {
-    int rank = -1;
-    communication->broadcast(rank, rankBroadcaster);
-    communication->broadcast(m[rank], rankBroadcaster);
-  }
-}
-
-void broadcast(mesh::Mesh::VertexDistribution &m)
-{
-  if (utils::MasterSlave::_masterMode) {
-    // Broadcast (send) vertex distributions.
-    m2n::broadcastSend(m);
-  } else {
-    assertion(utils::MasterSlave::_slaveMode);
-    // Broadcast (receive) vertex distributions.
-    m2n::broadcastReceive(m, 0);
-  }
-}
-
 void print(std::map<int, std::vector<int>> const &m)
 {
   std::ostringstream oss;
@@ -218,15 +179,12 @@ void printLocalIndexCountStats(std::map<int, std::vector<int>> const &m)
   }
 }
 
-// The approximate complexity of this function is O((number of local data
-// indices for the current rank in `thisVertexDistribution') * (total number of
-// data indices for all ranks in `otherVertexDistribution')).
 std::map<int, std::vector<int>> buildCommunicationMap(
     // `thisVertexDistribution' is input vertex distribution from this participant.
     mesh::Mesh::VertexDistribution const &thisVertexDistribution,
     // `otherVertexDistribution' is input vertex distribution from other participant.
     mesh::Mesh::VertexDistribution const &otherVertexDistribution,
-    int                                    thisRank = utils::MasterSlave::_rank)
+    int                                    thisRank)
 {
   std::map<int, std::vector<int>> communicationMap;
 
@@ -237,20 +195,90 @@ std::map<int, std::vector<int>> buildCommunicationMap(
 
   auto const &indices = iterator->second;
 
-  int index = 0;
+  // Pairs of (global index, local data index), sorted by global index
+  std::vector<std::pair<int, int>> localIndices;
+  localIndices.reserve(indices.size());
+  for (int index = 0; index < static_cast<int>(indices.size()); ++index)
+    localIndices.emplace_back(indices[index], index);
+  std::sort(localIndices.begin(), localIndices.end());
+
+  auto const lessGlobal = [](std::pair<int, int> const &local, int global) {
+    return local.first < global;
+  };
+
+  for (const auto &other : otherVertexDistribution) {
+    std::vector<int> localDataIndices;
+    for (int otherIndex : other.second) {
+      auto local = std::lower_bound(localIndices.begin(), localIndices.end(), otherIndex, lessGlobal);
+      for (; local != localIndices.end() and local->first == otherIndex; ++local)
+        localDataIndices.push_back(local->second);
+    }
+    if (localDataIndices.empty())
+      continue;
+
+    // Keep the order of the local data indices, every index is communicated once per remote rank
+    std::sort(localDataIndices.begin(), localDataIndices.end());
+    localDataIndices.erase(std::unique(localDataIndices.begin(), localDataIndices.end()),
+                           localDataIndices.end());
+    communicationMap[other.first] = std::move(localDataIndices);
+  }
 
-  for (int thisIndex : indices) {
-    for (const auto &other : otherVertexDistribution) {
-      for (const auto &otherIndex : other.second) {
-        if (thisIndex == otherIndex) {
-          communicationMap[other.first].push_back(index);
-          break;
-        }
-      }
+  return communicationMap;
+}
+
+std::map<int, std::map<int, std::vector<int>>> buildCommunicationMaps(
+    mesh::Mesh::VertexDistribution const &thisVertexDistribution,
+    mesh::Mesh::VertexDistribution const &otherVertexDistribution)
+{
+  // Pairs of (global index, remote rank), sorted by global index
+  std::vector<std::pair<int, int>> remoteIndices;
+  size_t remoteSize = 0;
+  for (const auto &other : otherVertexDistribution)
+    remoteSize += other.second.size();
+  remoteIndices.reserve(remoteSize);
+  for (const auto &other : otherVertexDistribution) {
+    for (int otherIndex : other.second)
+      remoteIndices.emplace_back(otherIndex, other.first);
+  }
+  std::sort(remoteIndices.begin(), remoteIndices.end());
+  remoteIndices.erase(std::unique(remoteIndices.begin(), remoteIndices.end()), remoteIndices.end());
+
+  auto const lessGlobal = [](std::pair<int, int> const &remote, int global) {
+    return remote.first < global;
+  };
+
+  std::map<int, std::map<int, std::vector<int>>> communicationMaps;
+  for (const auto &local : thisVertexDistribution) {
+    auto &      communicationMap = communicationMaps[local.first];
+    auto const &indices          = local.second;
+    for (int index = 0; index < static_cast<int>(indices.size()); ++index) {
+      auto remote = std::lower_bound(remoteIndices.begin(), remoteIndices.end(), indices[index], lessGlobal);
+      for (; remote != remoteIndices.end() and remote->first == indices[index]; ++remote)
+        communicationMap[remote->second].push_back(index);
     }
-    ++index;
   }
 
+  return communicationMaps;
+}
+
+/// Computes the communication maps of all ranks on the master and sends every slave its own map.
+std::map<int, std::vector<int>> scatterCommunicationMaps(
+    mesh::Mesh::VertexDistribution const &thisVertexDistribution,
+    mesh::Mesh::VertexDistribution const &otherVertexDistribution)
+{
+  std::map<int, std::vector<int>> communicationMap;
+  if (utils::MasterSlave::_masterMode) {
+    Event e("m2n.buildCommunicationMap");
+    auto communicationMaps = m2n::buildCommunicationMaps(thisVertexDistribution, otherVertexDistribution);
+    e.stop();
+
+    for (int rank = 1; rank < utils::MasterSlave::_size; ++rank)
+      m2n::send(communicationMaps[rank], rank, utils::MasterSlave::_communication);
+    communicationMap = std::move(communicationMaps[0]);
+  } else {
+    assertion(utils::MasterSlave::_slaveMode);
+    m2n::receive(communicationMap, 0, utils::MasterSlave::_communication);
+  }
   return communicationMap;
 }
 
@@ -305,10 +333,6 @@ void PointToPointCommunication::acceptConnection(std::string const &acceptorName
     assertion(utils::MasterSlave::_slaveMode);
   }
 
-  Event e1("m2n.broadcastVertexDistributions", precice::syncMode);
-  m2n::broadcast(vertexDistribution);
-  m2n::broadcast(requesterVertexDistribution);
-  e1.stop();
 
   // Local (for process rank in the current participant) communication map that
   // defines a mapping from a process rank in the remote participant to an array
@@ -327,8 +351,11 @@ void PointToPointCommunication::acceptConnection(std::string const &acceptorName
   //   the remote process with rank 1;
   // - has to communicate (send/receive) data with local indices 0 and 2 with
   //   the remote process with rank 4.
-  Event e2("m2n.buildCommunicationMap", precice::syncMode);
-  std::map<int, std::vector<int>> communicationMap = m2n::buildCommunicationMap(
+  //
+  // Only the master holds the vertex distributions of both participants. It computes
+  // the communication maps of all ranks and sends every slave only its own map.
+  Event e2("m2n.scatterCommunicationMaps", precice::syncMode);
+  std::map<int, std::vector<int>> communicationMap = m2n::scatterCommunicationMaps(
     vertexDistribution, requesterVertexDistribution);
   e2.stop();
 
@@ -436,10 +463,6 @@ void PointToPointCommunication::requestConnection(std::string const &acceptorNam
     assertion(utils::MasterSlave::_slaveMode);
   }
 
-  Event e1("m2n.broadcastVertexDistributions", precice::syncMode);
-  m2n::broadcast(vertexDistribution);
-  m2n::broadcast(acceptorVertexDistribution);
-  e1.stop();
 
   // Local (for process rank in the current participant) communication map that
   // defines a mapping from a process rank in the remote participant to an array
@@ -458,8 +481,11 @@ void PointToPointCommunication::requestConnection(std::string const &acceptorNam
   //   the remote process with rank 1;
   // - has to communicate (send/receive) data with local indices 0 and 2 with
   //   the remote process with rank 4.
-  Event e2("m2n.buildCommunicationMap", precice::syncMode);
-  std::map<int, std::vector<int>> communicationMap = m2n::buildCommunicationMap(
+  //
+  // Only the master holds the vertex distributions of both participants. It computes
+  // the communication maps of all ranks and sends every slave only its own map.
+  Event e2("m2n.scatterCommunicationMaps", precice::syncMode);
+  std::map<int, std::vector<int>> communicationMap = m2n::scatterCommunicationMaps(
     vertexDistribution, acceptorVertexDistribution);
   e2.stop();
 
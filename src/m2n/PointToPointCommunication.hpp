@@ -2,9 +2,13 @@
 
 #include "DistributedCommunication.hpp"
 #include <list>
+#include <map>
+#include <vector>
 #include "com/SharedPointer.hpp"
 #include "logging/Logger.hpp"
+#include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
+#include "utils/MasterSlave.hpp"
 
 namespace precice
 {
@@ -112,5 +116,34 @@ private:
                       std::shared_ptr<std::vector<double>>>> bufferedRequests;
 
 };
+
+/**
+ * @brief Returns the local data indices of thisRank to be communicated to every remote rank.
+ *
+ * A local data index belongs to a remote rank, if its global index is also contained in
+ * the remote rank's indices in otherVertexDistribution. The local indices are sorted by
+ * global index once, s.t. every remote global index is looked up by binary search.
+ * The complexity is O((L + G) log L), with L local and G remote indices in total.
+ *
+ * @param[in] thisVertexDistribution Vertex distribution of this participant
+ * @param[in] otherVertexDistribution Vertex distribution of the remote participant
+ * @param[in] thisRank Rank of this process in thisVertexDistribution
+ */
+std::map<int, std::vector<int>> buildCommunicationMap(
+    mesh::Mesh::VertexDistribution const &thisVertexDistribution,
+    mesh::Mesh::VertexDistribution const &otherVertexDistribution,
+    int                                    thisRank = utils::MasterSlave::_rank);
+
+/**
+ * @brief Returns the communication maps of all ranks in thisVertexDistribution, as buildCommunicationMap() would.
+ *
+ * The remote indices are sorted once together with their ranks, s.t. the complexity is
+ * O((L + G) log G) for all ranks together, with L local and G remote indices in total.
+ * Used by the master, which is the only rank holding both vertex distributions.
+ */
+std::map<int, std::map<int, std::vector<int>>> buildCommunicationMaps(
+    mesh::Mesh::VertexDistribution const &thisVertexDistribution,
+    mesh::Mesh::VertexDistribution const &otherVertexDistribution);
+
 } // namespace m2n
 } // namespace precice
@@ -305,6 +305,49 @@ BOOST_AUTO_TEST_CASE(MPIPortsCommunication,
   }
 }
 
+BOOST_AUTO_TEST_CASE(BuildCommunicationMap)
+{
+  mesh::Mesh::VertexDistribution thisDistribution;
+  thisDistribution[0] = {3, 7, 1, 8};
+  thisDistribution[1] = {5, 2};
+
+  mesh::Mesh::VertexDistribution otherDistribution;
+  otherDistribution[0] = {8, 2, 3};
+  otherDistribution[1] = {4, 5};
+  otherDistribution[2] = {1, 3, 3, 7};
+
+  std::map<int, std::vector<int>> map0 = buildCommunicationMap(thisDistribution, otherDistribution, 0);
+  BOOST_TEST(map0.size() == 2);
+  BOOST_TEST(map0[0] == std::vector<int>({0, 3}));
+  BOOST_TEST(map0[2] == std::vector<int>({0, 1, 2}));
+
+  std::map<int, std::vector<int>> map1 = buildCommunicationMap(thisDistribution, otherDistribution, 1);
+  BOOST_TEST(map1.size() == 2);
+  BOOST_TEST(map1[0] == std::vector<int>({1}));
+  BOOST_TEST(map1[1] == std::vector<int>({0}));
+
+  BOOST_TEST(buildCommunicationMap(thisDistribution, otherDistribution, 2).empty());
+}
+
+BOOST_AUTO_TEST_CASE(BuildCommunicationMaps)
+{
+  mesh::Mesh::VertexDistribution thisDistribution;
+  thisDistribution[0] = {3, 7, 1, 8};
+  thisDistribution[1] = {5, 2};
+  thisDistribution[2] = {9};
+
+  mesh::Mesh::VertexDistribution otherDistribution;
+  otherDistribution[0] = {8, 2, 3};
+  otherDistribution[1] = {4, 5};
+  otherDistribution[2] = {1, 3, 3, 7};
+
+  std::map<int, std::map<int, std::vector<int>>> maps = buildCommunicationMaps(thisDistribution, otherDistribution);
+  BOOST_TEST(maps.size() == 3);
+  for (int rank = 0; rank < 3; ++rank)
+    BOOST_TEST(maps[rank] == buildCommunicationMap(thisDistribution, otherDistribution, rank));
+  BOOST_TEST(maps[2].empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif // not PRECICE_NO_MPI
@@ -87,7 +87,9 @@ void NearestNeighborMapping:: map
 {
   TRACE(inputDataID, outputDataID);
 
-  precice::utils::Event e("map.nn.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  if (not _mapDataEvent.isValid())
+    _mapDataEvent = utils::EventRegistry::instance().getEventID("map.nn.mapData.From" + input()->getName() + "To" + output()->getName());
+  precice::utils::Event e(_mapDataEvent, precice::syncMode);
 
   const Eigen::VectorXd& inputValues = input()->data(inputDataID)->values();
   Eigen::VectorXd& outputValues = output()->data(outputDataID)->values();
@@ -2,6 +2,7 @@
 
 #include "mapping/Mapping.hpp"
 #include "logging/Logger.hpp"
+#include "utils/EventTimings.hpp"
 #include <vector>
 
 namespace precice {
@@ -43,6 +44,9 @@ public:
 private:
   mutable logging::Logger _log{"mapping::NearestNeighborMapping"};
 
+  /// ID of the mapData event
+  utils::EventID _mapDataEvent;
+
   /// Flag to indicate whether computeMapping() has been called.
   bool _hasComputedMapping = false;
 
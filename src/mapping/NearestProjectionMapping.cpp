@@ -134,7 +134,9 @@ void NearestProjectionMapping:: map
 {
   TRACE(inputDataID, outputDataID);
 
-  precice::utils::Event e("map.np.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  if (not _mapDataEvent.isValid())
+    _mapDataEvent = utils::EventRegistry::instance().getEventID("map.np.mapData.From" + input()->getName() + "To" + output()->getName());
+  precice::utils::Event e(_mapDataEvent, precice::syncMode);
 
   mesh::PtrData inData = input()->data(inputDataID);
   mesh::PtrData outData = output()->data(outputDataID);
@@ -4,6 +4,7 @@
 #include <list>
 #include <vector>
 #include "logging/Logger.hpp"
+#include "utils/EventTimings.hpp"
 #include "query/FindClosest.hpp"
 
 namespace precice {
@@ -51,6 +52,9 @@ public:
 private:
   logging::Logger _log{"mapping::NearestProjectionMapping"};
 
+  /// ID of the mapData event
+  utils::EventID _mapDataEvent;
+
   using InterpolationElements = std::vector<query::InterpolationElement>;
   std::vector<InterpolationElements> _weights;
 
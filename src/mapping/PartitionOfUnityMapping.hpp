@@ -0,0 +1,519 @@
+#pragma once
+
+#include "Mapping.hpp"
+#include "impl/BasisFunctions.hpp"
+#include "impl/DistanceMatrix.hpp"
+#include "mesh/RTree.hpp"
+#include "utils/MasterSlave.hpp"
+#include "utils/EventTimings.hpp"
+
+#include <Eigen/Core>
+#include <Eigen/QR>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <set>
+#include <vector>
+
+namespace precice {
+extern bool syncMode;
+
+namespace mapping {
+
+/**
+ * @brief Localized mapping with radial basis functions, blended by a partition of unity.
+ *
+ * The domain is covered by overlapping spherical clusters, whose centers lie on a regular grid.
+ * The radius of the clusters is chosen such that a cluster contains about verticesPerCluster
+ * input vertices. In every cluster, a small dense RBF interpolant with linear polynomial is
+ * constructed, as in RadialBasisFctMapping. The results of all clusters containing an output vertex
+ * are blended with Wendland C2 weights, normalized to sum up to one (Shepard's method).
+ *
+ * As every cluster reproduces linear functions and the weights sum up to one, the consistent mapping
+ * reproduces linear functions exactly and the conservative mapping conserves the sum of the data.
+ *
+ * The cluster systems are independent and are set up in parallel threads, if preCICE is built with OpenMP.
+ * Like RadialBasisFctMapping, this mapping is only available for serial participants.
+ */
+template<typename RADIAL_BASIS_FUNCTION_T>
+class PartitionOfUnityMapping : public Mapping
+{
+public:
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] constraint Specifies mapping to be consistent or conservative.
+   * @param[in] dimensions Dimensionality of the meshes
+   * @param[in] function Radial basis function used in every cluster.
+   * @param[in] xDead, yDead, zDead Deactivates mapping along an axis
+   * @param[in] verticesPerCluster Targeted number of input vertices per cluster
+   * @param[in] relativeOverlap Overlap of neighboring clusters, relative to the cluster radius, in [0,1)
+   */
+  PartitionOfUnityMapping (
+    Constraint              constraint,
+    int                     dimensions,
+    RADIAL_BASIS_FUNCTION_T function,
+    bool                    xDead,
+    bool                    yDead,
+    bool                    zDead,
+    int                     verticesPerCluster = 50,
+    double                  relativeOverlap = 0.3);
+
+  /// Computes the mapping coefficients from the in- and output mesh.
+  virtual void computeMapping() override;
+
+  /// Returns true, if computeMapping() has been called.
+  virtual bool hasComputedMapping() const override;
+
+  /// Removes a computed mapping.
+  virtual void clear() override;
+
+  /// Maps input data to output data from input mesh to output mesh.
+  virtual void map(int inputDataID, int outputDataID ) override;
+
+  virtual void tagMeshFirstRound() override;
+
+  virtual void tagMeshSecondRound() override;
+
+  /// Returns the number of clusters of the computed mapping.
+  size_t getNumberOfClusters() const
+  {
+    return _clusters.size();
+  }
+
+private:
+
+  /// Local RBF interpolation problem
+  struct Cluster
+  {
+    Eigen::VectorXd center;
+
+    /// Positions of the covered vertices in the input mesh (output mesh for conservative mappings)
+    std::vector<int> inIndices;
+
+    /// Positions of the covered vertices in the output mesh (input mesh for conservative mappings)
+    std::vector<int> outIndices;
+
+    /// Partition of unity weights of the outIndices vertices, normalized after all clusters are known
+    std::vector<double> weights;
+
+    /// Maps the input to the weighted output values of the cluster, size outIndices x inIndices
+    Eigen::MatrixXd matrix;
+  };
+
+  precice::logging::Logger _log{"mapping::PartitionOfUnityMapping"};
+
+  /// ID of the mapData event
+  utils::EventID _mapDataEvent;
+
+  bool _hasComputedMapping = false;
+
+  /// Radial basis function type used in interpolation.
+  RADIAL_BASIS_FUNCTION_T _basisFunction;
+
+  const int _verticesPerCluster;
+
+  const double _relativeOverlap;
+
+  std::vector<Cluster> _clusters;
+
+  /// true if the mapping along some axis should be ignored
+  std::vector<bool> _deadAxis;
+
+  /// Returns the distance of a and b, ignoring dead axes.
+  double reducedDistance(const Eigen::VectorXd& a, const Eigen::VectorXd& b) const;
+
+  /// Returns the cluster radius, s.t. a cluster holds about _verticesPerCluster vertices of mesh.
+  double estimateClusterRadius(const mesh::PtrMesh& mesh) const;
+
+  /// Returns the indices of all vertices of mesh within radius around center, ignoring dead axes.
+  std::vector<int> verticesInRadius(const mesh::PtrMesh& mesh, const Eigen::VectorXd& center, double radius) const;
+
+  /// Computes the mapping matrix of a cluster. Returns false, if the interpolation matrix is singular.
+  bool computeClusterMatrix(const mesh::PtrMesh& inMesh, const mesh::PtrMesh& outMesh, Cluster& cluster) const;
+
+  void setDeadAxis(bool xDead, bool yDead, bool zDead)
+  {
+    _deadAxis.resize(getDimensions());
+    if (getDimensions() == 2) {
+      _deadAxis[0] = xDead;
+      _deadAxis[1] = yDead;
+      CHECK(not (xDead && yDead), "You cannot choose all axis to be dead for a RBF mapping");
+      if (zDead)
+        WARN("Setting the z-axis to dead on a 2 dimensional problem has not effect and will be ignored.");
+    }
+    else if (getDimensions() == 3) {
+      _deadAxis[0] = xDead;
+      _deadAxis[1] = yDead;
+      _deadAxis[2] = zDead;
+      CHECK(not (xDead && yDead && zDead), "You cannot choose all axis to be dead for a RBF mapping");
+    }
+    else {
+      assertion(false);
+    }
+  }
+
+};
+
+// --------------------------------------------------- HEADER IMPLEMENTATIONS
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>:: PartitionOfUnityMapping
+(
+  Constraint              constraint,
+  int                     dimensions,
+  RADIAL_BASIS_FUNCTION_T function,
+  bool                    xDead,
+  bool                    yDead,
+  bool                    zDead,
+  int                     verticesPerCluster,
+  double                  relativeOverlap)
+  :
+  Mapping ( constraint, dimensions ),
+  _basisFunction ( function ),
+  _verticesPerCluster ( verticesPerCluster ),
+  _relativeOverlap ( relativeOverlap )
+{
+  CHECK(_verticesPerCluster > dimensions + 1,
+        "The number of vertices per cluster has to be larger than " << dimensions + 1 << "!");
+  CHECK(_relativeOverlap >= 0.0 && _relativeOverlap < 1.0,
+        "The relative overlap of clusters has to be in [0, 1)!");
+  setInputRequirement(Mapping::MeshRequirement::VERTEX);
+  setOutputRequirement(Mapping::MeshRequirement::VERTEX);
+  setDeadAxis(xDead, yDead, zDead);
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>:: computeMapping()
+{
+  TRACE();
+
+  precice::utils::Event e("map.pum.computeMapping.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+
+  CHECK(not utils::MasterSlave::_slaveMode && not utils::MasterSlave::_masterMode,
+        "RBF mapping is not supported for a participant in master mode, use petrbf instead");
+
+  assertion(input()->getDimensions() == output()->getDimensions(),
+             input()->getDimensions(), output()->getDimensions());
+  assertion(getDimensions() == output()->getDimensions(),
+             getDimensions(), output()->getDimensions());
+  int const dimensions = getDimensions();
+  mesh::PtrMesh inMesh;
+  mesh::PtrMesh outMesh;
+  if (getConstraint() == CONSERVATIVE){
+    inMesh = output();
+    outMesh = input();
+  }
+  else {
+    inMesh = input();
+    outMesh = output();
+  }
+  int deadDimensions = 0;
+  for (int d = 0; d < dimensions; d++) {
+    if (_deadAxis[d]) deadDimensions +=1;
+  }
+  int polyparams = 1 + dimensions - deadDimensions;
+  assertion(inMesh->vertices().size() >= (size_t) 1 + polyparams, inMesh->vertices().size());
+
+  _clusters.clear();
+
+  // Every point of a grid cell has a distance of at most radius * (1 - overlap) to the cell center
+  double const radius = estimateClusterRadius(inMesh);
+  double const spacing = 2.0 * radius * (1.0 - _relativeOverlap) / std::sqrt(dimensions - deadDimensions);
+  DEBUG("Cluster radius = " << radius << ", spacing of cluster centers = " << spacing);
+
+  Eigen::VectorXd origin = Eigen::VectorXd::Constant(dimensions, std::numeric_limits<double>::max());
+  for (const mesh::PtrMesh& mesh : {inMesh, outMesh}) {
+    for (const mesh::Vertex& vertex : mesh->vertices())
+      origin = origin.cwiseMin(vertex.getCoords());
+  }
+
+  // Clusters are centered in all grid cells containing a vertex
+  std::set<std::array<long, 3>> cells;
+  for (const mesh::PtrMesh& mesh : {inMesh, outMesh}) {
+    for (const mesh::Vertex& vertex : mesh->vertices()) {
+      std::array<long, 3> cell{{0, 0, 0}};
+      for (int d = 0; d < dimensions; d++) {
+        if (not _deadAxis[d])
+          cell[d] = (long) std::floor((vertex.getCoords()[d] - origin[d]) / spacing);
+      }
+      cells.insert(cell);
+    }
+  }
+
+  for (const std::array<long, 3>& cell : cells) {
+    Cluster cluster;
+    cluster.center = Eigen::VectorXd::Zero(dimensions);
+    for (int d = 0; d < dimensions; d++) {
+      if (not _deadAxis[d])
+        cluster.center[d] = origin[d] + (cell[d] + 0.5) * spacing;
+    }
+    cluster.inIndices = verticesInRadius(inMesh, cluster.center, radius);
+    if (cluster.inIndices.size() < (size_t) 1 + polyparams)
+      continue; // too few vertices for an interpolant, neighboring clusters cover these vertices
+    _clusters.push_back(std::move(cluster));
+  }
+  CHECK(not _clusters.empty(), "Partition of unity mapping could not create a cluster with enough vertices. "
+        << "Please decrease the number of vertices per cluster.");
+  DEBUG("Number of clusters = " << _clusters.size());
+
+  // Compute the partition of unity weights of all output vertices
+  std::vector<double> weightSums(outMesh->vertices().size(), 0.0);
+  for (Cluster& cluster : _clusters) {
+    cluster.outIndices = verticesInRadius(outMesh, cluster.center, radius);
+    for (int outIndex : cluster.outIndices) {
+      // Wendland C2 function of the relative distance to the cluster center
+      double const t = reducedDistance(outMesh->vertices()[outIndex].getCoords(), cluster.center) / radius;
+      double const weight = std::pow(1.0 - t, 4) * (4.0 * t + 1.0);
+      cluster.weights.push_back(weight);
+      weightSums[outIndex] += weight;
+    }
+  }
+
+  // Output vertices, which are not covered by any cluster, are extrapolated by the closest cluster
+  for (size_t outIndex = 0; outIndex < weightSums.size(); outIndex++) {
+    if (weightSums[outIndex] > 0.0)
+      continue;
+    const Eigen::VectorXd& coords = outMesh->vertices()[outIndex].getCoords();
+    auto closest = std::min_element(_clusters.begin(), _clusters.end(), [&](const Cluster& a, const Cluster& b){
+        return reducedDistance(a.center, coords) < reducedDistance(b.center, coords);});
+    closest->outIndices.push_back(outIndex);
+    closest->weights.push_back(1.0);
+    weightSums[outIndex] = 1.0;
+  }
+
+  for (Cluster& cluster : _clusters) {
+    for (size_t i = 0; i < cluster.outIndices.size(); i++)
+      cluster.weights[i] /= weightSums[cluster.outIndices[i]];
+  }
+
+  // The cluster systems are independent of each other
+  bool singular = false;
+  #ifdef _OPENMP
+  #pragma omp parallel for schedule(dynamic) reduction(||:singular)
+  #endif
+  for (long c = 0; c < (long) _clusters.size(); c++) {
+    if (not _clusters[c].outIndices.empty())
+      singular = not computeClusterMatrix(inMesh, outMesh, _clusters[c]) || singular;
+  }
+  if (singular)
+    ERROR("Interpolation matrix C of a partition of unity cluster is not invertible.");
+
+  // Clusters without output vertices are not needed for mapping
+  _clusters.erase(std::remove_if(_clusters.begin(), _clusters.end(), [](const Cluster& cluster){
+        return cluster.outIndices.empty();}), _clusters.end());
+
+  _hasComputedMapping = true;
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+bool PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>:: hasComputedMapping() const
+{
+  return _hasComputedMapping;
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>:: clear()
+{
+  TRACE();
+  _clusters.clear();
+  _hasComputedMapping = false;
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>:: map
+(
+  int inputDataID,
+  int outputDataID )
+{
+  TRACE(inputDataID, outputDataID);
+
+  if (not _mapDataEvent.isValid())
+    _mapDataEvent = utils::EventRegistry::instance().getEventID("map.pum.mapData.From" + input()->getName() + "To" + output()->getName());
+  precice::utils::Event e(_mapDataEvent, precice::syncMode);
+
+  assertion(_hasComputedMapping);
+  assertion(input()->getDimensions() == output()->getDimensions(),
+             input()->getDimensions(), output()->getDimensions());
+  assertion(getDimensions() == output()->getDimensions(),
+             getDimensions(), output()->getDimensions());
+
+  const Eigen::VectorXd& inValues = input()->data(inputDataID)->values();
+  Eigen::VectorXd& outValues = output()->data(outputDataID)->values();
+  int valueDim = input()->data(inputDataID)->getDimensions();
+  assertion(valueDim == output()->data(outputDataID)->getDimensions(),
+             valueDim, output()->data(outputDataID)->getDimensions());
+
+  outValues.setZero();
+  bool const conservative = getConstraint() == CONSERVATIVE;
+  Eigen::VectorXd in, out;
+
+  for (const Cluster& cluster : _clusters) {
+    // For conservative mappings, the cluster matrix is applied transposed
+    const std::vector<int>& inIndices = conservative ? cluster.outIndices : cluster.inIndices;
+    const std::vector<int>& outIndices = conservative ? cluster.inIndices : cluster.outIndices;
+    in.resize(inIndices.size());
+
+    for (int dim = 0; dim < valueDim; dim++) {
+      for (size_t i = 0; i < inIndices.size(); i++) {
+        in[i] = inValues(inIndices[i]*valueDim + dim);
+      }
+
+      if (conservative)
+        out.noalias() = cluster.matrix.transpose() * in;
+      else
+        out.noalias() = cluster.matrix * in;
+
+      for (size_t i = 0; i < outIndices.size(); i++) {
+        outValues(outIndices[i]*valueDim + dim) += out[i];
+      }
+    }
+  }
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+double PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::reducedDistance
+(
+  const Eigen::VectorXd& a,
+  const Eigen::VectorXd& b) const
+{
+  double squaredNorm = 0.0;
+  for (int d = 0; d < getDimensions(); d++) {
+    if (not _deadAxis[d])
+      squaredNorm += (a[d] - b[d]) * (a[d] - b[d]);
+  }
+  return std::sqrt(squaredNorm);
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+double PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::estimateClusterRadius
+(
+  const mesh::PtrMesh& mesh) const
+{
+  namespace bg = boost::geometry;
+  auto tree = mesh::rtree::getVertexRTree(mesh);
+  size_t const size = mesh->vertices().size();
+  size_t const neighbors = std::min<size_t>(_verticesPerCluster, size);
+
+  // Take the largest distance to the k-th nearest neighbor of some sample vertices
+  size_t const samples = std::min<size_t>(10, size);
+  double radius = 0.0;
+  for (size_t s = 0; s < samples; s++) {
+    const mesh::Vertex& sample = mesh->vertices()[s * size / samples];
+    std::vector<size_t> results;
+    tree->query(bg::index::nearest(sample.getCoords(), neighbors), std::back_inserter(results));
+    for (size_t i : results)
+      radius = std::max(radius, reducedDistance(sample.getCoords(), mesh->vertices()[i].getCoords()));
+  }
+  assertion(radius > 0.0);
+  return radius;
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+std::vector<int> PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::verticesInRadius
+(
+  const mesh::PtrMesh&   mesh,
+  const Eigen::VectorXd& center,
+  double                 radius) const
+{
+  namespace bg = boost::geometry;
+
+  // Along dead axes, the distance is ignored, i.e., the search box is unbounded
+  mesh::Box3d searchBox;
+  for (int d = 0; d < 3; d++) {
+    double const lower = (d < getDimensions() && not _deadAxis[d]) ? center[d] - radius : std::numeric_limits<double>::lowest();
+    double const upper = (d < getDimensions() && not _deadAxis[d]) ? center[d] + radius : std::numeric_limits<double>::max();
+    if (d == 0) {
+      bg::set<bg::min_corner, 0>(searchBox, lower);
+      bg::set<bg::max_corner, 0>(searchBox, upper);
+    }
+    else if (d == 1) {
+      bg::set<bg::min_corner, 1>(searchBox, lower);
+      bg::set<bg::max_corner, 1>(searchBox, upper);
+    }
+    else {
+      bg::set<bg::min_corner, 2>(searchBox, lower);
+      bg::set<bg::max_corner, 2>(searchBox, upper);
+    }
+  }
+
+  std::vector<size_t> candidates;
+  mesh::rtree::getVertexRTree(mesh)->query(bg::index::within(searchBox), std::back_inserter(candidates));
+
+  std::vector<int> results;
+  for (size_t i : candidates) {
+    if (reducedDistance(mesh->vertices()[i].getCoords(), center) < radius)
+      results.push_back(i);
+  }
+  std::sort(results.begin(), results.end());
+  return results;
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+bool PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::computeClusterMatrix
+(
+  const mesh::PtrMesh& inMesh,
+  const mesh::PtrMesh& outMesh,
+  Cluster&             cluster) const
+{
+  int const inputSize = cluster.inIndices.size();
+  int const outputSize = cluster.outIndices.size();
+
+  Eigen::MatrixXd inCoords = impl::activeCoordinates(*inMesh, _deadAxis, cluster.inIndices);
+  Eigen::MatrixXd outCoords = impl::activeCoordinates(*outMesh, _deadAxis, cluster.outIndices);
+
+  // The basis function blocks do not depend on the polynomial
+  Eigen::MatrixXd matrixPhi(inputSize, inputSize);
+  impl::computeDistances(inCoords, inCoords, matrixPhi);
+  impl::evaluateInPlace(_basisFunction, matrixPhi);
+  Eigen::MatrixXd matrixB(outputSize, inputSize);
+  impl::computeDistances(outCoords, inCoords, matrixB);
+  impl::evaluateInPlace(_basisFunction, matrixB);
+
+  // A cluster on a flat part of a surface cannot determine a linear polynomial,
+  // the polynomial is reduced to a constant in this case.
+  for (int polyparams : {1 + (int) inCoords.cols(), 1}) {
+    int const n = inputSize + polyparams;
+    Eigen::MatrixXd matrixC = Eigen::MatrixXd::Zero(n, n);
+    Eigen::MatrixXd matrixA(outputSize, n);
+
+    matrixC.topLeftCorner(inputSize, inputSize) = matrixPhi;
+    matrixC.block(0, inputSize, inputSize, 1).setOnes();
+    matrixC.block(0, inputSize + 1, inputSize, polyparams - 1) = inCoords.leftCols(polyparams - 1);
+    matrixC.block(inputSize, 0, polyparams, inputSize) = matrixC.block(0, inputSize, inputSize, polyparams).transpose();
+
+    matrixA.leftCols(inputSize) = matrixB;
+    matrixA.col(inputSize).setOnes();
+    matrixA.rightCols(polyparams - 1) = outCoords.leftCols(polyparams - 1);
+
+    Eigen::ColPivHouseholderQR<Eigen::MatrixXd> qr = matrixC.colPivHouseholderQr();
+    if (not qr.isInvertible())
+      continue;
+
+    // The polynomial part of the right-hand side is always zero, thus only the first inputSize columns of C^-1 are needed
+    Eigen::MatrixXd rhs = Eigen::MatrixXd::Identity(n, inputSize);
+    cluster.matrix = matrixA * qr.solve(rhs);
+    for (int i = 0; i < outputSize; i++)
+      cluster.matrix.row(i) *= cluster.weights[i];
+    return true;
+  }
+  return false;
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshFirstRound()
+{
+  CHECK(not utils::MasterSlave::_slaveMode && not utils::MasterSlave::_masterMode,
+        "RBF mapping is not supported for a participant in master mode, use petrbf instead");
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshSecondRound()
+{
+  CHECK(not utils::MasterSlave::_slaveMode && not utils::MasterSlave::_masterMode,
+        "RBF mapping is not supported for a participant in master mode, use petrbf instead");
+}
+
+}} // namespace precice, mapping
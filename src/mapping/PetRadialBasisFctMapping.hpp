@@ -3,8 +3,11 @@
 
 #include "mapping/Mapping.hpp"
 
+#include <deque>
+#include <limits>
 #include <map>
 #include <numeric>
+#include <vector>
 
 #include "versions.hpp"
 #include "mesh/RTree.hpp"
@@ -96,10 +99,16 @@ public:
 private:
 
   /// Stores col -> value for each row. Used to return the already computed values from the preconditioning
-  using VertexData = std::vector<std::vector<std::pair<int, double>>>;
+  using VertexData = std::vector<std::vector<std::pair<PetscInt, double>>>;
   
   mutable logging::Logger _log{"mapping::PetRadialBasisFctMapping"};
 
+  /// ID of the mapData event
+  utils::EventID _mapDataEvent;
+
+  /// ID of the solve event
+  utils::EventID _solveEvent;
+
   bool _hasComputedMapping = false;
 
   /// Radial basis function type used in interpolation.
@@ -162,23 +171,23 @@ private:
 
   void estimatePreallocationMatrixA(int rows, int cols, mesh::PtrMesh mesh);
 
-  /// Preallocate matrix C by only deriving the preallocation pattern
+  /// Preallocate matrix C using a boost::geometry spatial tree for neighbor search
   /*
-   * This actually involves computing the coefficients. They are not saved and thus need to be computed
-   * twice. Therefore, this is not really efficient.
+   * If saveVertexData is set, the PETSc column and the distance of all entries are returned,
+   * s.t. the neighbors do not need to be searched again when filling the matrix.
    */
-  void computePreallocationMatrixC(const mesh::PtrMesh inMesh);
-
-  void computePreallocationMatrixA(const mesh::PtrMesh inMesh, const mesh::PtrMesh outMesh);
+  VertexData computePreallocationMatrixC(const mesh::PtrMesh inMesh, std::vector<PetscInt> const & mappedColumns,
+                                         bool saveVertexData);
 
-  VertexData savedPreallocationMatrixC(const mesh::PtrMesh inMesh);
+  /// Preallocate matrix A using a boost::geometry spatial tree for neighbor search, see computePreallocationMatrixC
+  VertexData computePreallocationMatrixA(const mesh::PtrMesh inMesh, const mesh::PtrMesh outMesh,
+                                         std::vector<PetscInt> const & mappedColumns, bool saveVertexData);
 
-  VertexData savedPreallocationMatrixA(const mesh::PtrMesh inMesh, const mesh::PtrMesh outMesh);
+  /// Returns index and distance of all vertices of mesh within the support radius of vertex, ignoring dead axes
+  std::vector<std::pair<size_t, double>> neighborsInSupport(const mesh::PtrMesh mesh, const mesh::Vertex & vertex) const;
 
-  /// Preallocate matrix C and saves the coefficients using a boost::geometry spatial tree for neighbor search
-  VertexData bgPreallocationMatrixC(const mesh::PtrMesh inMesh);
-
-  VertexData bgPreallocationMatrixA(const mesh::PtrMesh inMesh, const mesh::PtrMesh outMesh);
+  /// Returns the PETSc column of every vertex of inMesh, translated by a single call to the AO mapping
+  std::vector<PetscInt> mapColumns(const mesh::PtrMesh inMesh) const;
 
 };
 
@@ -324,26 +333,22 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   ierr = AOCreateMapping(utils::Parallel::getGlobalCommunicator(),
                          myIndizes.size(), myIndizes.data(), nullptr, &_AOmapping); CHKERRV(ierr);
 
-  Eigen::VectorXd distance(dimensions);
+  // The columns of all input vertices are translated to the PETSc ordering at once
+  std::vector<PetscInt> const mappedColumns = mapColumns(inMesh);
 
   // We do preallocating of the matrices C and A. That means we traverse the input data once, just
   // to know where we have entries in the sparse matrix. This information petsc can use to
   // preallocate the matrix. In the second phase we actually fill the matrix.
+  bool const saveVertexData = _preallocation == Preallocation::SAVE or _preallocation == Preallocation::TREE;
 
   // Stores col -> value for each row;
   VertexData vertexData;
 
-  if (_preallocation == Preallocation::SAVE) {
-    vertexData = savedPreallocationMatrixC(inMesh);
-  }
-  if (_preallocation == Preallocation::COMPUTE) {
-    computePreallocationMatrixC(inMesh);
-  }
   if (_preallocation == Preallocation::ESTIMATE) {
     estimatePreallocationMatrixC(n, n, inMesh);
   }
-  if (_preallocation == Preallocation::TREE) {
-    vertexData = bgPreallocationMatrixC(inMesh);
+  else if (_preallocation != Preallocation::OFF) {
+    vertexData = computePreallocationMatrixC(inMesh, mappedColumns, saveVertexData);
   }
 
   // -- BEGIN FILL LOOP FOR MATRIX C --
@@ -351,68 +356,58 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   precice::utils::Event eFillC("map.pet.fillC.From" + input()->getName() + "To"+ output()->getName(), precice::syncMode);
 
   // We collect entries for each row and set them blockwise using MatSetValues.
+  std::vector<PetscInt> colIdx;     // holds the columns indices of the entries
+  std::vector<PetscScalar> rowVals; // holds the values of the entries
   int preallocRow = 0;
   PetscInt row = _matrixC.ownerRange().first + localPolyparams;
   for (const mesh::Vertex& inVertex : inMesh->vertices()) {
     if (not inVertex.isOwner())
       continue;
 
-    PetscInt const idxSize = std::max(_matrixC.getSize().second, _matrixQ.getSize().second);
-    PetscInt colNum = 0;  // holds the number of columns
-    PetscInt colIdx[idxSize];     // holds the columns indices of the entries
-    PetscScalar rowVals[idxSize]; // holds the values of the entries
-    
     // -- SETS THE POLYNOMIAL PART OF THE MATRIX --
     if (_polynomial == Polynomial::ON or _polynomial == Polynomial::SEPARATE) {
-      colIdx[colNum] = colNum;
-      rowVals[colNum++] = 1;
+      colIdx.clear();
+      rowVals.clear();
+      colIdx.push_back(0);
+      rowVals.push_back(1);
 
       for (int dim = 0; dim < dimensions; dim++) {
         if (not _deadAxis[dim]) {
-          colIdx[colNum] = colNum;
-          rowVals[colNum++] = inVertex.getCoords()[dim];
+          colIdx.push_back(colIdx.size());
+          rowVals.push_back(inVertex.getCoords()[dim]);
         }
       }
 
       // cols are always the first ones for the polynomial, no need to translate
       if (_polynomial == Polynomial::ON) {
-        ierr = MatSetValues(_matrixC, colNum, colIdx, 1, &row, rowVals, INSERT_VALUES); CHKERRV(ierr);
+        ierr = MatSetValues(_matrixC, colIdx.size(), colIdx.data(), 1, &row, rowVals.data(), INSERT_VALUES); CHKERRV(ierr);
       }
       else if (_polynomial == Polynomial::SEPARATE) {
-        ierr = MatSetValues(_matrixQ, 1, &row, colNum, colIdx, rowVals, INSERT_VALUES); CHKERRV(ierr);
+        ierr = MatSetValues(_matrixQ, 1, &row, colIdx.size(), colIdx.data(), rowVals.data(), INSERT_VALUES); CHKERRV(ierr);
       }
-      colNum = 0;
     }
 
     // -- SETS THE COEFFICIENTS --
-    if (_preallocation == Preallocation::SAVE or _preallocation == Preallocation::TREE) {
+    colIdx.clear();
+    rowVals.clear();
+    if (saveVertexData) {
       auto const & rowVertices = vertexData[preallocRow];
       for (const auto & vertex : rowVertices) {
-        rowVals[colNum] = _basisFunction.evaluate(vertex.second);
-        colIdx[colNum++] = vertex.first;
+        rowVals.push_back(_basisFunction.evaluate(vertex.second));
+        colIdx.push_back(vertex.first);
       }
       ++preallocRow;
     }
     else {
-      for (const mesh::Vertex& vj : inMesh->vertices()) {
-        int const col = vj.getGlobalIndex() + polyparams;
+      for (auto const & neighbor : neighborsInSupport(inMesh, inVertex)) {
+        PetscInt const col = mappedColumns[neighbor.first];
         if (row > col)
           continue; // matrix is symmetric
-        distance = inVertex.getCoords() - vj.getCoords();
-        for (int d = 0; d < dimensions; d++) {
-          if (_deadAxis[d]) {
-            distance[d] = 0;
-          }
-        }
-        double const norm = distance.norm();
-        if (_basisFunction.getSupportRadius() > norm) {
-          rowVals[colNum] = _basisFunction.evaluate(norm);
-          colIdx[colNum++] = col; // column of entry is the globalIndex
-        }
+        rowVals.push_back(_basisFunction.evaluate(neighbor.second));
+        colIdx.push_back(col);
       }
     }
-    ierr = AOApplicationToPetsc(_AOmapping, colNum, colIdx); CHKERRV(ierr);
-    ierr = MatSetValues(_matrixC, 1, &row, colNum, colIdx, rowVals, INSERT_VALUES); CHKERRV(ierr);
+    ierr = MatSetValues(_matrixC, 1, &row, colIdx.size(), colIdx.data(), rowVals.data(), INSERT_VALUES); CHKERRV(ierr);
     ++row;
   }
   DEBUG("Finished filling Matrix C");
@@ -428,17 +423,11 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   ierr = MatAssemblyBegin(_matrixC, MAT_FINAL_ASSEMBLY); CHKERRV(ierr);
   ierr = MatAssemblyBegin(_matrixQ, MAT_FINAL_ASSEMBLY); CHKERRV(ierr);
 
-  if (_preallocation == Preallocation::SAVE) {
-    vertexData = savedPreallocationMatrixA(inMesh, outMesh);
-  }
-  if (_preallocation == Preallocation::COMPUTE) {
-    computePreallocationMatrixA(inMesh, outMesh);
-  }
   if (_preallocation == Preallocation::ESTIMATE) {
     estimatePreallocationMatrixA(outputSize, n, inMesh);
   }
-  if (_preallocation == Preallocation::TREE) {
-    vertexData = bgPreallocationMatrixA(inMesh, outMesh);
+  else if (_preallocation != Preallocation::OFF) {
+    vertexData = computePreallocationMatrixA(inMesh, outMesh, mappedColumns, saveVertexData);
   }
 
   // -- BEGIN FILL LOOP FOR MATRIX A --
@@ -450,51 +439,38 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
 
     // -- SET THE POLYNOMIAL PART OF THE MATRIX --
     if (_polynomial == Polynomial::ON or _polynomial == Polynomial::SEPARATE) {
-        petsc::Matrix * m = _polynomial == Polynomial::ON ? &_matrixA : &_matrixV;
-        PetscInt colNum = 0;
-        PetscInt colIdx[m->getSize().second];     // holds the columns indices of the entries
-        PetscScalar rowVals[m->getSize().second]; // holds the values of the entries
-
-        colIdx[colNum] = colNum;
-        rowVals[colNum++] = 1;
-
-        for (int dim = 0; dim < dimensions; dim++) {
-          if (not _deadAxis[dim]) {
-            colIdx[colNum] = colNum;
-            rowVals[colNum++] = oVertex.getCoords()[dim];
-          }
+      petsc::Matrix * m = _polynomial == Polynomial::ON ? &_matrixA : &_matrixV;
+      colIdx.clear();
+      rowVals.clear();
+      colIdx.push_back(0);
+      rowVals.push_back(1);
+
+      for (int dim = 0; dim < dimensions; dim++) {
+        if (not _deadAxis[dim]) {
+          colIdx.push_back(colIdx.size());
+          rowVals.push_back(oVertex.getCoords()[dim]);
         }
-        ierr = MatSetValues(*m, 1, &row, colNum, colIdx, rowVals, INSERT_VALUES); CHKERRV(ierr);
+      }
+      ierr = MatSetValues(*m, 1, &row, colIdx.size(), colIdx.data(), rowVals.data(), INSERT_VALUES); CHKERRV(ierr);
     }
-    
-    // -- SETS THE COEFFICIENTS --
-    PetscInt colNum = 0;
-    PetscInt colIdx[_matrixA.getSize().second];     // holds the columns indices of the entries
-    PetscScalar rowVals[_matrixA.getSize().second]; // holds the values of the entries
 
-    if (_preallocation == Preallocation::SAVE or _preallocation == Preallocation::TREE) {
+    // -- SETS THE COEFFICIENTS --
+    colIdx.clear();
+    rowVals.clear();
+    if (saveVertexData) {
       auto const & rowVertices = vertexData[row - ownerRangeABegin];
       for (const auto & vertex : rowVertices) {
-        rowVals[colNum] = _basisFunction.evaluate(vertex.second);
-        colIdx[colNum++] = vertex.first;
+        rowVals.push_back(_basisFunction.evaluate(vertex.second));
+        colIdx.push_back(vertex.first);
       }
     }
     else {
-      for (const mesh::Vertex& inVertex : inMesh->vertices()) {
-        distance = oVertex.getCoords() - inVertex.getCoords();
-        for (int d = 0; d < dimensions; d++) {
-          if (_deadAxis[d])
-            distance[d] = 0;
-        }
-        double const norm = distance.norm();
-        if (_basisFunction.getSupportRadius() > norm) {
-          rowVals[colNum] = _basisFunction.evaluate(norm);
-          colIdx[colNum++] = inVertex.getGlobalIndex() + polyparams;
-        }
+      for (auto const & neighbor : neighborsInSupport(inMesh, oVertex)) {
+        rowVals.push_back(_basisFunction.evaluate(neighbor.second));
+        colIdx.push_back(mappedColumns[neighbor.first]);
       }
     }
-    ierr = AOApplicationToPetsc(_AOmapping, colNum, colIdx); CHKERRV(ierr);
-    ierr = MatSetValues(_matrixA, 1, &row, colNum, colIdx, rowVals, INSERT_VALUES); CHKERRV(ierr);
+    ierr = MatSetValues(_matrixA, 1, &row, colIdx.size(), colIdx.data(), rowVals.data(), INSERT_VALUES); CHKERRV(ierr);
   }
   DEBUG("Finished filling Matrix A");
   eFillA.stop();
@@ -592,7 +568,9 @@ template<typename RADIAL_BASIS_FUNCTION_T>
 void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int outputDataID)
 {
   TRACE(inputDataID, outputDataID);
-  precice::utils::Event e("map.pet.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  if (not _mapDataEvent.isValid())
+    _mapDataEvent = utils::EventRegistry::instance().getEventID("map.pet.mapData.From" + input()->getName() + "To" + output()->getName());
+  precice::utils::Event e(_mapDataEvent, precice::syncMode);
 
   assertion(_hasComputedMapping);
   assertion(input()->getDimensions() == output()->getDimensions(),
@@ -607,20 +585,32 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int
             valueDim, output()->data(outputDataID)->getDimensions());
 
   if (getConstraint() == CONSERVATIVE) {
-    petsc::Vector au(_matrixA, "au", petsc::Vector::RIGHT);
-    petsc::Vector in(_matrixA, "in");
+    // Fill the inputs of all components in one pass over the input values, i.e., one right-hand side per component.
+    // The local rows are written directly to the arrays, no assembly is needed.
+    std::deque<petsc::Vector> ins;
+    std::vector<PetscScalar*> inArrays(valueDim);
+    for (int dim = 0; dim < valueDim; dim++) {
+      ins.emplace_back(_matrixA, "in");
+      ierr = VecGetArray(ins.back(), &inArrays[dim]); CHKERRV(ierr);
+    }
     int inRangeStart, inRangeEnd;
-    std::tie(inRangeStart, inRangeEnd) = in.ownerRange();
+    std::tie(inRangeStart, inRangeEnd) = ins.front().ownerRange();
+    for (size_t i = 0; i < input()->vertices().size(); i++ ) {
+      auto const globalIndex = input()->vertices()[i].getGlobalIndex(); // globalIndex is target row
+      if (globalIndex >= inRangeStart and globalIndex < inRangeEnd) { // only fill local rows
+        for (int dim = 0; dim < valueDim; dim++)
+          inArrays[dim][globalIndex - inRangeStart] = inValues[i*valueDim + dim];
+      }
+    }
     for (int dim = 0; dim < valueDim; dim++) {
-      printMappingInfo(inputDataID, dim);
+      ierr = VecRestoreArray(ins[dim], &inArrays[dim]); CHKERRV(ierr);
+    }
 
-      // Fill input from input data values
-      for (size_t i = 0; i < input()->vertices().size(); i++ ) {
-        auto const globalIndex = input()->vertices()[i].getGlobalIndex(); // globalIndex is target row
-        if (globalIndex >= inRangeStart and globalIndex < inRangeEnd) // only fill local rows
-          ierr = VecSetValue(in, globalIndex, inValues[i*valueDim + dim], INSERT_VALUES); CHKERRV(ierr);
-      }
-      in.assemble();
+    // Compute the right-hand sides of all components, then solve them at once
+    std::deque<petsc::Vector> rhs, mus;
+    std::vector<petsc::Vector*> rhsPtrs, solutionPtrs, outs;
+    for (int dim = 0; dim < valueDim; dim++) {
+      printMappingInfo(inputDataID, dim);
 
       // Gets the petsc::vector for the given combination of outputData, inputData and dimension
       // If none created yet, create one, based on _matrixC
@@ -629,14 +619,38 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int
                                  std::forward_as_tuple(inputDataID + outputDataID * 10 + dim * 100),
                                  std::forward_as_tuple(_matrixC, "out"))
         )->second;
+      outs.push_back(&out);
 
       if (_polynomial == Polynomial::SEPARATE) {
+        rhs.emplace_back(_matrixA, "eta", petsc::Vector::RIGHT);
+        ierr = MatMultTranspose(_matrixA, ins[dim], rhs.back()); CHKERRV(ierr);
+        mus.emplace_back(_matrixC, "mu", petsc::Vector::LEFT);
+        solutionPtrs.push_back(&mus.back());
+      }
+      else {
+        rhs.emplace_back(_matrixA, "au", petsc::Vector::RIGHT);
+        ierr = MatMultTranspose(_matrixA, ins[dim], rhs.back()); CHKERRV(ierr);
+        solutionPtrs.push_back(&out);
+      }
+      rhsPtrs.push_back(&rhs.back());
+    }
+
+    if (not _solveEvent.isValid())
+      _solveEvent = utils::EventRegistry::instance().getEventID("map.pet.solveConservative.From" + input()->getName() + "To" + output()->getName());
+    utils::Event eSolve(_solveEvent, precice::syncMode);
+    if (not _solver.solve(rhsPtrs, solutionPtrs)) {
+      KSPView(_solver, PETSC_VIEWER_STDOUT_WORLD);
+      ERROR("RBF linear system has not converged.");
+    }
+    eSolve.stop();
+
+    for (int dim = 0; dim < valueDim; dim++) {
+      petsc::Vector& out = *outs[dim];
+
+      if (_polynomial == Polynomial::SEPARATE) {
+        petsc::Vector& mu = mus[dim];
         petsc::Vector epsilon(_matrixV, "epsilon", petsc::Vector::RIGHT);
-        ierr = MatMultTranspose(_matrixV, in, epsilon); CHKERRV(ierr);
-        petsc::Vector eta(_matrixA, "eta", petsc::Vector::RIGHT);
-        ierr = MatMultTranspose(_matrixA, in, eta); CHKERRV(ierr);
-        petsc::Vector mu(_matrixC, "mu", petsc::Vector::LEFT);
-        _solver.solve(eta, mu);
+        ierr = MatMultTranspose(_matrixV, ins[dim], epsilon); CHKERRV(ierr);
         VecScale(epsilon, -1);
         petsc::Vector tau(_matrixQ, "tau", petsc::Vector::RIGHT);
         ierr = MatMultTransposeAdd(_matrixQ, mu, epsilon, tau); CHKERRV(ierr);
@@ -647,16 +661,6 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int
         }
         VecWAXPY(out, -1, sigma, mu);
       }
-      else {
-        ierr = MatMultTranspose(_matrixA, in, au); CHKERRV(ierr);
-        utils::Event eSolve("map.pet.solveConservative.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
-        if (not _solver.solve(au, out)) {
-          KSPView(_solver, PETSC_VIEWER_STDOUT_WORLD);
-          ERROR("RBF linear system has not converged.");
-        }
-        eSolve.stop();
-
-      }
       VecChop(out, 1e-9);
 
       // Copy mapped data to output data values
@@ -679,28 +683,39 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int
   }
   else { // Map CONSISTENT
     petsc::Vector out(_matrixA, "out");
-    petsc::Vector in(_matrixC, "in");
-    petsc::Vector a(_matrixQ, "a", petsc::Vector::RIGHT); // holds the solution of the LS polynomial
+    std::deque<petsc::Vector> as; // hold the solutions of the LS polynomial per component
 
     PetscScalar const * vecArray;
 
-    // For every data dimension, perform mapping
+    // Fill the inputs of all components in one pass over the input values, i.e., one right-hand side per component.
+    // The owned vertices are the local rows following the polynomial parameters, no assembly is needed.
+    std::deque<petsc::Vector> ins;
+    std::vector<PetscScalar*> inArrays(valueDim);
     for (int dim = 0; dim < valueDim; dim++) {
-      printMappingInfo(inputDataID, dim);
+      ins.emplace_back(_matrixC, "in");
+      ierr = VecGetArray(ins.back(), &inArrays[dim]); CHKERRV(ierr);
+    }
+    size_t ownerCount = 0;
+    for (size_t i = 0; i < input()->vertices().size(); ++i) {
+      if (not input()->vertices()[i].isOwner())
+        continue;
+      for (int dim = 0; dim < valueDim; dim++)
+        inArrays[dim][ownerCount + localPolyparams] = inValues[i * valueDim + dim];
+      ownerCount++;
+    }
+    for (int dim = 0; dim < valueDim; dim++) {
+      ierr = VecRestoreArray(ins[dim], &inArrays[dim]); CHKERRV(ierr);
+    }
 
-      // Fill input from input data values
-      std::vector<PetscScalar> inVals; inVals.reserve(input()->vertices().size());
-      std::vector<PetscInt> inIdx; inIdx.reserve(input()->vertices().size());
-      for (size_t i = 0; i < input()->vertices().size(); ++i) {
-        if (not input()->vertices()[i].isOwner())
-          continue;       
-        inVals.emplace_back(inValues[i * valueDim + dim]);
-        inIdx.emplace_back(inIdx.size() + in.ownerRange().first + localPolyparams);
-      }
-      ierr = VecSetValues(in, inIdx.size(), inIdx.data(), inVals.data(), INSERT_VALUES); CHKERRV(ierr);
-      in.assemble();
+    // Remove the polynomial from the inputs of all components, then solve them at once
+    std::vector<petsc::Vector*> inPtrs, ps;
+    for (int dim = 0; dim < valueDim; dim++) {
+      printMappingInfo(inputDataID, dim);
+      petsc::Vector& in = ins[dim];
 
       if (_polynomial == Polynomial::SEPARATE) {
+        as.emplace_back(_matrixQ, "a", petsc::Vector::RIGHT);
+        petsc::Vector& a = as.back();
         if (not _QRsolver.solve(in, a)) {
           KSPView(_QRsolver, PETSC_VIEWER_STDOUT_WORLD);
           ERROR("Polynomial QR linear system has not converged.");
@@ -714,14 +729,21 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int
                                  std::forward_as_tuple(inputDataID + outputDataID * 10 + dim * 100),
                                  std::forward_as_tuple(_matrixC, "p"))
         )->second;
+      inPtrs.push_back(&in);
+      ps.push_back(&p);
+    }
 
-      utils::Event eSolve("map.pet.solveConsistent.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
-      if (not _solver.solve(in, p)) {
-        KSPView(_solver, PETSC_VIEWER_STDOUT_WORLD);
-        ERROR("RBF linear system has not converged.");
-      }
-      eSolve.stop();
+    if (not _solveEvent.isValid())
+      _solveEvent = utils::EventRegistry::instance().getEventID("map.pet.solveConsistent.From" + input()->getName() + "To" + output()->getName());
+    utils::Event eSolve(_solveEvent, precice::syncMode);
+    if (not _solver.solve(inPtrs, ps)) {
+      KSPView(_solver, PETSC_VIEWER_STDOUT_WORLD);
+      ERROR("RBF linear system has not converged.");
+    }
+    eSolve.stop();
 
+    for (int dim = 0; dim < valueDim; dim++) {
+      petsc::Vector& p = *ps[dim];
       ierr = MatMult(_matrixA, p, out); CHKERRV(ierr);
 
       if (useRescaling and _polynomial == Polynomial::SEPARATE) {
@@ -729,6 +751,7 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int
       }
 
       if (_polynomial == Polynomial::SEPARATE) {
+        petsc::Vector& a = as[dim];
         ierr = VecScale(a, -1); // scale it back to add the polynomial
         ierr = MatMultAdd(_matrixV, a, out, out); CHKERRV(ierr);
       }
@@ -943,175 +966,24 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::estimatePreallocationMat
 }
 
 
-template <typename RADIAL_BASIS_FUNCTION_T>
-void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computePreallocationMatrixC(const mesh::PtrMesh inMesh)
-{
-  precice::utils::Event ePreallocC("map.pet.preallocC.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
-
-  PetscInt n, ierr;
-
-  int dimensions = input()->getDimensions();
-  Eigen::VectorXd distance(dimensions);
-
-  std::tie(n, std::ignore) = _matrixC.getLocalSize();
-  std::vector<PetscInt> d_nnz(n), o_nnz(n);
-  PetscInt colOwnerRangeCBegin, colOwnerRangeCEnd;
-  std::tie(colOwnerRangeCBegin, colOwnerRangeCEnd) = _matrixC.ownerRangeColumn();
-
-  size_t local_row = 0;
-  // -- PREALLOCATES THE POLYNOMIAL PART OF THE MATRIX --
-  if (_polynomial == Polynomial::ON) {
-    for (local_row = 0; local_row < localPolyparams; local_row++) {
-      d_nnz[local_row] = colOwnerRangeCEnd - colOwnerRangeCBegin;
-      o_nnz[local_row] = _matrixC.getSize().first - d_nnz[local_row];
-    }
-  }
-
-  for (const mesh::Vertex& inVertex : inMesh->vertices()) {
-    if (not inVertex.isOwner())
-      continue;
-
-    PetscInt col = polyparams - 1;
-    const int global_row = local_row + _matrixC.ownerRange().first;
-    d_nnz[local_row] = 0;
-    o_nnz[local_row] = 0;
-
-    // -- PREALLOCATES THE COEFFICIENTS --
-    for (mesh::Vertex& vj : inMesh->vertices()) {
-      col++;
-
-      // the actual col where the vertex end up
-      PetscInt mappedCol = vj.getGlobalIndex() + polyparams;
-      ierr = AOApplicationToPetsc(_AOmapping, 1, &mappedCol); CHKERRV(ierr); // likely not efficient in the inner loop
-
-      if (global_row > mappedCol) // Skip, since we are below the diagonal
-        continue;
-
-      distance = inVertex.getCoords() - vj.getCoords();
-      for (int d = 0; d < dimensions; d++) {
-        if (_deadAxis[d]) {
-          distance[d] = 0;
-        }
-      }
-
-      if (_basisFunction.getSupportRadius() > distance.norm() or col == global_row) {
-        if (mappedCol >= colOwnerRangeCBegin and mappedCol < colOwnerRangeCEnd)
-          d_nnz[local_row]++;
-        else
-          o_nnz[local_row]++;
-      }
-    }
-    local_row++;
-  }
-
-  if (utils::Parallel::getCommunicatorSize() == 1) {
-    // std::cout << "Computed Preallocation C Seq diagonal = " << std::accumulate(d_nnz.begin(), d_nnz.end(), 0) << std::endl;
-    ierr = MatSeqSBAIJSetPreallocation(_matrixC, _matrixC.blockSize(), 0, d_nnz.data()); CHKERRV(ierr);
-  }
-  else {
-    // std::cout << "Computed Preallocation C MPI diagonal = " << std::accumulate(d_nnz.begin(), d_nnz.end(), 0)
-    // << ", off-diagonal = " << std::accumulate(o_nnz.begin(), o_nnz.end(), 0) << std::endl;
-    ierr = MatMPISBAIJSetPreallocation(_matrixC, _matrixC.blockSize(), 0, d_nnz.data(), 0, o_nnz.data()); CHKERRV(ierr);
-  }
-  MatSetOption(_matrixC, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_TRUE);
-
-  ePreallocC.stop();
-}
-
-template <typename RADIAL_BASIS_FUNCTION_T>
-void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computePreallocationMatrixA(
-  const mesh::PtrMesh inMesh, const mesh::PtrMesh outMesh)
-{
-  precice::utils::Event ePreallocA("map.pet.preallocA.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
-
-  PetscInt ownerRangeABegin, ownerRangeAEnd, colOwnerRangeABegin, colOwnerRangeAEnd;
-  PetscInt outputSize, ierr;
-
-  std::tie(outputSize, std::ignore) = _matrixA.getLocalSize();
-
-  std::vector<PetscInt> d_nnz(outputSize), o_nnz(outputSize);
-
-  std::tie(ownerRangeABegin, ownerRangeAEnd) = _matrixA.ownerRange();
-  std::tie(colOwnerRangeABegin, colOwnerRangeAEnd) = _matrixA.ownerRangeColumn();
-
-  int dimensions = input()->getDimensions();
-  Eigen::VectorXd distance(dimensions);
-
-  for (int localRow = 0; localRow < ownerRangeAEnd - ownerRangeABegin; localRow++) {
-    d_nnz[localRow] = 0;
-    o_nnz[localRow] = 0;
-    PetscInt col = 0;
-    const mesh::Vertex& oVertex = outMesh->vertices()[localRow];
-
-    // -- PREALLOCATE THE POLYNOM PART OF THE MATRIX --
-    // col does not need mapping here, because the first polyparams col are always identity mapped
-    if (_polynomial == Polynomial::ON) {
-      if (col >= colOwnerRangeABegin and col < colOwnerRangeAEnd)
-        d_nnz[localRow]++;
-      else
-        o_nnz[localRow]++;
-      col++;
-
-      for (int dim = 0; dim < dimensions; dim++) {
-        if (not _deadAxis[dim]) {
-          if (col >= colOwnerRangeABegin and col < colOwnerRangeAEnd)
-            d_nnz[localRow]++;
-          else
-            o_nnz[localRow]++;
-          col++;
-        }
-      }
-    }
-
-    // -- PREALLOCATE THE COEFFICIENTS --
-    for (const mesh::Vertex& inVertex : inMesh->vertices()) {
-      distance = oVertex.getCoords() - inVertex.getCoords();
-      for (int d = 0; d < dimensions; d++) {
-        if (_deadAxis[d])
-          distance[d] = 0;
-      }
-
-      if (_basisFunction.getSupportRadius() > distance.norm()) {
-        col = inVertex.getGlobalIndex() + polyparams;
-        AOApplicationToPetsc(_AOmapping, 1, &col);
-        if (col >= colOwnerRangeABegin and col < colOwnerRangeAEnd)
-          d_nnz[localRow]++;
-        else
-          o_nnz[localRow]++;
-      }
-    }
-  }
-  if (utils::Parallel::getCommunicatorSize() == 1) {
-    // std::cout << "Preallocation A Seq diagonal = " << std::accumulate(d_nnz.begin(), d_nnz.end(), 0) << std::endl;
-    ierr = MatSeqAIJSetPreallocation(_matrixA, 0, d_nnz.data()); CHKERRV(ierr);
-  }
-  else {
-    // std::cout << "Preallocation A MPI diagonal = " << std::accumulate(d_nnz.begin(), d_nnz.end(), 0)
-    // << ", off-diagonal = " << std::accumulate(o_nnz.begin(), o_nnz.end(), 0) << std::endl;
-    ierr = MatMPIAIJSetPreallocation(_matrixA, 0, d_nnz.data(), 0, o_nnz.data()); CHKERRV(ierr);
-  }
-  MatSetOption(_matrixA, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_TRUE);
-
-  ePreallocA.stop();
-}
-
 template <typename RADIAL_BASIS_FUNCTION_T>
 typename PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::VertexData
-PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::savedPreallocationMatrixC(mesh::PtrMesh const inMesh)
+PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computePreallocationMatrixC
+(
+  mesh::PtrMesh const inMesh,
+  std::vector<PetscInt> const & mappedColumns,
+  bool saveVertexData)
 {
+  DEBUG("Using tree-based preallocation for matrix C");
   precice::utils::Event ePreallocC("map.pet.preallocC.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
 
   PetscInt n;
-
-  int dimensions = input()->getDimensions();
-  Eigen::VectorXd distance(dimensions);
-
   std::tie(n, std::ignore) = _matrixC.getLocalSize();
   std::vector<PetscInt> d_nnz(n), o_nnz(n);
   PetscInt colOwnerRangeCBegin, colOwnerRangeCEnd;
   std::tie(colOwnerRangeCBegin, colOwnerRangeCEnd) = _matrixC.ownerRangeColumn();
 
-  VertexData vertexData(n - localPolyparams);
+  VertexData vertexData(saveVertexData ? n - localPolyparams : 0);
 
   size_t local_row = 0;
   // -- PREALLOCATES THE POLYNOMIAL PART OF THE MATRIX --
@@ -1126,45 +998,31 @@ PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::savedPreallocationMatrixC(mes
     if (not inVertex.isOwner())
       continue;
 
-    PetscInt col = polyparams - 1;
-    const int global_row = local_row + _matrixC.ownerRange().first;
+    PetscInt const global_row = local_row + _matrixC.ownerRange().first;
     d_nnz[local_row] = 0;
     o_nnz[local_row] = 0;
 
     // -- PREALLOCATES THE COEFFICIENTS --
-    for (mesh::Vertex& vj : inMesh->vertices()) {
-      col++;
-
-      PetscInt mappedCol = vj.getGlobalIndex() + polyparams;
-      AOApplicationToPetsc(_AOmapping, 1, &mappedCol); // likely not efficient in the inner loop
-      
+    // The vertex itself is always in its support, hence the diagonal is always preallocated
+    for (auto const & neighbor : neighborsInSupport(inMesh, inVertex)) {
+      PetscInt const mappedCol = mappedColumns[neighbor.first];
       if (global_row > mappedCol) // Skip, since we are below the diagonal
         continue;
 
-      distance = inVertex.getCoords() - vj.getCoords();
-      for (int d = 0; d < dimensions; d++)
-        if (_deadAxis[d])
-          distance[d] = 0;
-
-      double const norm = distance.norm();
-      if (_basisFunction.getSupportRadius() > norm or col == global_row) {
-        vertexData[local_row - localPolyparams].emplace_back(vj.getGlobalIndex() + polyparams, norm);
-        if (mappedCol >= colOwnerRangeCBegin and mappedCol < colOwnerRangeCEnd)
-          d_nnz[local_row]++;
-        else
-          o_nnz[local_row]++;
-      }
+      if (saveVertexData)
+        vertexData[local_row - localPolyparams].emplace_back(mappedCol, neighbor.second);
+      if (mappedCol >= colOwnerRangeCBegin and mappedCol < colOwnerRangeCEnd)
+        d_nnz[local_row]++;
+      else
+        o_nnz[local_row]++;
     }
     local_row++;
   }
 
   if (utils::Parallel::getCommunicatorSize() == 1) {
-    // std::cout << "Computed Preallocation C Seq diagonal = " << std::accumulate(d_nnz.begin(), d_nnz.end(), 0) << std::endl;
     MatSeqSBAIJSetPreallocation(_matrixC, _matrixC.blockSize(), 0, d_nnz.data());
   }
   else {
-    // std::cout << "Computed Preallocation C MPI diagonal = " << std::accumulate(d_nnz.begin(), d_nnz.end(), 0)
-    //           << ", off-diagonal = " << std::accumulate(o_nnz.begin(), o_nnz.end(), 0) << std::endl;
     MatMPISBAIJSetPreallocation(_matrixC, _matrixC.blockSize(), 0, d_nnz.data(), 0, o_nnz.data());
   }
   MatSetOption(_matrixC, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_TRUE);
@@ -1176,30 +1034,33 @@ PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::savedPreallocationMatrixC(mes
 
 template <typename RADIAL_BASIS_FUNCTION_T>
 typename PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::VertexData
-PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::savedPreallocationMatrixA(mesh::PtrMesh const inMesh, mesh::PtrMesh const outMesh)
+PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computePreallocationMatrixA
+(
+  mesh::PtrMesh const inMesh,
+  mesh::PtrMesh const outMesh,
+  std::vector<PetscInt> const & mappedColumns,
+  bool saveVertexData)
 {
-  INFO("Using saved preallocation");
+  DEBUG("Using tree-based preallocation for matrix A");
   precice::utils::Event ePreallocA("map.pet.preallocA.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
 
   PetscInt ownerRangeABegin, ownerRangeAEnd, colOwnerRangeABegin, colOwnerRangeAEnd;
-  PetscInt outputSize;
+  PetscInt const outputSize = _matrixA.getLocalSize().first;
 
-  std::tie(outputSize, std::ignore) = _matrixA.getLocalSize(); // n hier nehmen
   std::tie(ownerRangeABegin, ownerRangeAEnd) = _matrixA.ownerRange();
   std::tie(colOwnerRangeABegin, colOwnerRangeAEnd) = _matrixA.ownerRangeColumn();
   int dimensions = input()->getDimensions();
 
   std::vector<PetscInt> d_nnz(outputSize), o_nnz(outputSize);
-  Eigen::VectorXd distance(dimensions);
 
   // Contains localRow<localCols<colPosition, distance>>>
-  VertexData vertexData(outputSize);
+  VertexData vertexData(saveVertexData ? outputSize : 0);
 
   for (int localRow = 0; localRow < ownerRangeAEnd - ownerRangeABegin; localRow++) {
     d_nnz[localRow] = 0;
     o_nnz[localRow] = 0;
     PetscInt col = 0;
-    const mesh::Vertex& oVertex = outMesh->vertices()[localRow];
+    mesh::Vertex const & oVertex = outMesh->vertices()[localRow];
 
     // -- PREALLOCATE THE POLYNOM PART OF THE MATRIX --
     // col does not need mapping here, because the first polyparams col are always identity mapped
@@ -1222,32 +1083,20 @@ PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::savedPreallocationMatrixA(mes
     }
 
     // -- PREALLOCATE THE COEFFICIENTS --
-    for (const mesh::Vertex& inVertex : inMesh->vertices()) {
-      distance = oVertex.getCoords() - inVertex.getCoords();
-      for (int d = 0; d < dimensions; d++)
-        if (_deadAxis[d])
-          distance[d] = 0;
-      
-      double const norm = distance.norm();
-      if (_basisFunction.getSupportRadius() > norm) {
-        col = inVertex.getGlobalIndex() + polyparams;
-        vertexData[localRow].emplace_back(col, norm);
-
-        AOApplicationToPetsc(_AOmapping, 1, &col);
-        if (col >= colOwnerRangeABegin and col < colOwnerRangeAEnd)
-          d_nnz[localRow]++;
-        else
-          o_nnz[localRow]++;
-      }
+    for (auto const & neighbor : neighborsInSupport(inMesh, oVertex)) {
+      col = mappedColumns[neighbor.first];
+      if (saveVertexData)
+        vertexData[localRow].emplace_back(col, neighbor.second);
+      if (col >= colOwnerRangeABegin and col < colOwnerRangeAEnd)
+        d_nnz[localRow]++;
+      else
+        o_nnz[localRow]++;
     }
   }
   if (utils::Parallel::getCommunicatorSize() == 1) {
-    // std::cout << "Preallocation A Seq diagonal = " << std::accumulate(d_nnz.begin(), d_nnz.end(), 0) << std::endl;
     MatSeqAIJSetPreallocation(_matrixA, 0, d_nnz.data());
   }
   else {
-    // std::cout << "Preallocation A MPI diagonal = " << std::accumulate(d_nnz.begin(), d_nnz.end(), 0)
-    //           << ", off-diagonal = " << std::accumulate(o_nnz.begin(), o_nnz.end(), 0) << std::endl;
     MatMPIAIJSetPreallocation(_matrixA, 0, d_nnz.data(), 0, o_nnz.data());
   }
   MatSetOption(_matrixA, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_TRUE);
@@ -1256,186 +1105,63 @@ PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::savedPreallocationMatrixA(mes
   return vertexData;
 }
 
-
 template <typename RADIAL_BASIS_FUNCTION_T>
-typename PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::VertexData
-PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::bgPreallocationMatrixC(mesh::PtrMesh const inMesh)
+std::vector<std::pair<size_t, double>>
+PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::neighborsInSupport
+(
+  mesh::PtrMesh const mesh,
+  mesh::Vertex const & vertex) const
 {
-  INFO("Using tree-based preallocation for matrix C");
-  precice::utils::Event ePreallocC("map.pet.preallocC.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
   namespace bg = boost::geometry;
-
-  PetscInt n;
-  std::tie(n, std::ignore) = _matrixC.getLocalSize();
-  std::vector<PetscInt> d_nnz(n), o_nnz(n);
-
-  auto tree = mesh::rtree::getVertexRTree(inMesh);
-
   double const supportRadius = _basisFunction.getSupportRadius();
+  int const dimensions = input()->getDimensions();
 
-  int dimensions = input()->getDimensions();
-  Eigen::VectorXd distance(dimensions);
-  
-  PetscInt colOwnerRangeCBegin, colOwnerRangeCEnd;
-  std::tie(colOwnerRangeCBegin, colOwnerRangeCEnd) = _matrixC.ownerRangeColumn();
-
-  VertexData vertexData(n - localPolyparams);
-
-  size_t local_row = 0;
-  // -- PREALLOCATES THE POLYNOMIAL PART OF THE MATRIX --
-  if (_polynomial == Polynomial::ON) {
-    for (local_row = 0; local_row < localPolyparams; local_row++) {
-      d_nnz[local_row] = colOwnerRangeCEnd - colOwnerRangeCBegin;
-      o_nnz[local_row] = _matrixC.getSize().first - d_nnz[local_row];
-    }
-  }
-
-  for (const mesh::Vertex& inVertex : inMesh->vertices()) {
-    if (not inVertex.isOwner())
-      continue;
-
-    PetscInt col = polyparams;
-    PetscInt const global_row = local_row + _matrixC.ownerRange().first;
-    d_nnz[local_row] = 0;
-    o_nnz[local_row] = 0;
-
-    // -- PREALLOCATES THE COEFFICIENTS --
-    std::vector<size_t> results;
-    auto search_box = mesh::getEnclosingBox(inVertex, supportRadius);
-
-    tree->query(bg::index::within(search_box) and bg::index::satisfies([&](size_t const i){
-          return bg::distance(inVertex, inMesh->vertices()[i]) <= supportRadius;}),
-      std::back_inserter(results));
-
-    // for (mesh::Vertex& vj : inMesh->vertices()) {
-    for (auto const i : results) {
-      const mesh::Vertex & vj = inMesh->vertices()[i];
-
-      PetscInt mappedCol = vj.getGlobalIndex() + polyparams;
-      AOApplicationToPetsc(_AOmapping, 1, &mappedCol); // likely not efficient in the inner loop
-        
-      if (global_row > mappedCol) // Skip, since we are below the diagonal
-        continue;
-
-      distance = inVertex.getCoords() - vj.getCoords();
-      for (int d = 0; d < dimensions; d++)
-        if (_deadAxis[d])
-          distance[d] = 0;
-
-      double const norm = distance.norm();
-      if (supportRadius > norm or col == global_row) {
-        vertexData[local_row - localPolyparams].emplace_back(vj.getGlobalIndex() + polyparams, norm);
-        if (mappedCol >= colOwnerRangeCBegin and mappedCol < colOwnerRangeCEnd)
-          d_nnz[local_row]++;
-        else
-          o_nnz[local_row]++;
-      }
-      col++;
-    }
-    local_row++;
+  // The search box is unbounded along dead axes, since their distance is ignored
+  auto searchBox = mesh::getEnclosingBox(vertex, supportRadius);
+  double const lowest = std::numeric_limits<double>::lowest();
+  double const highest = std::numeric_limits<double>::max();
+  if (_deadAxis[0]) {
+    bg::set<bg::min_corner, 0>(searchBox, lowest);
+    bg::set<bg::max_corner, 0>(searchBox, highest);
   }
-
-  if (utils::Parallel::getCommunicatorSize() == 1) {
-    MatSeqSBAIJSetPreallocation(_matrixC, _matrixC.blockSize(), 0, d_nnz.data());
+  if (_deadAxis[1]) {
+    bg::set<bg::min_corner, 1>(searchBox, lowest);
+    bg::set<bg::max_corner, 1>(searchBox, highest);
   }
-  else {
-    MatMPISBAIJSetPreallocation(_matrixC, _matrixC.blockSize(), 0, d_nnz.data(), 0, o_nnz.data());
+  if (dimensions == 3 and _deadAxis[2]) {
+    bg::set<bg::min_corner, 2>(searchBox, lowest);
+    bg::set<bg::max_corner, 2>(searchBox, highest);
   }
-  MatSetOption(_matrixC, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_TRUE);
 
-  ePreallocC.stop();
-
-  return vertexData;
+  std::vector<size_t> candidates;
+  mesh::rtree::getVertexRTree(mesh)->query(bg::index::within(searchBox), std::back_inserter(candidates));
+
+  std::vector<std::pair<size_t, double>> neighbors;
+  neighbors.reserve(candidates.size());
+  for (size_t const i : candidates) {
+    auto const & coords = mesh->vertices()[i].getCoords();
+    double squaredNorm = 0;
+    for (int d = 0; d < dimensions; d++) {
+      if (not _deadAxis[d])
+        squaredNorm += (vertex.getCoords()[d] - coords[d]) * (vertex.getCoords()[d] - coords[d]);
+    }
+    double const norm = std::sqrt(squaredNorm);
+    if (supportRadius > norm)
+      neighbors.emplace_back(i, norm);
+  }
+  return neighbors;
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
-typename PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::VertexData
-PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::bgPreallocationMatrixA(mesh::PtrMesh const inMesh, mesh::PtrMesh const outMesh)
+std::vector<PetscInt> PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapColumns(mesh::PtrMesh const inMesh) const
 {
-  INFO("Using tree-based preallocation for matrix A");
-  precice::utils::Event ePreallocA("map.pet.preallocA.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
-  namespace bg = boost::geometry;
-
-  PetscInt ownerRangeABegin, ownerRangeAEnd, colOwnerRangeABegin, colOwnerRangeAEnd;
-  PetscInt const outputSize = _matrixA.getLocalSize().first;
-  auto tree = mesh::rtree::getVertexRTree(inMesh);
-  double const supportRadius = _basisFunction.getSupportRadius();
-
-  std::tie(ownerRangeABegin, ownerRangeAEnd) = _matrixA.ownerRange();
-  std::tie(colOwnerRangeABegin, colOwnerRangeAEnd) = _matrixA.ownerRangeColumn();
-  int dimensions = input()->getDimensions();
-
-  std::vector<PetscInt> d_nnz(outputSize), o_nnz(outputSize);
-  Eigen::VectorXd distance(dimensions);
-
-  // Contains localRow<localCols<colPosition, distance>>>
-  VertexData vertexData(outputSize);
-
-  for (int localRow = 0; localRow < ownerRangeAEnd - ownerRangeABegin; localRow++) {
-    d_nnz[localRow] = 0;
-    o_nnz[localRow] = 0;
-    PetscInt col = 0;
-    mesh::Vertex const & oVertex = outMesh->vertices()[localRow];
-
-    // -- PREALLOCATE THE POLYNOM PART OF THE MATRIX --
-    // col does not need mapping here, because the first polyparams col are always identity mapped
-    if (_polynomial == Polynomial::ON) {
-      if (col >= colOwnerRangeABegin and col < colOwnerRangeAEnd)
-        d_nnz[localRow]++;
-      else
-        o_nnz[localRow]++;
-      col++;
-
-      for (int dim = 0; dim < dimensions; dim++) {
-        if (not _deadAxis[dim]) {
-          if (col >= colOwnerRangeABegin and col < colOwnerRangeAEnd)
-            d_nnz[localRow]++;
-          else
-            o_nnz[localRow]++;
-          col++;
-        }
-      }
-    }
-
-    // -- PREALLOCATE THE COEFFICIENTS --
-    std::vector<size_t> results;
-    auto search_box = mesh::getEnclosingBox(oVertex, supportRadius);
-
-    tree->query(bg::index::within(search_box) and bg::index::satisfies([&](size_t const i){
-          return bg::distance(oVertex, inMesh->vertices()[i]) <= supportRadius;}),
-      std::back_inserter(results));
-
-    for (auto i : results ) {
-        const mesh::Vertex & inVertex = inMesh->vertices()[i];
-        distance = oVertex.getCoords() - inVertex.getCoords();
-
-        for (int d = 0; d < dimensions; d++)
-          if (_deadAxis[d])
-            distance[d] = 0;
+  std::vector<PetscInt> columns;
+  columns.reserve(inMesh->vertices().size());
+  for (const mesh::Vertex& vertex : inMesh->vertices())
+    columns.push_back(vertex.getGlobalIndex() + polyparams);
 
-        double const norm = distance.norm();
-        if (supportRadius > norm) {
-          col = inVertex.getGlobalIndex() + polyparams;
-          vertexData[localRow].emplace_back(col, norm);
-
-          AOApplicationToPetsc(_AOmapping, 1, &col);
-          if (col >= colOwnerRangeABegin and col < colOwnerRangeAEnd)
-            d_nnz[localRow]++;
-          else
-            o_nnz[localRow]++;
-        }
-    }
-  }
-  if (utils::Parallel::getCommunicatorSize() == 1) {
-    MatSeqAIJSetPreallocation(_matrixA, 0, d_nnz.data());
-  }
-  else {
-    MatMPIAIJSetPreallocation(_matrixA, 0, d_nnz.data(), 0, o_nnz.data());
-  }
-  MatSetOption(_matrixA, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_TRUE);
-
-  ePreallocA.stop();
-  return vertexData;
+  AOApplicationToPetsc(_AOmapping, columns.size(), columns.data());
+  return columns;
 }
 
 
@@ -2,6 +2,8 @@
 
 #include "Mapping.hpp"
 #include "impl/BasisFunctions.hpp"
+#include "impl/DistanceMatrix.hpp"
+#include "impl/MatrixCache.hpp"
 #include "utils/MasterSlave.hpp"
 #include "utils/EventTimings.hpp"
 
@@ -23,6 +25,9 @@ namespace mapping {
  *
  * The radial basis function type has to be given as template parameter, and has
  * to be one of the defined types in this file.
+ *
+ * If a cache directory is given, the mapping matrix is stored on disk and reused by
+ * later runs with identical meshes and mapping settings, see impl::MatrixCache.
  */
 template<typename RADIAL_BASIS_FUNCTION_T>
 class RadialBasisFctMapping : public Mapping
@@ -36,6 +41,7 @@ public:
    * @param[in] dimensions Dimensionality of the meshes
    * @param[in] function Radial basis function used for mapping.
    * @param[in] xDead, yDead, zDead Deactivates mapping along an axis
+   * @param[in] cacheDirectory Directory to persist the mapping matrix in, empty disables caching
    */
   RadialBasisFctMapping (
     Constraint              constraint,
@@ -43,7 +49,8 @@ public:
     RADIAL_BASIS_FUNCTION_T function,
     bool                    xDead,
     bool                    yDead,
-    bool                    zDead);
+    bool                    zDead,
+    const std::string&      cacheDirectory = "");
 
 
   /// Computes the mapping coefficients from the in- and output mesh.
@@ -66,6 +73,9 @@ private:
 
   precice::logging::Logger _log{"mapping::RadialBasisFctMapping"};
 
+  /// ID of the mapData event
+  utils::EventID _mapDataEvent;
+
   bool _hasComputedMapping = false;
 
   /// Radial basis function type used in interpolation.
@@ -74,12 +84,16 @@ private:
   Eigen::MatrixXd _matrixA;
 
   Eigen::ColPivHouseholderQR<Eigen::MatrixXd> _qr;
+
+  /// Explicit mapping matrix of the consistent mapping, if caching is enabled
+  impl::MatrixCache _cache;
   
   /// true if the mapping along some axis should be ignored
   std::vector<bool> _deadAxis;
 
-  /// Deletes all dead directions from fullVector and returns a vector of reduced dimensionality.
-  Eigen::VectorXd reduceVector(const Eigen::VectorXd& fullVector);
+
+  /// Returns a key identifying meshes and settings, which determine the mapping matrix.
+  impl::Hash computeCacheKey(const mesh::PtrMesh& inMesh, const mesh::PtrMesh& outMesh) const;
   
   void setDeadAxis(bool xDead, bool yDead, bool zDead)
   {
@@ -114,10 +128,12 @@ RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: RadialBasisFctMapping
   RADIAL_BASIS_FUNCTION_T function,
   bool                    xDead,
   bool                    yDead,
-  bool                    zDead)
+  bool                    zDead,
+  const std::string&      cacheDirectory)
   :
   Mapping ( constraint, dimensions ),
-  _basisFunction ( function )
+  _basisFunction ( function ),
+  _cache ( cacheDirectory )
 {
   setInputRequirement(Mapping::MeshRequirement::VERTEX);
   setOutputRequirement(Mapping::MeshRequirement::VERTEX);
@@ -158,53 +174,54 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: computeMapping()
   int polyparams = 1 + dimensions - deadDimensions;
   assertion(inputSize >= 1 + polyparams, inputSize);
   int n = inputSize + polyparams; // Add linear polynom degrees
+
+  impl::Hash cacheKey;
+  if (_cache.isEnabled()) {
+    cacheKey = computeCacheKey(inMesh, outMesh);
+    if (_cache.load(cacheKey, outputSize, inputSize)) {
+      INFO("Reusing cached mapping matrix for mapping from " << input()->getName() << " to " << output()->getName());
+      _hasComputedMapping = true;
+      return;
+    }
+  }
+
   Eigen::MatrixXd matrixCLU(n, n);
   matrixCLU.setZero();
   _matrixA = Eigen::MatrixXd(outputSize, n);
   _matrixA.setZero();
 
-  // Fill upper right part (due to symmetry) of _matrixCLU with values
-  int i = 0;
-  Eigen::VectorXd difference(dimensions);
-  for (const mesh::Vertex& iVertex : inMesh->vertices()) {
-    for (int j = iVertex.getID(); j < inputSize; j++) {
-      difference = iVertex.getCoords();
-      difference -= inMesh->vertices()[j].getCoords();
-      matrixCLU(i,j) = _basisFunction.evaluate(reduceVector(difference).norm());
-    }
-    matrixCLU(i,inputSize) = 1.0;
-    for (int dim=0; dim < dimensions-deadDimensions; dim++) {
-      matrixCLU(i,inputSize+1+dim) = reduceVector(iVertex.getCoords())[dim];
-    }
-    i++;
-  }
-  // Copy values of upper right part of C to lower left part
-  for (int i = 0; i < n; i++) {
-    for (int j = i+1; j < n; j++) {
-      matrixCLU(j,i) = matrixCLU(i,j);
-    }
-  }
+  Eigen::MatrixXd inCoords = impl::activeCoordinates(*inMesh, _deadAxis);
+  Eigen::MatrixXd outCoords = impl::activeCoordinates(*outMesh, _deadAxis);
+
+  // Fill C with the basis function block and the polynomial
+  auto matrixPhi = matrixCLU.topLeftCorner(inputSize, inputSize);
+  impl::computeDistances(inCoords, inCoords, matrixPhi);
+  impl::evaluateInPlace(_basisFunction, matrixPhi);
+  matrixCLU.block(0, inputSize, inputSize, 1).setOnes();
+  matrixCLU.block(0, inputSize + 1, inputSize, inCoords.cols()) = inCoords;
+  matrixCLU.block(inputSize, 0, polyparams, inputSize) = matrixCLU.block(0, inputSize, inputSize, polyparams).transpose();
 
   // Fill _matrixA with values
-  i = 0;
-  for (const mesh::Vertex& iVertex : outMesh->vertices()) {
-    int j = 0;
-    for (const mesh::Vertex& jVertex : inMesh->vertices()) {
-      difference = iVertex.getCoords();
-      difference -= jVertex.getCoords();
-      _matrixA(i,j) = _basisFunction.evaluate(reduceVector(difference).norm());
-      j++;
-    }
-    _matrixA(i,inputSize) = 1.0;
-    for (int dim=0; dim < dimensions-deadDimensions; dim++) {
-      _matrixA(i,inputSize+1+dim) = reduceVector(iVertex.getCoords())[dim];
-    }
-    i++;
-  }
+  auto matrixB = _matrixA.leftCols(inputSize);
+  impl::computeDistances(outCoords, inCoords, matrixB);
+  impl::evaluateInPlace(_basisFunction, matrixB);
+  _matrixA.col(inputSize).setOnes();
+  _matrixA.rightCols(outCoords.cols()) = outCoords;
 
   _qr = matrixCLU.colPivHouseholderQr();
   if (not _qr.isInvertible())
     ERROR("Interpolation matrix C is not invertible.");
+
+  if (_cache.isEnabled()) {
+    // The mapping matrix A * C^-1 (restricted to the columns of the vertices) replaces A and the
+    // factorization, since the latter cannot be restored from disk.
+    Eigen::MatrixXd mappingMatrix = _matrixA * _qr.solve(Eigen::MatrixXd::Identity(n, inputSize));
+    _cache.store(cacheKey, mappingMatrix);
+    if (_cache.load(cacheKey, outputSize, inputSize)) {
+      _matrixA = Eigen::MatrixXd();
+      _qr = Eigen::ColPivHouseholderQR<Eigen::MatrixXd>();
+    }
+  }
   
   _hasComputedMapping = true;
 }
@@ -221,6 +238,7 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: clear()
   TRACE();
   _matrixA = Eigen::MatrixXd();
   _qr = Eigen::ColPivHouseholderQR<Eigen::MatrixXd>();
+  _cache.clear();
   _hasComputedMapping = false;
 }
 
@@ -232,7 +250,9 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: map
 {
   TRACE(inputDataID, outputDataID);
 
-  precice::utils::Event e("map.rbf.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  if (not _mapDataEvent.isValid())
+    _mapDataEvent = utils::EventRegistry::instance().getEventID("map.rbf.mapData.From" + input()->getName() + "To" + output()->getName());
+  precice::utils::Event e(_mapDataEvent, precice::syncMode);
 
   assertion(_hasComputedMapping);
   assertion(input()->getDimensions() == output()->getDimensions(),
@@ -251,7 +271,21 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: map
   }
   int polyparams = 1 + getDimensions() - deadDimensions;
 
-  if (getConstraint() == CONSERVATIVE){
+  if (_cache.isLoaded()) {
+    DEBUG("Map with cached mapping matrix");
+    Eigen::Map<const Eigen::MatrixXd> mappingMatrix = _cache.matrix();
+    for (int dim = 0; dim < valueDim; dim++) {
+      Eigen::Map<Eigen::VectorXd, 0, Eigen::InnerStride<>> in(inValues.data() + dim, inValues.size() / valueDim,
+                                                            Eigen::InnerStride<>(valueDim));
+      Eigen::Map<Eigen::VectorXd, 0, Eigen::InnerStride<>> out(outValues.data() + dim, outValues.size() / valueDim,
+                                                             Eigen::InnerStride<>(valueDim));
+      if (getConstraint() == CONSERVATIVE)
+        out.noalias() = mappingMatrix.transpose() * in;
+      else
+        out.noalias() = mappingMatrix * in;
+    }
+  }
+  else if (getConstraint() == CONSERVATIVE){
     DEBUG("Map conservative");
     static int mappingIndex = 0;
     Eigen::VectorXd Au(_matrixA.cols());  // rows == n
@@ -304,25 +338,26 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: map
 
 
 template<typename RADIAL_BASIS_FUNCTION_T>
-Eigen::VectorXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::reduceVector
+impl::Hash RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeCacheKey
 (
-  const Eigen::VectorXd& fullVector)
+  const mesh::PtrMesh& inMesh,
+  const mesh::PtrMesh& outMesh) const
 {
-  int deadDimensions = 0;
-  for (int d = 0; d < getDimensions(); d++) {
-    if (_deadAxis[d])
-      deadDimensions +=1;
-  }
-  assertion(getDimensions()>deadDimensions, getDimensions(), deadDimensions);
-  Eigen::VectorXd reducedVector(getDimensions()-deadDimensions);
-  int k = 0;
-  for (int d = 0; d < getDimensions(); d++) {
-    if (not _deadAxis[d]) {
-      reducedVector[k] = fullVector[d];
-      k++;
-    }
+  // Increase, whenever the hashed quantities or their order change
+  const int keyVersion = 1;
+  impl::Hash hash;
+  hash.add(static_cast<double>(keyVersion));
+  _basisFunction.hashParameters(hash);
+  hash.add(static_cast<double>(getConstraint()));
+  hash.add(static_cast<double>(getDimensions()));
+  for (bool dead : _deadAxis)
+    hash.add(dead ? 1.0 : 0.0);
+  for (const mesh::PtrMesh& mesh : {inMesh, outMesh}) {
+    hash.add(static_cast<double>(mesh->vertices().size()));
+    for (const mesh::Vertex& vertex : mesh->vertices())
+      hash.add(vertex.getCoords().data(), sizeof(double) * vertex.getDimensions());
   }
-  return reducedVector;
+  return hash;
 }
 
 template<typename RADIAL_BASIS_FUNCTION_T>
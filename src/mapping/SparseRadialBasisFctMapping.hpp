@@ -0,0 +1,412 @@
+#pragma once
+
+#include "Mapping.hpp"
+#include "impl/BasisFunctions.hpp"
+#include "mesh/RTree.hpp"
+#include "utils/MasterSlave.hpp"
+#include "utils/EventTimings.hpp"
+
+#include <Eigen/Core>
+#include <Eigen/QR>
+#include <Eigen/SparseCore>
+#include <Eigen/SparseCholesky>
+#include <limits>
+#include <vector>
+
+namespace precice {
+extern bool syncMode;
+
+namespace mapping {
+
+/**
+ * @brief Mapping with radial basis functions of compact support, based on sparse matrices.
+ *
+ * The interpolant is the same as for RadialBasisFctMapping, i.e., a weighted sum of radial
+ * basis functions and a linear polynomial. The interpolation system
+ *
+ *   [ Phi  P ] [ lambda ]   [ f ]
+ *   [ P^T  0 ] [ beta   ] = [ 0 ]
+ *
+ * is not factorized as a whole. For basis functions with compact support, Phi is sparse and
+ * positive definite. It is assembled from R-tree queries around the vertices and factorized once
+ * with a sparse LDL^T decomposition. The polynomial is eliminated via the small Schur complement
+ * S = P^T Phi^-1 P. Mapping one data component then costs one forward and one backward sparse
+ * triangular solve and a sparse matrix-vector product.
+ *
+ * The radial basis function type has to be given as template parameter and has to have compact support.
+ * Like RadialBasisFctMapping, this mapping is only available for serial participants.
+ */
+template<typename RADIAL_BASIS_FUNCTION_T>
+class SparseRadialBasisFctMapping : public Mapping
+{
+public:
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] constraint Specifies mapping to be consistent or conservative.
+   * @param[in] dimensions Dimensionality of the meshes
+   * @param[in] function Radial basis function used for mapping, needs to have compact support.
+   * @param[in] xDead, yDead, zDead Deactivates mapping along an axis
+   */
+  SparseRadialBasisFctMapping (
+    Constraint              constraint,
+    int                     dimensions,
+    RADIAL_BASIS_FUNCTION_T function,
+    bool                    xDead,
+    bool                    yDead,
+    bool                    zDead);
+
+  /// Computes the mapping coefficients from the in- and output mesh.
+  virtual void computeMapping() override;
+
+  /// Returns true, if computeMapping() has been called.
+  virtual bool hasComputedMapping() const override;
+
+  /// Removes a computed mapping.
+  virtual void clear() override;
+
+  /// Maps input data to output data from input mesh to output mesh.
+  virtual void map(int inputDataID, int outputDataID ) override;
+
+  virtual void tagMeshFirstRound() override;
+
+  virtual void tagMeshSecondRound() override;
+
+private:
+
+  precice::logging::Logger _log{"mapping::SparseRadialBasisFctMapping"};
+
+  /// ID of the mapData event
+  utils::EventID _mapDataEvent;
+
+  bool _hasComputedMapping = false;
+
+  /// Radial basis function type used in interpolation.
+  RADIAL_BASIS_FUNCTION_T _basisFunction;
+
+  /// Basis functions evaluated at the output vertices, without the polynomial part.
+  Eigen::SparseMatrix<double> _matrixA;
+
+  /// Polynomial part of A, i.e., the polynomial evaluated at the output vertices.
+  Eigen::MatrixXd _matrixAPoly;
+
+  /// Polynomial P evaluated at the input vertices.
+  Eigen::MatrixXd _matrixP;
+
+  /// Holds Phi^-1 P, needed to eliminate the polynomial.
+  Eigen::MatrixXd _matrixW;
+
+  /// Sparse factorization of Phi.
+  Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> _ldlt;
+
+  /// Factorization of the Schur complement S = P^T Phi^-1 P.
+  Eigen::ColPivHouseholderQR<Eigen::MatrixXd> _schurQR;
+
+  /// true if the mapping along some axis should be ignored
+  std::vector<bool> _deadAxis;
+
+  /// Returns the distance of a and b, ignoring dead axes.
+  double reducedDistance(const Eigen::VectorXd& a, const Eigen::VectorXd& b) const;
+
+  /// Writes the polynomial (1, x, y, z) evaluated at coords, ignoring dead axes, to row.
+  template<typename ROW_T>
+  void evaluatePolynomial(const Eigen::VectorXd& coords, ROW_T&& row) const;
+
+  /// Returns the indices of all vertices of mesh in the support radius around vertex, ignoring dead axes.
+  std::vector<size_t> verticesInSupport(const mesh::PtrMesh& mesh, const mesh::Vertex& vertex) const;
+
+  void setDeadAxis(bool xDead, bool yDead, bool zDead)
+  {
+    _deadAxis.resize(getDimensions());
+    if (getDimensions() == 2) {
+      _deadAxis[0] = xDead;
+      _deadAxis[1] = yDead;
+      CHECK(not (xDead && yDead), "You cannot choose all axis to be dead for a RBF mapping");
+      if (zDead)
+        WARN("Setting the z-axis to dead on a 2 dimensional problem has not effect and will be ignored.");
+    }
+    else if (getDimensions() == 3) {
+      _deadAxis[0] = xDead;
+      _deadAxis[1] = yDead;
+      _deadAxis[2] = zDead;
+      CHECK(not (xDead && yDead && zDead), "You cannot choose all axis to be dead for a RBF mapping");
+    }
+    else {
+      assertion(false);
+    }
+  }
+
+};
+
+// --------------------------------------------------- HEADER IMPLEMENTATIONS
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+SparseRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: SparseRadialBasisFctMapping
+(
+  Constraint              constraint,
+  int                     dimensions,
+  RADIAL_BASIS_FUNCTION_T function,
+  bool                    xDead,
+  bool                    yDead,
+  bool                    zDead)
+  :
+  Mapping ( constraint, dimensions ),
+  _basisFunction ( function )
+{
+  CHECK(_basisFunction.hasCompactSupport(),
+        "The sparse RBF mapping can only be used with basis functions of compact support!");
+  setInputRequirement(Mapping::MeshRequirement::VERTEX);
+  setOutputRequirement(Mapping::MeshRequirement::VERTEX);
+  setDeadAxis(xDead, yDead, zDead);
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void SparseRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: computeMapping()
+{
+  TRACE();
+
+  precice::utils::Event e("map.sparserbf.computeMapping.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+
+  CHECK(not utils::MasterSlave::_slaveMode && not utils::MasterSlave::_masterMode,
+        "RBF mapping is not supported for a participant in master mode, use petrbf instead");
+
+  assertion(input()->getDimensions() == output()->getDimensions(),
+             input()->getDimensions(), output()->getDimensions());
+  assertion(getDimensions() == output()->getDimensions(),
+             getDimensions(), output()->getDimensions());
+  mesh::PtrMesh inMesh;
+  mesh::PtrMesh outMesh;
+  if (getConstraint() == CONSERVATIVE){
+    inMesh = output();
+    outMesh = input();
+  }
+  else {
+    inMesh = input();
+    outMesh = output();
+  }
+  int inputSize = (int)inMesh->vertices().size();
+  int outputSize = (int)outMesh->vertices().size();
+  int deadDimensions = 0;
+  for (int d = 0; d < getDimensions(); d++) {
+    if (_deadAxis[d]) deadDimensions +=1;
+  }
+  int polyparams = 1 + getDimensions() - deadDimensions;
+  assertion(inputSize >= 1 + polyparams, inputSize);
+
+  // Assemble the lower triangular part of Phi, which is all SimplicialLDLT reads
+  std::vector<Eigen::Triplet<double>> entries;
+  _matrixP = Eigen::MatrixXd(inputSize, polyparams);
+  for (int i = 0; i < inputSize; i++) {
+    const mesh::Vertex& iVertex = inMesh->vertices()[i];
+    for (size_t j : verticesInSupport(inMesh, iVertex)) {
+      if ((int) j < i)
+        continue;
+      double const value = _basisFunction.evaluate(reducedDistance(iVertex.getCoords(), inMesh->vertices()[j].getCoords()));
+      if (value != 0.0)
+        entries.emplace_back(j, i, value);
+    }
+    evaluatePolynomial(iVertex.getCoords(), _matrixP.row(i));
+  }
+  Eigen::SparseMatrix<double> matrixPhi(inputSize, inputSize);
+  matrixPhi.setFromTriplets(entries.begin(), entries.end());
+  DEBUG("Phi rows=" << inputSize << " nonzeros in lower part=" << matrixPhi.nonZeros());
+
+  // Assemble A
+  entries.clear();
+  _matrixAPoly = Eigen::MatrixXd(outputSize, polyparams);
+  for (int i = 0; i < outputSize; i++) {
+    const mesh::Vertex& iVertex = outMesh->vertices()[i];
+    for (size_t j : verticesInSupport(inMesh, iVertex)) {
+      double const value = _basisFunction.evaluate(reducedDistance(iVertex.getCoords(), inMesh->vertices()[j].getCoords()));
+      if (value != 0.0)
+        entries.emplace_back(i, j, value);
+    }
+    evaluatePolynomial(iVertex.getCoords(), _matrixAPoly.row(i));
+  }
+  _matrixA = Eigen::SparseMatrix<double>(outputSize, inputSize);
+  _matrixA.setFromTriplets(entries.begin(), entries.end());
+
+  _ldlt.compute(matrixPhi);
+  if (_ldlt.info() != Eigen::Success)
+    ERROR("Interpolation matrix C is not invertible.");
+
+  _matrixW = _ldlt.solve(_matrixP);
+  Eigen::MatrixXd schur = _matrixP.transpose() * _matrixW;
+  _schurQR = schur.colPivHouseholderQr();
+  if (not _schurQR.isInvertible())
+    ERROR("Interpolation matrix C is not invertible.");
+
+  _hasComputedMapping = true;
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+bool SparseRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: hasComputedMapping() const
+{
+  return _hasComputedMapping;
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void SparseRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: clear()
+{
+  TRACE();
+  _matrixA = Eigen::SparseMatrix<double>();
+  _matrixAPoly = Eigen::MatrixXd();
+  _matrixP = Eigen::MatrixXd();
+  _matrixW = Eigen::MatrixXd();
+  // SimplicialLDLT cannot be reset, its factorization is replaced on the next computeMapping()
+  _schurQR = Eigen::ColPivHouseholderQR<Eigen::MatrixXd>();
+  _hasComputedMapping = false;
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void SparseRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: map
+(
+  int inputDataID,
+  int outputDataID )
+{
+  TRACE(inputDataID, outputDataID);
+
+  if (not _mapDataEvent.isValid())
+    _mapDataEvent = utils::EventRegistry::instance().getEventID("map.sparserbf.mapData.From" + input()->getName() + "To" + output()->getName());
+  precice::utils::Event e(_mapDataEvent, precice::syncMode);
+
+  assertion(_hasComputedMapping);
+  assertion(input()->getDimensions() == output()->getDimensions(),
+             input()->getDimensions(), output()->getDimensions());
+  assertion(getDimensions() == output()->getDimensions(),
+             getDimensions(), output()->getDimensions());
+
+  Eigen::VectorXd& inValues = input()->data(inputDataID)->values();
+  Eigen::VectorXd& outValues = output()->data(outputDataID)->values();
+  int valueDim = input()->data(inputDataID)->getDimensions();
+  assertion(valueDim == output()->data(outputDataID)->getDimensions(),
+             valueDim, output()->data(outputDataID)->getDimensions());
+
+  if (getConstraint() == CONSERVATIVE){
+    DEBUG("Map conservative");
+    Eigen::VectorXd in(_matrixA.rows());  // rows == outputSize
+    Eigen::VectorXd out(_matrixA.cols()); // rows == inputSize
+    Eigen::VectorXd beta(_matrixP.cols());
+
+    for (int dim = 0; dim < valueDim; dim++) {
+      for (int i = 0; i < in.size(); i++) { // Fill input data values
+        in[i] = inValues(i*valueDim + dim);
+      }
+
+      // Solve C [out; beta] = A^T in, with the polynomial eliminated
+      out = _ldlt.solve(_matrixA.transpose() * in);
+      beta = _schurQR.solve(_matrixP.transpose() * out - _matrixAPoly.transpose() * in);
+      out.noalias() -= _matrixW * beta;
+
+      // Copy mapped data to output data values
+      for (int i = 0; i < out.size(); i++) {
+        outValues(i*valueDim + dim) = out[i];
+      }
+    }
+  }
+  else { // Map consistent
+    DEBUG("Map consistent");
+    Eigen::VectorXd lambda(_matrixA.cols()); // rows == inputSize
+    Eigen::VectorXd out(_matrixA.rows());    // rows == outputSize
+    Eigen::VectorXd beta(_matrixP.cols());
+
+    // For every data dimension, perform mapping
+    for (int dim = 0; dim < valueDim; dim++) {
+      for (int i = 0; i < lambda.size(); i++) { // Fill input data values
+        lambda[i] = inValues(i*valueDim + dim);
+      }
+
+      // Solve C [lambda; beta] = [in; 0], with the polynomial eliminated
+      lambda = _ldlt.solve(lambda);
+      beta = _schurQR.solve(_matrixP.transpose() * lambda);
+      lambda.noalias() -= _matrixW * beta;
+
+      out = _matrixA * lambda;
+      out.noalias() += _matrixAPoly * beta;
+
+      // Copy mapped data to ouptut data values
+      for (int i = 0; i < out.size(); i++) {
+        outValues(i*valueDim + dim) = out[i];
+      }
+    }
+  }
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+double SparseRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::reducedDistance
+(
+  const Eigen::VectorXd& a,
+  const Eigen::VectorXd& b) const
+{
+  double squaredNorm = 0.0;
+  for (int d = 0; d < getDimensions(); d++) {
+    if (not _deadAxis[d])
+      squaredNorm += (a[d] - b[d]) * (a[d] - b[d]);
+  }
+  return std::sqrt(squaredNorm);
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+template<typename ROW_T>
+void SparseRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::evaluatePolynomial
+(
+  const Eigen::VectorXd& coords,
+  ROW_T&&                row) const
+{
+  row(0) = 1.0;
+  int k = 1;
+  for (int d = 0; d < getDimensions(); d++) {
+    if (not _deadAxis[d]) {
+      row(k) = coords[d];
+      k++;
+    }
+  }
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+std::vector<size_t> SparseRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::verticesInSupport
+(
+  const mesh::PtrMesh& mesh,
+  const mesh::Vertex&  vertex) const
+{
+  namespace bg = boost::geometry;
+  double const supportRadius = _basisFunction.getSupportRadius();
+
+  // Along dead axes, the distance is ignored, i.e., the search box is unbounded
+  auto searchBox = mesh::getEnclosingBox(vertex, supportRadius);
+  double const lowest = std::numeric_limits<double>::lowest();
+  double const highest = std::numeric_limits<double>::max();
+  if (_deadAxis[0]) {
+    bg::set<bg::min_corner, 0>(searchBox, lowest);
+    bg::set<bg::max_corner, 0>(searchBox, highest);
+  }
+  if (_deadAxis[1]) {
+    bg::set<bg::min_corner, 1>(searchBox, lowest);
+    bg::set<bg::max_corner, 1>(searchBox, highest);
+  }
+  if (getDimensions() == 3 && _deadAxis[2]) {
+    bg::set<bg::min_corner, 2>(searchBox, lowest);
+    bg::set<bg::max_corner, 2>(searchBox, highest);
+  }
+
+  std::vector<size_t> results;
+  mesh::rtree::getVertexRTree(mesh)->query(bg::index::within(searchBox), std::back_inserter(results));
+  return results;
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void SparseRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshFirstRound()
+{
+  CHECK(not utils::MasterSlave::_slaveMode && not utils::MasterSlave::_masterMode,
+        "RBF mapping is not supported for a participant in master mode, use petrbf instead");
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void SparseRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshSecondRound()
+{
+  CHECK(not utils::MasterSlave::_slaveMode && not utils::MasterSlave::_masterMode,
+        "RBF mapping is not supported for a participant in master mode, use petrbf instead");
+}
+
+}} // namespace precice, mapping
@@ -3,6 +3,8 @@
 #include "mapping/NearestProjectionMapping.hpp"
 #include "mapping/RadialBasisFctMapping.hpp"
 #include "mapping/PetRadialBasisFctMapping.hpp"
+#include "mapping/SparseRadialBasisFctMapping.hpp"
+#include "mapping/PartitionOfUnityMapping.hpp"
 #include "mapping/impl/BasisFunctions.hpp"
 #include "mesh/config/MeshConfiguration.hpp"
 #include "xml/XMLTag.hpp"
@@ -38,6 +40,19 @@ MappingConfiguration:: MappingConfiguration
   VALUE_PETRBF_CPOLYNOMIAL_C0("petrbf-compact-polynomial-c0"),
   VALUE_PETRBF_CPOLYNOMIAL_C6("petrbf-compact-polynomial-c6"),
 
+  VALUE_SPARSERBF_CTPS_C2("sparserbf-compact-tps-c2"),
+  VALUE_SPARSERBF_CPOLYNOMIAL_C0("sparserbf-compact-polynomial-c0"),
+  VALUE_SPARSERBF_CPOLYNOMIAL_C6("sparserbf-compact-polynomial-c6"),
+
+  VALUE_PUMRBF_TPS("pumrbf-thin-plate-splines"),
+  VALUE_PUMRBF_MULTIQUADRICS("pumrbf-multiquadrics"),
+  VALUE_PUMRBF_INV_MULTIQUADRICS("pumrbf-inverse-multiquadrics"),
+  VALUE_PUMRBF_VOLUME_SPLINES("pumrbf-volume-splines"),
+  VALUE_PUMRBF_GAUSSIAN("pumrbf-gaussian"),
+  VALUE_PUMRBF_CTPS_C2("pumrbf-compact-tps-c2"),
+  VALUE_PUMRBF_CPOLYNOMIAL_C0("pumrbf-compact-polynomial-c0"),
+  VALUE_PUMRBF_CPOLYNOMIAL_C6("pumrbf-compact-polynomial-c6"),
+
   _meshConfig(meshConfiguration)
 {
   assertion (_meshConfig.use_count() > 0);
@@ -68,44 +83,63 @@ MappingConfiguration:: MappingConfiguration
   attrPreallocation.setDocumentation("Sets kind of preallocation for PETSc RBF implementation");
   attrPreallocation.setDefaultValue("tree");
 
+  XMLAttribute<int> attrVerticesPerCluster(ATTR_VERTICES_PER_CLUSTER);
+  attrVerticesPerCluster.setDocumentation("Targeted number of input vertices in each cluster of a partition of unity RBF mapping");
+  attrVerticesPerCluster.setDefaultValue(50);
+  XMLAttribute<double> attrRelativeOverlap(ATTR_RELATIVE_OVERLAP);
+  attrRelativeOverlap.setDocumentation("Overlap of neighboring clusters of a partition of unity RBF mapping, relative to the cluster radius");
+  attrRelativeOverlap.setDefaultValue(0.3);
+
+  XMLAttribute<std::string> attrCacheDirectory(ATTR_CACHE_DIRECTORY);
+  attrCacheDirectory.setDocumentation("Directory to store the mapping matrix in and to reuse it from in later runs with identical meshes. Caching is disabled if empty.");
+  attrCacheDirectory.setDefaultValue("");
+
   XMLTag::Occurrence occ = XMLTag::OCCUR_ARBITRARY;
   std::list<XMLTag> tags;
   {
     XMLTag tag(*this, VALUE_RBF_TPS, occ, TAG);
+    tag.addAttribute(attrCacheDirectory);
     tags.push_back(tag);
   }
   {
     XMLTag tag(*this, VALUE_RBF_MULTIQUADRICS, occ, TAG);
     tag.addAttribute(attrShapeParam);
+    tag.addAttribute(attrCacheDirectory);
     tags.push_back(tag);
   }
   {
     XMLTag tag(*this, VALUE_RBF_INV_MULTIQUADRICS, occ, TAG);
     tag.addAttribute(attrShapeParam);
+    tag.addAttribute(attrCacheDirectory);
     tags.push_back(tag);
   }
   {
     XMLTag tag(*this, VALUE_RBF_VOLUME_SPLINES, occ, TAG);
+    tag.addAttribute(attrCacheDirectory);
     tags.push_back(tag);
   }
   {
     XMLTag tag(*this, VALUE_RBF_GAUSSIAN, occ, TAG);
     tag.addAttribute(attrShapeParam);
+    tag.addAttribute(attrCacheDirectory);
     tags.push_back(tag);
   }
   {
     XMLTag tag(*this, VALUE_RBF_CTPS_C2, occ, TAG);
     tag.addAttribute(attrSupportRadius);
+    tag.addAttribute(attrCacheDirectory);
     tags.push_back(tag);
   }
   {
     XMLTag tag(*this, VALUE_RBF_CPOLYNOMIAL_C0, occ, TAG);
     tag.addAttribute(attrSupportRadius);
+    tag.addAttribute(attrCacheDirectory);
     tags.push_back(tag);
   }
   {
     XMLTag tag(*this, VALUE_RBF_CPOLYNOMIAL_C6, occ, TAG);
     tag.addAttribute(attrSupportRadius);
+    tag.addAttribute(attrCacheDirectory);
     tags.push_back(tag);
   }
   // ---- Petsc RBF declarations ----
@@ -171,6 +205,77 @@ MappingConfiguration:: MappingConfiguration
     tag.addAttribute(attrPreallocation);
     tags.push_back(tag);
   }
+  // ---- Sparse RBF declarations ----
+  {
+    XMLTag tag(*this, VALUE_SPARSERBF_CTPS_C2, occ, TAG);
+    tag.addAttribute(attrSupportRadius);
+    tags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_SPARSERBF_CPOLYNOMIAL_C0, occ, TAG);
+    tag.addAttribute(attrSupportRadius);
+    tags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_SPARSERBF_CPOLYNOMIAL_C6, occ, TAG);
+    tag.addAttribute(attrSupportRadius);
+    tags.push_back(tag);
+  }
+  // ---- Partition of unity RBF declarations ----
+  {
+    XMLTag tag(*this, VALUE_PUMRBF_TPS, occ, TAG);
+    tag.addAttribute(attrVerticesPerCluster);
+    tag.addAttribute(attrRelativeOverlap);
+    tags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_PUMRBF_MULTIQUADRICS, occ, TAG);
+    tag.addAttribute(attrShapeParam);
+    tag.addAttribute(attrVerticesPerCluster);
+    tag.addAttribute(attrRelativeOverlap);
+    tags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_PUMRBF_INV_MULTIQUADRICS, occ, TAG);
+    tag.addAttribute(attrShapeParam);
+    tag.addAttribute(attrVerticesPerCluster);
+    tag.addAttribute(attrRelativeOverlap);
+    tags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_PUMRBF_VOLUME_SPLINES, occ, TAG);
+    tag.addAttribute(attrVerticesPerCluster);
+    tag.addAttribute(attrRelativeOverlap);
+    tags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_PUMRBF_GAUSSIAN, occ, TAG);
+    tag.addAttribute(attrShapeParam);
+    tag.addAttribute(attrVerticesPerCluster);
+    tag.addAttribute(attrRelativeOverlap);
+    tags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_PUMRBF_CTPS_C2, occ, TAG);
+    tag.addAttribute(attrSupportRadius);
+    tag.addAttribute(attrVerticesPerCluster);
+    tag.addAttribute(attrRelativeOverlap);
+    tags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_PUMRBF_CPOLYNOMIAL_C0, occ, TAG);
+    tag.addAttribute(attrSupportRadius);
+    tag.addAttribute(attrVerticesPerCluster);
+    tag.addAttribute(attrRelativeOverlap);
+    tags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_PUMRBF_CPOLYNOMIAL_C6, occ, TAG);
+    tag.addAttribute(attrSupportRadius);
+    tag.addAttribute(attrVerticesPerCluster);
+    tag.addAttribute(attrRelativeOverlap);
+    tags.push_back(tag);
+  }
   // Add tags that only RBF mappings use
   for (XMLTag& tag : tags) {
     tag.addAttribute(attrXDead);
@@ -235,6 +340,9 @@ void MappingConfiguration:: xmlTagCallback
     bool xDead = false, yDead = false, zDead = false;
     Polynomial polynomial = Polynomial::ON;
     Preallocation preallocation = Preallocation::TREE;
+    int verticesPerCluster = 50;
+    double relativeOverlap = 0.3;
+    std::string cacheDirectory;
     
     if (tag.hasAttribute(ATTR_SHAPE_PARAM)){
       shapeParameter = tag.getDoubleAttributeValue(ATTR_SHAPE_PARAM);
@@ -273,12 +381,22 @@ void MappingConfiguration:: xmlTagCallback
         preallocation = Preallocation::TREE;
       else if (strPrealloc == "off")
         preallocation = Preallocation::OFF;
-    }     
-          
+    }
+    if (tag.hasAttribute(ATTR_VERTICES_PER_CLUSTER)){
+      verticesPerCluster = tag.getIntAttributeValue(ATTR_VERTICES_PER_CLUSTER);
+    }
+    if (tag.hasAttribute(ATTR_RELATIVE_OVERLAP)){
+      relativeOverlap = tag.getDoubleAttributeValue(ATTR_RELATIVE_OVERLAP);
+    }
+    if (tag.hasAttribute(ATTR_CACHE_DIRECTORY)){
+      cacheDirectory = tag.getStringAttributeValue(ATTR_CACHE_DIRECTORY);
+    }
+
     ConfiguredMapping configuredMapping = createMapping(dir, type, constraint,
                                                         fromMesh, toMesh, timing,
                                                         shapeParameter, supportRadius, solverRtol,
-                                                        xDead, yDead, zDead, polynomial, preallocation);
+                                                        xDead, yDead, zDead, polynomial, preallocation,
+                                                        verticesPerCluster, relativeOverlap, cacheDirectory);
     checkDuplicates ( configuredMapping );
     _mappings.push_back ( configuredMapping );
   }
@@ -328,7 +446,10 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping
   bool               yDead,
   bool               zDead,
   Polynomial         polynomial,
-  Preallocation      preallocation) const
+  Preallocation      preallocation,
+  int                verticesPerCluster,
+  double             relativeOverlap,
+  const std::string& cacheDirectory) const
 {
   TRACE(direction, type, timing, shapeParameter, supportRadius);
   using namespace mapping;
@@ -386,49 +507,115 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping
   else if (type == VALUE_RBF_TPS){
     configuredMapping.mapping = PtrMapping (
       new RadialBasisFctMapping<ThinPlateSplines>(constraintValue, dimensions, ThinPlateSplines(),
-            xDead, yDead, zDead));
+            xDead, yDead, zDead, cacheDirectory));
   }
   else if (type == VALUE_RBF_MULTIQUADRICS){
     configuredMapping.mapping = PtrMapping (
       new RadialBasisFctMapping<Multiquadrics>(
         constraintValue, dimensions, Multiquadrics(shapeParameter),
-        xDead, yDead, zDead ));
+        xDead, yDead, zDead, cacheDirectory ));
   }
   else if (type == VALUE_RBF_INV_MULTIQUADRICS){
     configuredMapping.mapping = PtrMapping (
       new RadialBasisFctMapping<InverseMultiquadrics>(
         constraintValue, dimensions, InverseMultiquadrics(shapeParameter),
-        xDead, yDead, zDead ));
+        xDead, yDead, zDead, cacheDirectory ));
   }
   else if (type == VALUE_RBF_VOLUME_SPLINES){
     configuredMapping.mapping = PtrMapping (
       new RadialBasisFctMapping<VolumeSplines>(constraintValue, dimensions, VolumeSplines(),
-      xDead, yDead, zDead ));
+      xDead, yDead, zDead, cacheDirectory ));
   }
   else if (type == VALUE_RBF_GAUSSIAN){
     configuredMapping.mapping = PtrMapping(
         new RadialBasisFctMapping<Gaussian>(
           constraintValue, dimensions, Gaussian(shapeParameter),
-          xDead, yDead, zDead));
+          xDead, yDead, zDead, cacheDirectory));
   }
   else if (type == VALUE_RBF_CTPS_C2){
     configuredMapping.mapping = PtrMapping (
       new RadialBasisFctMapping<CompactThinPlateSplinesC2>(
         constraintValue, dimensions, CompactThinPlateSplinesC2(supportRadius),
-        xDead, yDead, zDead ));
+        xDead, yDead, zDead, cacheDirectory ));
   }
   else if (type == VALUE_RBF_CPOLYNOMIAL_C0){
     configuredMapping.mapping = PtrMapping (
       new RadialBasisFctMapping<CompactPolynomialC0>(
         constraintValue, dimensions, CompactPolynomialC0(supportRadius),
-        xDead, yDead, zDead ));
+        xDead, yDead, zDead, cacheDirectory ));
   }
   else if (type == VALUE_RBF_CPOLYNOMIAL_C6){
     configuredMapping.mapping = PtrMapping (
       new RadialBasisFctMapping<CompactPolynomialC6>(
+        constraintValue, dimensions, CompactPolynomialC6(supportRadius),
+        xDead, yDead, zDead, cacheDirectory ));
+  }
+  else if (type == VALUE_SPARSERBF_CTPS_C2){
+    configuredMapping.mapping = PtrMapping (
+      new SparseRadialBasisFctMapping<CompactThinPlateSplinesC2>(
+        constraintValue, dimensions, CompactThinPlateSplinesC2(supportRadius),
+        xDead, yDead, zDead ));
+  }
+  else if (type == VALUE_SPARSERBF_CPOLYNOMIAL_C0){
+    configuredMapping.mapping = PtrMapping (
+      new SparseRadialBasisFctMapping<CompactPolynomialC0>(
+        constraintValue, dimensions, CompactPolynomialC0(supportRadius),
+        xDead, yDead, zDead ));
+  }
+  else if (type == VALUE_SPARSERBF_CPOLYNOMIAL_C6){
+    configuredMapping.mapping = PtrMapping (
+      new SparseRadialBasisFctMapping<CompactPolynomialC6>(
         constraintValue, dimensions, CompactPolynomialC6(supportRadius),
         xDead, yDead, zDead ));
   }
+  else if (type == VALUE_PUMRBF_TPS){
+    configuredMapping.mapping = PtrMapping (
+      new PartitionOfUnityMapping<ThinPlateSplines>(
+        constraintValue, dimensions, ThinPlateSplines(),
+        xDead, yDead, zDead, verticesPerCluster, relativeOverlap ));
+  }
+  else if (type == VALUE_PUMRBF_MULTIQUADRICS){
+    configuredMapping.mapping = PtrMapping (
+      new PartitionOfUnityMapping<Multiquadrics>(
+        constraintValue, dimensions, Multiquadrics(shapeParameter),
+        xDead, yDead, zDead, verticesPerCluster, relativeOverlap ));
+  }
+  else if (type == VALUE_PUMRBF_INV_MULTIQUADRICS){
+    configuredMapping.mapping = PtrMapping (
+      new PartitionOfUnityMapping<InverseMultiquadrics>(
+        constraintValue, dimensions, InverseMultiquadrics(shapeParameter),
+        xDead, yDead, zDead, verticesPerCluster, relativeOverlap ));
+  }
+  else if (type == VALUE_PUMRBF_VOLUME_SPLINES){
+    configuredMapping.mapping = PtrMapping (
+      new PartitionOfUnityMapping<VolumeSplines>(
+        constraintValue, dimensions, VolumeSplines(),
+        xDead, yDead, zDead, verticesPerCluster, relativeOverlap ));
+  }
+  else if (type == VALUE_PUMRBF_GAUSSIAN){
+    configuredMapping.mapping = PtrMapping (
+      new PartitionOfUnityMapping<Gaussian>(
+        constraintValue, dimensions, Gaussian(shapeParameter),
+        xDead, yDead, zDead, verticesPerCluster, relativeOverlap ));
+  }
+  else if (type == VALUE_PUMRBF_CTPS_C2){
+    configuredMapping.mapping = PtrMapping (
+      new PartitionOfUnityMapping<CompactThinPlateSplinesC2>(
+        constraintValue, dimensions, CompactThinPlateSplinesC2(supportRadius),
+        xDead, yDead, zDead, verticesPerCluster, relativeOverlap ));
+  }
+  else if (type == VALUE_PUMRBF_CPOLYNOMIAL_C0){
+    configuredMapping.mapping = PtrMapping (
+      new PartitionOfUnityMapping<CompactPolynomialC0>(
+        constraintValue, dimensions, CompactPolynomialC0(supportRadius),
+        xDead, yDead, zDead, verticesPerCluster, relativeOverlap ));
+  }
+  else if (type == VALUE_PUMRBF_CPOLYNOMIAL_C6){
+    configuredMapping.mapping = PtrMapping (
+      new PartitionOfUnityMapping<CompactPolynomialC6>(
+        constraintValue, dimensions, CompactPolynomialC6(supportRadius),
+        xDead, yDead, zDead, verticesPerCluster, relativeOverlap ));
+  }
 # ifndef PRECICE_NO_PETSC
   else if (type == VALUE_PETRBF_TPS){
     utils::Petsc::initialize(&argc, &argv);
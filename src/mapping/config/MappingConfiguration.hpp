@@ -116,6 +116,9 @@ private:
   const std::string ATTR_X_DEAD = "x-dead";
   const std::string ATTR_Y_DEAD = "y-dead";
   const std::string ATTR_Z_DEAD = "z-dead";
+  const std::string ATTR_VERTICES_PER_CLUSTER = "vertices-per-cluster";
+  const std::string ATTR_RELATIVE_OVERLAP = "relative-overlap";
+  const std::string ATTR_CACHE_DIRECTORY = "cache-directory";
 
   const std::string VALUE_WRITE = "write";
   const std::string VALUE_READ = "read";
@@ -140,6 +143,19 @@ private:
   const std::string VALUE_PETRBF_CTPS_C2;
   const std::string VALUE_PETRBF_CPOLYNOMIAL_C0;
   const std::string VALUE_PETRBF_CPOLYNOMIAL_C6;
+
+  const std::string VALUE_SPARSERBF_CTPS_C2;
+  const std::string VALUE_SPARSERBF_CPOLYNOMIAL_C0;
+  const std::string VALUE_SPARSERBF_CPOLYNOMIAL_C6;
+
+  const std::string VALUE_PUMRBF_TPS;
+  const std::string VALUE_PUMRBF_MULTIQUADRICS;
+  const std::string VALUE_PUMRBF_INV_MULTIQUADRICS;
+  const std::string VALUE_PUMRBF_VOLUME_SPLINES;
+  const std::string VALUE_PUMRBF_GAUSSIAN;
+  const std::string VALUE_PUMRBF_CTPS_C2;
+  const std::string VALUE_PUMRBF_CPOLYNOMIAL_C0;
+  const std::string VALUE_PUMRBF_CPOLYNOMIAL_C6;
   
   const std::string VALUE_TIMING_INITIAL = "initial";
   const std::string VALUE_TIMING_ON_ADVANCE = "onadvance";
@@ -163,7 +179,10 @@ private:
     bool               yDead,
     bool               zDead,
     Polynomial         polynomial,
-    Preallocation      preallocation) const;
+    Preallocation      preallocation,
+    int                verticesPerCluster,
+    double             relativeOverlap,
+    const std::string& cacheDirectory) const;
 
   void checkDuplicates ( const ConfiguredMapping& mapping );
 
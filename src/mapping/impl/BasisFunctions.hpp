@@ -1,6 +1,9 @@
 #pragma once
 
+#include <cmath>
+#include <cstddef>
 #include "logging/Logger.hpp"
+#include "mapping/impl/Hash.hpp"
 #include "math/math.hpp"
 
 namespace precice
@@ -8,6 +11,18 @@ namespace precice
 namespace mapping
 {
 
+/*
+ * Besides evaluate(radius), every basis function offers evaluate(radii, values, n), which
+ * evaluates n radii at once. These loops do not allocate and have no data dependent branches
+ * (only selects). They still call std::exp, std::log or std::sqrt, hence they only vectorize if
+ * the compiler may use vector variants of these: std::sqrt needs -fno-math-errno, std::exp and
+ * std::log a vector math library, e.g., glibc's libmvec with GCC and -ffast-math. radii and values
+ * may be identical, for evaluating in place.
+ *
+ * hashParameters(hash) adds the name of the basis function and all parameters, which influence
+ * its values, to hash. It identifies the basis function in keys of cached mapping matrices.
+ */
+
 /**
  * @brief Radial basis function with global support.
  *
@@ -36,6 +51,21 @@ public:
     }
     return result;
   }
+
+  void evaluate(const double* radii, double* values, size_t n) const
+  {
+    for (size_t i = 0; i < n; i++) {
+      double const radius = radii[i];
+      // Avoids log(0), the selected value is zero anyway
+      double const safeRadius = radius > math::NUMERICAL_ZERO_DIFFERENCE ? radius : 1.0;
+      values[i] = radius > math::NUMERICAL_ZERO_DIFFERENCE ? std::log(safeRadius) * radius * radius : 0.0;
+    }
+  }
+
+  void hashParameters(impl::Hash& hash) const
+  {
+    hash.add(std::string("ThinPlateSplines"));
+  }
 };
 
 /**
@@ -66,6 +96,18 @@ public:
     return std::sqrt(_cPow2 + std::pow(radius, 2));
   }
 
+  void evaluate(const double* radii, double* values, size_t n) const
+  {
+    for (size_t i = 0; i < n; i++)
+      values[i] = std::sqrt(_cPow2 + radii[i] * radii[i]);
+  }
+
+  void hashParameters(impl::Hash& hash) const
+  {
+    hash.add(std::string("Multiquadrics"));
+    hash.add(_cPow2);
+  }
+
 private:
   double _cPow2;
 };
@@ -103,6 +145,18 @@ public:
     return 1.0 / std::sqrt(_cPow2 + std::pow(radius, 2));
   }
 
+  void evaluate(const double* radii, double* values, size_t n) const
+  {
+    for (size_t i = 0; i < n; i++)
+      values[i] = 1.0 / std::sqrt(_cPow2 + radii[i] * radii[i]);
+  }
+
+  void hashParameters(impl::Hash& hash) const
+  {
+    hash.add(std::string("InverseMultiquadrics"));
+    hash.add(_cPow2);
+  }
+
 private:
   logging::Logger _log{"mapping::InverseMultiQuadrics"};
 
@@ -133,6 +187,17 @@ public:
   {
     return std::abs(radius);
   }
+
+  void evaluate(const double* radii, double* values, size_t n) const
+  {
+    for (size_t i = 0; i < n; i++)
+      values[i] = std::abs(radii[i]);
+  }
+
+  void hashParameters(impl::Hash& hash) const
+  {
+    hash.add(std::string("VolumeSplines"));
+  }
 };
 
 /**
@@ -179,6 +244,23 @@ public:
       return std::exp(-std::pow(_shape * radius, 2.0)) - _deltaY;
   }
 
+  void evaluate(const double* radii, double* values, size_t n) const
+  {
+    for (size_t i = 0; i < n; i++) {
+      double const scaled = _shape * radii[i];
+      double const value = std::exp(-scaled * scaled) - _deltaY;
+      values[i] = radii[i] > _supportRadius ? 0.0 : value;
+    }
+  }
+
+  void hashParameters(impl::Hash& hash) const
+  {
+    hash.add(std::string("Gaussian"));
+    hash.add(_shape);
+    hash.add(_supportRadius);
+    hash.add(_deltaY);
+  }
+
 private:
   logging::Logger _log{"mapping::Gaussian"};
 
@@ -234,6 +316,26 @@ public:
     return 1.0 - 30.0 * pow(p, 2.0) - 10.0 * pow(p, 3.0) + 45.0 * pow(p, 4.0) - 6.0 * pow(p, 5.0) - 60.0 * log(pow(p, pow(p, 3.0)));
   }
 
+  void evaluate(const double* radii, double* values, size_t n) const
+  {
+    double const inverseRadius = 1.0 / _r;
+    for (size_t i = 0; i < n; i++) {
+      double const p = radii[i] * inverseRadius;
+      // p^3 * log(p) tends to zero for p -> 0, log(0) is avoided by the select
+      double const safeP = p > 0.0 ? p : 1.0;
+      double const p2 = p * p;
+      double const p3 = p2 * p;
+      double const value = 1.0 + p2 * (-30.0 + p * (-10.0 + p * (45.0 - 6.0 * p))) - 60.0 * p3 * std::log(safeP);
+      values[i] = radii[i] >= _r ? 0.0 : value;
+    }
+  }
+
+  void hashParameters(impl::Hash& hash) const
+  {
+    hash.add(std::string("CompactThinPlateSplinesC2"));
+    hash.add(_r);
+  }
+
 private:
   logging::Logger _log{"mapping::CompactThinPlateSplinesC2"};
 
@@ -277,6 +379,21 @@ public:
     return std::pow(1.0 - radius / _r, 2.0);
   }
 
+  void evaluate(const double* radii, double* values, size_t n) const
+  {
+    double const inverseRadius = 1.0 / _r;
+    for (size_t i = 0; i < n; i++) {
+      double const q = 1.0 - radii[i] * inverseRadius;
+      values[i] = radii[i] >= _r ? 0.0 : q * q;
+    }
+  }
+
+  void hashParameters(impl::Hash& hash) const
+  {
+    hash.add(std::string("CompactPolynomialC0"));
+    hash.add(_r);
+  }
+
 private:
   logging::Logger _log{"mapping::CompactPolynomialC0"};
 
@@ -322,6 +439,24 @@ public:
     return pow(1.0 - p, 8.0) * (32.0 * pow(p, 3.0) + 25.0 * pow(p, 2.0) + 8.0 * p + 1.0);
   }
 
+  void evaluate(const double* radii, double* values, size_t n) const
+  {
+    double const inverseRadius = 1.0 / _r;
+    for (size_t i = 0; i < n; i++) {
+      double const p = radii[i] * inverseRadius;
+      double const q2 = (1.0 - p) * (1.0 - p);
+      double const q4 = q2 * q2;
+      double const value = q4 * q4 * (1.0 + p * (8.0 + p * (25.0 + 32.0 * p)));
+      values[i] = radii[i] >= _r ? 0.0 : value;
+    }
+  }
+
+  void hashParameters(impl::Hash& hash) const
+  {
+    hash.add(std::string("CompactPolynomialC6"));
+    hash.add(_r);
+  }
+
 private:
   logging::Logger _log{"mapping::CompactPolynomialC6"};
 
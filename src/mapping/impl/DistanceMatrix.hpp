@@ -0,0 +1,93 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <cmath>
+#include <vector>
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+/**
+ * @brief Returns the coordinates of the given vertices along all axes, which are not dead.
+ *
+ * The result has one row per vertex and one column per active axis, i.e., every
+ * axis is stored contiguously, which is the layout computeDistances() works on.
+ *
+ * @param[in] indices Vertices to use, all vertices of the mesh if empty
+ */
+inline Eigen::MatrixXd activeCoordinates
+(
+  const mesh::Mesh&        mesh,
+  const std::vector<bool>& deadAxis,
+  const std::vector<int>&  indices = std::vector<int>())
+{
+  int activeDimensions = 0;
+  for (bool dead : deadAxis) {
+    if (not dead)
+      activeDimensions++;
+  }
+  bool const allVertices = indices.empty();
+  Eigen::Index const size = allVertices ? mesh.vertices().size() : indices.size();
+  Eigen::MatrixXd coordinates(size, activeDimensions);
+  for (Eigen::Index i = 0; i < size; i++) {
+    const Eigen::VectorXd& coords = mesh.vertices()[allVertices ? i : indices[i]].getCoords();
+    int k = 0;
+    for (size_t d = 0; d < deadAxis.size(); d++) {
+      if (not deadAxis[d])
+        coordinates(i, k++) = coords[d];
+    }
+  }
+  return coordinates;
+}
+
+/**
+ * @brief Computes the pairwise distances radii(i,j) = |rowPoints.row(i) - colPoints.row(j)|.
+ *
+ * Both point sets are given as returned by activeCoordinates(). The innermost loop runs
+ * along a column of radii and along one axis of rowPoints, which are both contiguous.
+ */
+inline void computeDistances
+(
+  const Eigen::MatrixXd&      rowPoints,
+  const Eigen::MatrixXd&      colPoints,
+  Eigen::Ref<Eigen::MatrixXd> radii)
+{
+  assertion(rowPoints.cols() == colPoints.cols(), rowPoints.cols(), colPoints.cols());
+  assertion(radii.rows() == rowPoints.rows(), radii.rows(), rowPoints.rows());
+  assertion(radii.cols() == colPoints.rows(), radii.cols(), colPoints.rows());
+  Eigen::Index const rows = rowPoints.rows();
+  for (Eigen::Index j = 0; j < colPoints.rows(); j++) {
+    double* radiiCol = radii.col(j).data();
+    for (Eigen::Index i = 0; i < rows; i++)
+      radiiCol[i] = 0.0;
+    for (Eigen::Index d = 0; d < rowPoints.cols(); d++) {
+      const double* axis = rowPoints.col(d).data();
+      double const coord = colPoints(j, d);
+      for (Eigen::Index i = 0; i < rows; i++)
+        radiiCol[i] += (axis[i] - coord) * (axis[i] - coord);
+    }
+    for (Eigen::Index i = 0; i < rows; i++)
+      radiiCol[i] = std::sqrt(radiiCol[i]);
+  }
+}
+
+/// Replaces the radii by the basis function evaluated at them, using the batch evaluation.
+template<typename RADIAL_BASIS_FUNCTION_T>
+void evaluateInPlace
+(
+  const RADIAL_BASIS_FUNCTION_T& basisFunction,
+  Eigen::Ref<Eigen::MatrixXd>    radii)
+{
+  if (radii.outerStride() == radii.rows()) {
+    basisFunction.evaluate(radii.data(), radii.data(), radii.size());
+    return;
+  }
+  for (Eigen::Index j = 0; j < radii.cols(); j++)
+    basisFunction.evaluate(radii.col(j).data(), radii.col(j).data(), radii.rows());
+}
+
+}}} // namespace precice, mapping, impl
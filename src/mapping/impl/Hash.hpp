@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+/**
+ * @brief Incremental hash, used as key of cached matrices.
+ *
+ * Computes two independent 64 bit hashes of the same bytes: value() is a FNV-1a hash and names
+ * the cache file, check() uses a different multiplier and mixing and is stored in the file, s.t.
+ * a collision of value() alone does not lead to using a wrong matrix.
+ */
+class Hash
+{
+public:
+  void add(const void* data, size_t bytes)
+  {
+    const unsigned char* bytePtr = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < bytes; i++) {
+      _value ^= bytePtr[i];
+      _value *= 1099511628211ULL;
+      _check = (_check ^ bytePtr[i]) * 11400714819323198485ULL;
+      _check ^= _check >> 29;
+    }
+  }
+
+  void add(double value)
+  {
+    add(&value, sizeof(value));
+  }
+
+  void add(const std::string& value)
+  {
+    add(static_cast<double>(value.size()));
+    add(value.data(), value.size());
+  }
+
+  std::uint64_t value() const
+  {
+    return _value;
+  }
+
+  std::uint64_t check() const
+  {
+    return _check;
+  }
+
+private:
+  std::uint64_t _value = 14695981039346656037ULL;
+
+  std::uint64_t _check = 6364136223846793005ULL;
+};
+
+}}} // namespace precice, mapping, impl
@@ -0,0 +1,151 @@
+#include "MatrixCache.hpp"
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include "logging/LogMacros.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+namespace {
+
+/// Header of a cache file, directly followed by the matrix entries
+struct FileHeader
+{
+  char          magic[8];
+  std::uint64_t version;
+  std::uint64_t key;
+  std::uint64_t check;
+  std::int64_t  rows;
+  std::int64_t  cols;
+};
+
+const char MAGIC[8] = "PRECICE";
+
+/// Increased, whenever the meaning of the stored matrices changes
+const std::uint64_t VERSION = 1;
+
+}
+
+MatrixCache:: MatrixCache
+(
+  std::string directory)
+:
+  _directory(std::move(directory))
+{}
+
+std::string MatrixCache:: fileName
+(
+  std::uint64_t key) const
+{
+  std::ostringstream name;
+  name << "precice-matrix-" << std::hex << std::setw(16) << std::setfill('0') << key << ".bin";
+  return (boost::filesystem::path(_directory) / name.str()).string();
+}
+
+bool MatrixCache:: load
+(
+  const Hash&   key,
+  Eigen::Index  rows,
+  Eigen::Index  cols)
+{
+  TRACE(key.value(), rows, cols);
+  namespace bi = boost::interprocess;
+  assertion(isEnabled());
+  clear();
+
+  std::string const file = fileName(key.value());
+  boost::system::error_code error;
+  auto const expectedSize = sizeof(FileHeader) + sizeof(double) * rows * cols;
+  if (boost::filesystem::file_size(file, error) != expectedSize or error) {
+    DEBUG("No cached matrix found in " << file);
+    return false;
+  }
+
+  try {
+    bi::file_mapping mapping(file.c_str(), bi::read_only);
+    bi::mapped_region region(mapping, bi::read_only);
+    const FileHeader* header = static_cast<const FileHeader*>(region.get_address());
+    if (not std::equal(MAGIC, MAGIC + sizeof(MAGIC), header->magic) or header->version != VERSION
+        or header->key != key.value() or header->check != key.check()
+        or header->rows != rows or header->cols != cols) {
+      WARN("Ignoring cached matrix " << file << ", it does not match the current mapping.");
+      return false;
+    }
+    _region.swap(region);
+  }
+  catch (const bi::interprocess_exception& exception) {
+    WARN("Could not map cached matrix " << file << ": " << exception.what());
+    return false;
+  }
+  _rows = rows;
+  _cols = cols;
+  DEBUG("Loaded cached matrix from " << file);
+  return true;
+}
+
+void MatrixCache:: store
+(
+  const Hash&            key,
+  const Eigen::MatrixXd& matrix) const
+{
+  TRACE(key.value(), matrix.rows(), matrix.cols());
+  assertion(isEnabled());
+  namespace fs = boost::filesystem;
+
+  boost::system::error_code error;
+  fs::create_directories(_directory, error);
+
+  // Write to a unique temporary file, which is renamed atomically
+  fs::path const file = fileName(key.value());
+  fs::path const tmpFile = fs::path(_directory) / fs::unique_path("precice-matrix-%%%%-%%%%-%%%%.tmp", error);
+  std::ofstream stream(tmpFile.string(), std::ios::binary | std::ios::trunc);
+  if (not stream) {
+    WARN("Could not write cached matrix to directory " << _directory);
+    return;
+  }
+
+  FileHeader header;
+  std::copy(MAGIC, MAGIC + sizeof(MAGIC), header.magic);
+  header.version = VERSION;
+  header.key = key.value();
+  header.check = key.check();
+  header.rows = matrix.rows();
+  header.cols = matrix.cols();
+  stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  stream.write(reinterpret_cast<const char*>(matrix.data()), sizeof(double) * matrix.size());
+  stream.close();
+  if (not stream) {
+    WARN("Could not write cached matrix to " << tmpFile.string());
+    fs::remove(tmpFile, error);
+    return;
+  }
+
+  fs::rename(tmpFile, file, error);
+  if (error) {
+    WARN("Could not write cached matrix to " << file.string() << ": " << error.message());
+    fs::remove(tmpFile, error);
+    return;
+  }
+  DEBUG("Stored matrix in " << file.string());
+}
+
+Eigen::Map<const Eigen::MatrixXd> MatrixCache:: matrix() const
+{
+  assertion(isLoaded());
+  const double* data = reinterpret_cast<const double*>(static_cast<const char*>(_region.get_address()) + sizeof(FileHeader));
+  return Eigen::Map<const Eigen::MatrixXd>(data, _rows, _cols);
+}
+
+void MatrixCache:: clear()
+{
+  boost::interprocess::mapped_region().swap(_region);
+  _rows = 0;
+  _cols = 0;
+}
+
+}}} // namespace precice, mapping, impl
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <cstdint>
+#include <string>
+#include "Hash.hpp"
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+/**
+ * @brief Persists dense matrices across runs.
+ *
+ * Every matrix is stored in its own binary file in the cache directory, named after its key.
+ * The file consists of a small header and the matrix in column-major order, s.t. it can be
+ * memory mapped and used without copying. The header contains both hashes of the key, a file is
+ * only used if both match. Writes go to a temporary file first, which is then
+ * renamed, s.t. concurrent runs never see partially written files.
+ */
+class MatrixCache
+{
+public:
+  explicit MatrixCache(std::string directory);
+
+  /// Returns true, if a directory is set, i.e., caching is enabled.
+  bool isEnabled() const
+  {
+    return not _directory.empty();
+  }
+
+  /// Maps the matrix stored under key into memory, returns false if there is no matching matrix.
+  bool load(const Hash& key, Eigen::Index rows, Eigen::Index cols);
+
+  /// Stores matrix under key, failures are only reported as warnings.
+  void store(const Hash& key, const Eigen::MatrixXd& matrix) const;
+
+  /// Returns the matrix mapped by the last successful load().
+  Eigen::Map<const Eigen::MatrixXd> matrix() const;
+
+  /// Returns true, if a matrix has been loaded.
+  bool isLoaded() const
+  {
+    return _region.get_address() != nullptr;
+  }
+
+  /// Unmaps the loaded matrix.
+  void clear();
+
+private:
+  mutable logging::Logger _log{"mapping::impl::MatrixCache"};
+
+  std::string _directory;
+
+  boost::interprocess::mapped_region _region;
+
+  Eigen::Index _rows = 0;
+
+  Eigen::Index _cols = 0;
+
+  std::string fileName(std::uint64_t key) const;
+};
+
+}}} // namespace precice, mapping, impl
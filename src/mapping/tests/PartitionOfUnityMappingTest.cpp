@@ -0,0 +1,150 @@
+#include "testing/Testing.hpp"
+
+#include "mapping/PartitionOfUnityMapping.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Vertex.hpp"
+
+using namespace precice;
+using namespace precice::mapping;
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(PartitionOfUnityMapping)
+
+namespace {
+
+/// Creates a mesh with pointsPerAxis^dimensions vertices on a regular grid in [offset, offset + 1]^dimensions
+mesh::PtrMesh createGridMesh(const std::string& name, int dimensions, int pointsPerAxis, double offset)
+{
+  mesh::PtrMesh mesh(new mesh::Mesh(name, dimensions, false));
+  mesh->createData("Data", 1);
+  double const h = 1.0 / (pointsPerAxis - 1);
+  int const pointsZ = dimensions == 3 ? pointsPerAxis : 1;
+  for (int i = 0; i < pointsPerAxis; i++) {
+    for (int j = 0; j < pointsPerAxis; j++) {
+      for (int k = 0; k < pointsZ; k++) {
+        Eigen::VectorXd coords(dimensions);
+        coords[0] = offset + i * h;
+        coords[1] = offset + j * h;
+        if (dimensions == 3)
+          coords[2] = offset + k * h;
+        mesh->createVertex(coords);
+      }
+    }
+  }
+  mesh->allocateDataValues();
+  return mesh;
+}
+
+/// Linear function, which every cluster and thus the partition of unity reproduces exactly
+double linearFunction(const Eigen::VectorXd& coords)
+{
+  double value = 1.0 + 2.0 * coords[0] - 3.0 * coords[1];
+  if (coords.size() == 3)
+    value += 0.5 * coords[2];
+  return value;
+}
+
+template<typename RBF_T>
+void testConsistentMapping(int dimensions, RBF_T fct)
+{
+  mesh::PtrMesh inMesh = createGridMesh("InMesh", dimensions, dimensions == 2 ? 20 : 8, 0.0);
+  mesh::PtrMesh outMesh = createGridMesh("OutMesh", dimensions, dimensions == 2 ? 15 : 6, 0.02);
+  mesh::PtrData inData = inMesh->data()[0];
+  mesh::PtrData outData = outMesh->data()[0];
+  for (const mesh::Vertex& vertex : inMesh->vertices())
+    inData->values()[vertex.getID()] = linearFunction(vertex.getCoords());
+
+  mapping::PartitionOfUnityMapping<RBF_T> mapping(Mapping::CONSISTENT, dimensions, fct, false, false, false, 20, 0.3);
+  mapping.setMeshes(inMesh, outMesh);
+  BOOST_TEST(mapping.hasComputedMapping() == false);
+  mapping.computeMapping();
+  BOOST_TEST(mapping.hasComputedMapping());
+  BOOST_TEST(mapping.getNumberOfClusters() > 1);
+  mapping.map(inData->getID(), outData->getID());
+
+  for (const mesh::Vertex& vertex : outMesh->vertices())
+    BOOST_TEST(testing::equals(outData->values()[vertex.getID()], linearFunction(vertex.getCoords()), 1e-6));
+
+  mapping.clear();
+  BOOST_TEST(mapping.hasComputedMapping() == false);
+}
+
+template<typename RBF_T>
+void testConservativeMapping(int dimensions, RBF_T fct)
+{
+  mesh::PtrMesh inMesh = createGridMesh("InMesh", dimensions, dimensions == 2 ? 15 : 6, 0.02);
+  mesh::PtrMesh outMesh = createGridMesh("OutMesh", dimensions, dimensions == 2 ? 20 : 8, 0.0);
+  mesh::PtrData inData = inMesh->data()[0];
+  mesh::PtrData outData = outMesh->data()[0];
+  for (int i = 0; i < inData->values().size(); i++)
+    inData->values()[i] = std::sin(0.3 * i) + 1.0;
+
+  mapping::PartitionOfUnityMapping<RBF_T> mapping(Mapping::CONSERVATIVE, dimensions, fct, false, false, false, 20, 0.3);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  BOOST_TEST(mapping.getNumberOfClusters() > 1);
+  mapping.map(inData->getID(), outData->getID());
+
+  BOOST_TEST(testing::equals(outData->values().sum(), inData->values().sum(), 1e-6));
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(MapThinPlateSplines)
+{
+  ThinPlateSplines fct;
+  testConsistentMapping(2, fct);
+  testConsistentMapping(3, fct);
+  testConservativeMapping(2, fct);
+  testConservativeMapping(3, fct);
+}
+
+BOOST_AUTO_TEST_CASE(MapGaussian)
+{
+  Gaussian fct(20.0);
+  testConsistentMapping(2, fct);
+  testConsistentMapping(3, fct);
+  testConservativeMapping(2, fct);
+  testConservativeMapping(3, fct);
+}
+
+BOOST_AUTO_TEST_CASE(MapCompactPolynomialC6)
+{
+  CompactPolynomialC6 fct(0.5);
+  testConsistentMapping(2, fct);
+  testConservativeMapping(3, fct);
+}
+
+BOOST_AUTO_TEST_CASE(DeadAxis2D)
+{
+  int dimensions = 2;
+
+  ThinPlateSplines fct;
+  mapping::PartitionOfUnityMapping<ThinPlateSplines> mapping(Mapping::CONSISTENT, dimensions, fct, false, true, false, 4, 0.3);
+
+  // Create mesh to map from
+  mesh::PtrMesh inMesh ( new mesh::Mesh("InMesh", dimensions, false) );
+  mesh::PtrData inData = inMesh->createData ( "InData", 1 );
+  for (int i = 0; i < 10; i++)
+    inMesh->createVertex ( Eigen::Vector2d(i, 1.0) );
+  inMesh->allocateDataValues ();
+  for (int i = 0; i < 10; i++)
+    inData->values()[i] = 2.0 * i + 1.0;
+
+  // Create mesh to map to
+  mesh::PtrMesh outMesh ( new mesh::Mesh("OutMesh", dimensions, false) );
+  mesh::PtrData outData = outMesh->createData ( "OutData", 1 );
+  outMesh->createVertex ( Eigen::Vector2d(0.0, 3.0) );
+  outMesh->createVertex ( Eigen::Vector2d(4.5, -2.0) );
+  outMesh->allocateDataValues();
+
+  mapping.setMeshes ( inMesh, outMesh );
+  mapping.computeMapping ();
+  mapping.map ( inData->getID(), outData->getID() );
+  BOOST_TEST ( testing::equals(outData->values()[0], 1.0, 1e-10) );
+  BOOST_TEST ( testing::equals(outData->values()[1], 10.0, 1e-10) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
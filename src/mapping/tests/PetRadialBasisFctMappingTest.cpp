@@ -1401,6 +1401,63 @@ BOOST_AUTO_TEST_CASE(ConservativePolynomialSwitch,
 }
 
 
+/// Maps a vector field with all components at once and compares with mapping each component on its own
+void performVectorMapping(Mapping::Constraint constraint, Polynomial polynomial)
+{
+  using Eigen::Vector2d;
+  int dimensions = 2;
+
+  bool xDead = false, yDead = false, zDead = false;
+  ThinPlateSplines fct;
+  PetRadialBasisFctMapping<ThinPlateSplines> mapping(constraint, dimensions, fct,
+                                                     xDead, yDead, zDead, 1e-9, polynomial);
+
+  // Create mesh to map from, with the vector data and its components as scalar data
+  mesh::PtrMesh inMesh ( new mesh::Mesh("InMesh", dimensions, false) );
+  mesh::PtrData inVector = inMesh->createData ( "InVector", 2 );
+  mesh::PtrData inX = inMesh->createData ( "InX", 1 );
+  mesh::PtrData inY = inMesh->createData ( "InY", 1 );
+  for (int i = 0; i < 6; i++)
+    inMesh->createVertex ( Vector2d(0.4 * i, std::sin(0.7 * i)) );
+  inMesh->allocateDataValues();
+  addGlobalIndex(inMesh);
+  for (int i = 0; i < 6; i++) {
+    inVector->values()(2 * i)     = inX->values()(i) = std::cos(0.3 * i);
+    inVector->values()(2 * i + 1) = inY->values()(i) = 1.0 + 0.5 * i;
+  }
+
+  // Create mesh to map to
+  mesh::PtrMesh outMesh ( new mesh::Mesh("OutMesh", dimensions, false) );
+  mesh::PtrData outVector = outMesh->createData ( "OutVector", 2 );
+  mesh::PtrData outX = outMesh->createData ( "OutX", 1 );
+  mesh::PtrData outY = outMesh->createData ( "OutY", 1 );
+  for (int i = 0; i < 4; i++)
+    outMesh->createVertex ( Vector2d(0.3 + 0.5 * i, 0.5 * std::cos(0.4 * i)) );
+  outMesh->allocateDataValues();
+  addGlobalIndex(outMesh);
+
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inVector->getID(), outVector->getID());
+  mapping.map(inX->getID(), outX->getID());
+  mapping.map(inY->getID(), outY->getID());
+
+  BOOST_TEST(outX->values().norm() > 0.0);
+  for (int i = 0; i < 4; i++) {
+    BOOST_TEST(outVector->values()(2 * i) == outX->values()(i));
+    BOOST_TEST(outVector->values()(2 * i + 1) == outY->values()(i));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MapVectorData,
+                     * boost::unit_test::tolerance(1e-6))
+{
+  performVectorMapping(Mapping::CONSISTENT, Polynomial::ON);
+  performVectorMapping(Mapping::CONSISTENT, Polynomial::SEPARATE);
+  performVectorMapping(Mapping::CONSERVATIVE, Polynomial::ON);
+  performVectorMapping(Mapping::CONSERVATIVE, Polynomial::SEPARATE);
+}
+
 BOOST_AUTO_TEST_CASE(NoMapping)
 {
   /*
@@ -5,6 +5,8 @@
 #include "mesh/Data.hpp"
 #include "mesh/Vertex.hpp"
 #include "math/math.hpp"
+#include <boost/filesystem.hpp>
+#include <fstream>
 
 using namespace precice;
 using namespace precice::mapping;
@@ -243,6 +245,129 @@ BOOST_AUTO_TEST_CASE(DeadAxis3D)
   BOOST_TEST ( outData->values()[3] = 4.3 );
 }
 
+/// Compares the batch evaluation of a basis function to its scalar evaluation
+template<typename RBF_T>
+void performBatchEvaluation(const RBF_T& fct)
+{
+  Eigen::VectorXd radii = Eigen::VectorXd::LinSpaced(41, 0.0, 2.0);
+  Eigen::VectorXd values(radii.size());
+  fct.evaluate(radii.data(), values.data(), radii.size());
+  for (int i = 0; i < radii.size(); i++)
+    BOOST_TEST(testing::equals(values[i], fct.evaluate(radii[i]), 1e-12));
+  // In place
+  fct.evaluate(radii.data(), radii.data(), radii.size());
+  BOOST_TEST(testing::equals(radii, values));
+}
+
+BOOST_AUTO_TEST_CASE(BatchEvaluation)
+{
+  performBatchEvaluation(ThinPlateSplines());
+  performBatchEvaluation(Multiquadrics(0.5));
+  performBatchEvaluation(InverseMultiquadrics(0.5));
+  performBatchEvaluation(VolumeSplines());
+  performBatchEvaluation(Gaussian(2.0));
+  performBatchEvaluation(Gaussian(2.0, 1.0));
+  performBatchEvaluation(CompactThinPlateSplinesC2(1.2));
+  performBatchEvaluation(CompactPolynomialC0(1.2));
+  performBatchEvaluation(CompactPolynomialC6(1.2));
+}
+
+/// Maps vector data once without and twice with cache, the second run has to reuse the stored matrix.
+void performCachedMapping(Mapping::Constraint constraint)
+{
+  namespace fs = boost::filesystem;
+  int dimensions = 2;
+  fs::path cacheDirectory = fs::temp_directory_path() / fs::unique_path("precice-test-%%%%-%%%%");
+
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false));
+  mesh::PtrData inData = inMesh->createData("InData", 2);
+  for (int i = 0; i < 6; i++)
+    inMesh->createVertex(Eigen::Vector2d(0.4 * i, std::sin(0.7 * i)));
+  inMesh->allocateDataValues();
+  for (int i = 0; i < inData->values().size(); i++)
+    inData->values()[i] = std::cos(0.3 * i);
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false));
+  mesh::PtrData outData = outMesh->createData("OutData", 2);
+  for (int i = 0; i < 9; i++)
+    outMesh->createVertex(Eigen::Vector2d(0.25 * i, 0.5 * std::cos(0.4 * i)));
+  outMesh->allocateDataValues();
+
+  Gaussian fct(1.5);
+  Eigen::VectorXd expected;
+  {
+    RadialBasisFctMapping<Gaussian> mapping(constraint, dimensions, fct, false, false, false);
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+    mapping.map(inData->getID(), outData->getID());
+    expected = outData->values();
+  }
+  for (int run = 0; run < 2; run++) {
+    BOOST_TEST(fs::exists(cacheDirectory) == (run == 1));
+    outData->values().setZero();
+    RadialBasisFctMapping<Gaussian> mapping(constraint, dimensions, fct, false, false, false,
+                                            cacheDirectory.string());
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+    BOOST_TEST(mapping.hasComputedMapping());
+    mapping.map(inData->getID(), outData->getID());
+    BOOST_TEST(testing::equals(outData->values(), expected, 1e-10));
+  }
+  fs::remove_all(cacheDirectory);
+}
+
+BOOST_AUTO_TEST_CASE(CachedMappingMatrix)
+{
+  performCachedMapping(Mapping::CONSISTENT);
+  performCachedMapping(Mapping::CONSERVATIVE);
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+std::uint64_t parameterHash(const RADIAL_BASIS_FUNCTION_T& fct)
+{
+  impl::Hash hash;
+  fct.hashParameters(hash);
+  return hash.value();
+}
+
+BOOST_AUTO_TEST_CASE(CacheKeyParameters)
+{
+  BOOST_TEST(parameterHash(Gaussian(1.5)) == parameterHash(Gaussian(1.5)));
+  BOOST_TEST(parameterHash(Gaussian(1.5)) != parameterHash(Gaussian(1.6)));
+  BOOST_TEST(parameterHash(Gaussian(1.5)) != parameterHash(Gaussian(1.5, 1.0)));
+  BOOST_TEST(parameterHash(Multiquadrics(0.5)) != parameterHash(InverseMultiquadrics(0.5)));
+  BOOST_TEST(parameterHash(CompactPolynomialC0(1.2)) != parameterHash(CompactPolynomialC6(1.2)));
+  BOOST_TEST(parameterHash(ThinPlateSplines()) != parameterHash(VolumeSplines()));
+}
+
+/// A cache file is only used if both hashes of the key stored in its header match.
+BOOST_AUTO_TEST_CASE(CacheRejectsMismatchingCheck)
+{
+  namespace fs = boost::filesystem;
+  fs::path cacheDirectory = fs::temp_directory_path() / fs::unique_path("precice-test-%%%%-%%%%");
+  impl::Hash key;
+  key.add(1.0);
+  Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(3, 2);
+
+  impl::MatrixCache cache(cacheDirectory.string());
+  cache.store(key, matrix);
+  BOOST_TEST(cache.load(key, 3, 2));
+  BOOST_TEST(testing::equals(Eigen::MatrixXd(cache.matrix()), matrix));
+  cache.clear();
+
+  // Flip a bit of the stored check hash, which follows magic, version and key
+  fs::path const file = fs::directory_iterator(cacheDirectory)->path();
+  {
+    std::fstream stream(file.string(), std::ios::binary | std::ios::in | std::ios::out);
+    stream.seekg(24);
+    char byte = static_cast<char>(stream.get());
+    stream.seekp(24);
+    stream.put(static_cast<char>(byte ^ 1));
+  }
+  BOOST_TEST(not cache.load(key, 3, 2));
+  fs::remove_all(cacheDirectory);
+}
+
 void perform2DTestConsistentMapping(Mapping& mapping )
 {
   int dimensions = 2;
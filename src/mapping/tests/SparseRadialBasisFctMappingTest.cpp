@@ -0,0 +1,124 @@
+#include "testing/Testing.hpp"
+
+#include "mapping/RadialBasisFctMapping.hpp"
+#include "mapping/SparseRadialBasisFctMapping.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Vertex.hpp"
+
+using namespace precice;
+using namespace precice::mapping;
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(SparseRadialBasisFunctionMapping)
+
+namespace {
+
+/// Creates a mesh with vertices on a regular grid, shifted by offset. Along flatAxis, there is only one layer of vertices.
+mesh::PtrMesh createGridMesh(const std::string& name, int dimensions, int pointsPerAxis,
+                             double spacing, double offset, int flatAxis)
+{
+  mesh::PtrMesh mesh(new mesh::Mesh(name, dimensions, false));
+  mesh->createData("Data", 1);
+  mesh->createData("VectorData", dimensions);
+  Eigen::Vector3i points = Eigen::Vector3i::Constant(pointsPerAxis);
+  if (dimensions == 2)
+    points[2] = 1;
+  if (flatAxis >= 0)
+    points[flatAxis] = 1;
+  for (int i = 0; i < points[0]; i++) {
+    for (int j = 0; j < points[1]; j++) {
+      for (int k = 0; k < points[2]; k++) {
+        Eigen::VectorXd coords(dimensions);
+        coords[0] = offset + i * spacing;
+        coords[1] = 1.5 * offset + j * spacing;
+        if (dimensions == 3)
+          coords[2] = 0.7 * offset + k * spacing;
+        mesh->createVertex(coords);
+      }
+    }
+  }
+  mesh->allocateDataValues();
+  return mesh;
+}
+
+/// Maps the same data with the dense and the sparse RBF implementation and compares the results.
+template<typename RBF_T>
+void compareToDenseMapping(Mapping::Constraint constraint, int dimensions, RBF_T fct,
+                           bool xDead, bool yDead, bool zDead)
+{
+  int flatAxis = -1;
+  if (xDead) flatAxis = 0;
+  if (yDead) flatAxis = 1;
+  if (zDead) flatAxis = 2;
+  mesh::PtrMesh inMesh = createGridMesh("InMesh", dimensions, 5, 0.5, 0.0, flatAxis);
+  mesh::PtrMesh outMesh = createGridMesh("OutMesh", dimensions, 4, 0.6, 0.1, flatAxis);
+
+  for (mesh::PtrData data : inMesh->data()) {
+    for (int i = 0; i < data->values().size(); i++) {
+      data->values()[i] = std::sin(0.7 * i) + 0.1 * i;
+    }
+  }
+
+  RadialBasisFctMapping<RBF_T> denseMapping(constraint, dimensions, fct, xDead, yDead, zDead);
+  SparseRadialBasisFctMapping<RBF_T> sparseMapping(constraint, dimensions, fct, xDead, yDead, zDead);
+
+  for (int d = 0; d < (int) inMesh->data().size(); d++) {
+    int inDataID = inMesh->data()[d]->getID();
+    int outDataID = outMesh->data()[d]->getID();
+
+    denseMapping.setMeshes(inMesh, outMesh);
+    denseMapping.computeMapping();
+    denseMapping.map(inDataID, outDataID);
+    Eigen::VectorXd expected = outMesh->data()[d]->values();
+
+    outMesh->data()[d]->values().setZero();
+    sparseMapping.setMeshes(inMesh, outMesh);
+    BOOST_TEST(sparseMapping.hasComputedMapping() == false);
+    sparseMapping.computeMapping();
+    BOOST_TEST(sparseMapping.hasComputedMapping());
+    sparseMapping.map(inDataID, outDataID);
+    BOOST_TEST(testing::equals(outMesh->data()[d]->values(), expected, 1e-9));
+
+    denseMapping.clear();
+    sparseMapping.clear();
+    BOOST_TEST(sparseMapping.hasComputedMapping() == false);
+  }
+}
+
+template<typename RBF_T>
+void compareToDenseMapping(RBF_T fct)
+{
+  for (Mapping::Constraint constraint : {Mapping::CONSISTENT, Mapping::CONSERVATIVE}) {
+    compareToDenseMapping(constraint, 2, fct, false, false, false);
+    compareToDenseMapping(constraint, 3, fct, false, false, false);
+  }
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(MapThinPlateSplinesC2)
+{
+  compareToDenseMapping(CompactThinPlateSplinesC2(1.2));
+}
+
+BOOST_AUTO_TEST_CASE(MapCompactPolynomialC0)
+{
+  compareToDenseMapping(CompactPolynomialC0(1.2));
+}
+
+BOOST_AUTO_TEST_CASE(MapCompactPolynomialC6)
+{
+  compareToDenseMapping(CompactPolynomialC6(1.2));
+}
+
+BOOST_AUTO_TEST_CASE(DeadAxis)
+{
+  CompactPolynomialC6 fct(1.2);
+  compareToDenseMapping(Mapping::CONSISTENT, 2, fct, false, true, false);
+  compareToDenseMapping(Mapping::CONSISTENT, 3, fct, false, true, false);
+  compareToDenseMapping(Mapping::CONSERVATIVE, 3, fct, true, false, false);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -113,6 +113,17 @@ int Mesh:: getDimensions() const
   return _dimensions;
 }
 
+void Mesh:: reserve
+(
+  int vertexCount,
+  int edgeCount,
+  int triangleCount )
+{
+  _content.vertices().reserve(_content.vertices().size() + vertexCount);
+  _content.edges().reserve(_content.edges().size() + edgeCount);
+  _content.triangles().reserve(_content.triangles().size() + triangleCount);
+}
+
 Edge& Mesh:: createEdge
 (
   Vertex& vertexOne,
@@ -124,6 +124,12 @@ public:
     return *newVertex;
   }
 
+  /// Reserves storage for the given number of additional vertices, edges, and triangles.
+  void reserve (
+    int vertexCount,
+    int edgeCount,
+    int triangleCount );
+
   /**
    * @brief Creates and initializes an Edge object.
    *
@@ -35,6 +35,14 @@ public:
 
   virtual ~Partition() {}
 
+  /**
+   * @brief Prepares communicate() without communicating with the remote participant.
+   *
+   * Can be called while the connection to the remote participant is set up, communicate()
+   * prepares the mesh itself otherwise.
+   */
+  virtual void prepare() {}
+
   /// The mesh is communicated between both master ranks (if required)
   virtual void communicate() = 0;
 
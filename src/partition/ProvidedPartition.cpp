@@ -20,56 +20,64 @@ ProvidedPartition::ProvidedPartition(
 {
 }
 
-void ProvidedPartition::communicate()
+void ProvidedPartition::prepare()
 {
   TRACE();
 
-  //@todo communication to more than one participant
+  if (not _hasToSend || _globalMesh) {
+    return;
+  }
 
-  if (_hasToSend) {
-    Event e1("partition.gatherMesh." + _mesh->getName(), precice::syncMode);
+  Event e1("partition.gatherMesh." + _mesh->getName(), precice::syncMode);
 
-    // Temporary globalMesh such that the master also keeps his local mesh
-    mesh::Mesh globalMesh(_mesh->getName(), _mesh->getDimensions(), _mesh->isFlipNormals());
+  // Separate globalMesh such that the master also keeps his local mesh
+  _globalMesh.reset(new mesh::Mesh(_mesh->getName(), _mesh->getDimensions(), _mesh->isFlipNormals()));
 
-    if (not utils::MasterSlave::_slaveMode) {
-      globalMesh.addMesh(*_mesh); // Add local master mesh to global mesh
-    }
+  if (not utils::MasterSlave::_slaveMode) {
+    _globalMesh->addMesh(*_mesh); // Add local master mesh to global mesh
+  }
 
-    // Gather Mesh
-    INFO("Gather mesh " + _mesh->getName());
-    if (utils::MasterSlave::_slaveMode ) {
-        com::CommunicateMesh(utils::MasterSlave::_communication).sendMesh(*_mesh, 0);
-    }
-    if (utils::MasterSlave::_masterMode)  {
-      assertion(utils::MasterSlave::_rank == 0);
-      assertion(utils::MasterSlave::_size > 1);
+  // Gather Mesh
+  INFO("Gather mesh " + _mesh->getName());
+  if (utils::MasterSlave::_slaveMode ) {
+      com::CommunicateMesh(utils::MasterSlave::_communication).gatherSendMesh(*_mesh, 0);
+  }
+  if (utils::MasterSlave::_masterMode)  {
+    assertion(utils::MasterSlave::_rank == 0);
+    assertion(utils::MasterSlave::_size > 1);
 
-      for (int rankSlave = 1; rankSlave < utils::MasterSlave::_size; rankSlave++) {
-        com::CommunicateMesh(utils::MasterSlave::_communication).receiveMesh(globalMesh, rankSlave);
-        DEBUG("Received sub-mesh, from slave: " << rankSlave << ", global vertexCount: " << globalMesh.vertices().size());
-      }
-    }
-    
-    // Set global index
-    if (not utils::MasterSlave::_slaveMode) {
-      int globalIndex = 0;
-      for (mesh::Vertex &v : globalMesh.vertices()) {
-        v.setGlobalIndex(globalIndex);
-        globalIndex++;
-      }
+    com::CommunicateMesh(utils::MasterSlave::_communication).gatherReceiveMesh(*_globalMesh);
+    DEBUG("Gathered sub-meshes of all slaves, global vertexCount: " << _globalMesh->vertices().size());
+  }
+
+  // Set global index
+  if (not utils::MasterSlave::_slaveMode) {
+    int globalIndex = 0;
+    for (mesh::Vertex &v : _globalMesh->vertices()) {
+      v.setGlobalIndex(globalIndex);
+      globalIndex++;
     }
+  }
+}
+
+void ProvidedPartition::communicate()
+{
+  TRACE();
 
-    e1.stop();
+  //@todo communication to more than one participant
+
+  if (_hasToSend) {
+    prepare();
 
     // Send (global) Mesh
     INFO("Send global mesh " << _mesh->getName());
     Event e2("partition.sendGlobalMesh." + _mesh->getName(), precice::syncMode);
     if (not utils::MasterSlave::_slaveMode) {
-      CHECK(globalMesh.vertices().size() > 0, "The provided mesh " << globalMesh.getName() << " is invalid (possibly empty).");
-      com::CommunicateMesh(_m2n->getMasterCommunication()).sendMesh(globalMesh, 0);
+      CHECK(_globalMesh->vertices().size() > 0, "The provided mesh " << _globalMesh->getName() << " is invalid (possibly empty).");
+      com::CommunicateMesh(_m2n->getMasterCommunication()).sendMesh(*_globalMesh, 0);
     }
     e2.stop();
+    _globalMesh.reset();
 
   } //_hasToSend
 }
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "Partition.hpp"
+#include <memory>
 #include "logging/Logger.hpp"
+#include "mesh/Mesh.hpp"
 
 namespace precice
 {
@@ -23,7 +25,10 @@ public:
 
   virtual ~ProvidedPartition() {}
 
-  /// The mesh is gathered and sent to another participant (if required)
+  /// The mesh is gathered at the master (if required)
+  virtual void prepare() override;
+
+  /// The mesh is gathered, if not prepared yet, and sent to another participant (if required)
   virtual void communicate() override;
 
   /// All distribution data structures are set up.
@@ -36,6 +41,9 @@ private:
   logging::Logger _log{"partition::ProvidedPartition"};
 
   bool _hasToSend;
+
+  /// Mesh gathered by prepare(), which is sent by communicate()
+  std::unique_ptr<mesh::Mesh> _globalMesh;
 };
 
 } // namespace partition
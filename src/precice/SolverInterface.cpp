@@ -232,6 +232,52 @@ void SolverInterface:: setMeshQuadWithEdges
                               fourthVertexID);
 }
 
+void SolverInterface:: setMeshEdges
+(
+  int        meshID,
+  int        size,
+  const int* vertexIDs,
+  int*       edgeIDs )
+{
+  _impl->setMeshEdges(meshID, size, vertexIDs, edgeIDs);
+}
+
+void SolverInterface:: setMeshTriangles
+(
+  int        meshID,
+  int        size,
+  const int* edgeIDs )
+{
+  _impl->setMeshTriangles(meshID, size, edgeIDs);
+}
+
+void SolverInterface:: setMeshTrianglesWithEdges
+(
+  int        meshID,
+  int        size,
+  const int* vertexIDs )
+{
+  _impl->setMeshTrianglesWithEdges(meshID, size, vertexIDs);
+}
+
+void SolverInterface:: setMeshQuads
+(
+  int        meshID,
+  int        size,
+  const int* edgeIDs )
+{
+  _impl->setMeshQuads(meshID, size, edgeIDs);
+}
+
+void SolverInterface:: setMeshQuadsWithEdges
+(
+  int        meshID,
+  int        size,
+  const int* vertexIDs )
+{
+  _impl->setMeshQuadsWithEdges(meshID, size, vertexIDs);
+}
+
 void SolverInterface:: mapReadDataTo
 (
   int toMeshID )
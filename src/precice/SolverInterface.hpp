@@ -43,10 +43,12 @@ namespace PreciceTests {
     struct testThreeSolvers;
     struct testMultiCoupling;
     struct testMappingNearestProjection;
+    struct testBlockMeshFunctions;
   }
   namespace Server {
     struct testCouplingModeWithOneServer;
     struct testCouplingModeParallelWithOneServer;
+    struct testBlockDataAndMappingWithOneServer;
   }
 }
 
@@ -434,6 +436,73 @@ public:
     int thirdVertexID,
     int fourthVertexID );
 
+  /**
+   * @brief Sets several surface mesh edges from vertex IDs.
+   *
+   * @param[in] meshID ID of the mesh on which the edges live
+   * @param[in] size Number of edges
+   * @param[in] vertexIDs Vertex IDs of the edges, format is (e0v0, e0v1, e1v0, e1v1, ...)
+   * @param[out] edgeIDs IDs of the created edges, -1 if the mesh is not required completely
+   */
+  void setMeshEdges (
+    int        meshID,
+    int        size,
+    const int* vertexIDs,
+    int*       edgeIDs );
+
+  /**
+   * @brief Sets several surface mesh triangles from edge IDs.
+   *
+   * @param[in] meshID ID of the mesh on which the triangles live
+   * @param[in] size Number of triangles
+   * @param[in] edgeIDs Edge IDs of the triangles, format is (t0e0, t0e1, t0e2, t1e0, ...)
+   */
+  void setMeshTriangles (
+    int        meshID,
+    int        size,
+    const int* edgeIDs );
+
+  /**
+   * @brief Sets several surface mesh triangles from vertex IDs.
+   *
+   * Missing edges are created on the fly. Contrary to setMeshTriangleWithEdges(), the
+   * existing edges are looked up in a hash map, which is built once per call.
+   *
+   * @param[in] meshID ID of the mesh on which the triangles live
+   * @param[in] size Number of triangles
+   * @param[in] vertexIDs Vertex IDs of the triangles, format is (t0v0, t0v1, t0v2, t1v0, ...)
+   */
+  void setMeshTrianglesWithEdges (
+    int        meshID,
+    int        size,
+    const int* vertexIDs );
+
+  /**
+   * @brief Sets several surface mesh quadrangles from edge IDs.
+   *
+   * @param[in] meshID ID of the mesh on which the quads live
+   * @param[in] size Number of quads
+   * @param[in] edgeIDs Edge IDs of the quads, format is (q0e0, q0e1, q0e2, q0e3, q1e0, ...)
+   */
+  void setMeshQuads (
+    int        meshID,
+    int        size,
+    const int* edgeIDs );
+
+  /**
+   * @brief Sets several surface mesh quadrangles from vertex IDs.
+   *
+   * Missing edges are created on the fly, see setMeshTrianglesWithEdges().
+   *
+   * @param[in] meshID ID of the mesh on which the quads live
+   * @param[in] size Number of quads
+   * @param[in] vertexIDs Vertex IDs of the quads, format is (q0v0, q0v1, q0v2, q0v3, q1v0, ...)
+   */
+  void setMeshQuadsWithEdges (
+    int        meshID,
+    int        size,
+    const int* vertexIDs );
+
   ///@}
 
   ///@name Data Access
@@ -614,8 +683,10 @@ private:
   friend struct PreciceTests::Serial::testThreeSolvers;
   friend struct PreciceTests::Serial::testMultiCoupling;
   friend struct PreciceTests::Serial::testMappingNearestProjection;
+  friend struct PreciceTests::Serial::testBlockMeshFunctions;
   friend struct PreciceTests::Server::testCouplingModeWithOneServer;
   friend struct PreciceTests::Server::testCouplingModeParallelWithOneServer;
+  friend struct PreciceTests::Server::testBlockDataAndMappingWithOneServer;
 
 };
 
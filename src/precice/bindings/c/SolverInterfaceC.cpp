@@ -197,6 +197,57 @@ void precicec_setMeshTriangleWithEdges
   impl->setMeshTriangleWithEdges ( meshID, firstVertexID, secondVertexID, thirdVertexID );
 }
 
+void precicec_setMeshEdges
+(
+  int        meshID,
+  int        size,
+  const int* vertexIDs,
+  int*       edgeIDs )
+{
+  assertion(impl != nullptr);
+  impl->setMeshEdges(meshID, size, vertexIDs, edgeIDs);
+}
+
+void precicec_setMeshTriangles
+(
+  int        meshID,
+  int        size,
+  const int* edgeIDs )
+{
+  assertion(impl != nullptr);
+  impl->setMeshTriangles(meshID, size, edgeIDs);
+}
+
+void precicec_setMeshTrianglesWithEdges
+(
+  int        meshID,
+  int        size,
+  const int* vertexIDs )
+{
+  assertion(impl != nullptr);
+  impl->setMeshTrianglesWithEdges(meshID, size, vertexIDs);
+}
+
+void precicec_setMeshQuads
+(
+  int        meshID,
+  int        size,
+  const int* edgeIDs )
+{
+  assertion(impl != nullptr);
+  impl->setMeshQuads(meshID, size, edgeIDs);
+}
+
+void precicec_setMeshQuadsWithEdges
+(
+  int        meshID,
+  int        size,
+  const int* vertexIDs )
+{
+  assertion(impl != nullptr);
+  impl->setMeshQuadsWithEdges(meshID, size, vertexIDs);
+}
+
 void precicec_writeBlockVectorData
 (
   int     dataID,
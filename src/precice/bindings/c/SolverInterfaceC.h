@@ -131,6 +131,47 @@ void precicec_setMeshTriangleWithEdges (
   int secondVertexID,
   int thirdVertexID );
 
+/**
+ * @brief Sets several edges from pairs of vertex IDs, see precice::SolverInterface::setMeshEdges().
+ */
+void precicec_setMeshEdges (
+  int        meshID,
+  int        size,
+  const int* vertexIDs,
+  int*       edgeIDs );
+
+/**
+ * @brief Sets several triangles from triples of edge IDs.
+ */
+void precicec_setMeshTriangles (
+  int        meshID,
+  int        size,
+  const int* edgeIDs );
+
+/**
+ * @brief Sets several triangles from triples of vertex IDs. Creates missing edges.
+ */
+void precicec_setMeshTrianglesWithEdges (
+  int        meshID,
+  int        size,
+  const int* vertexIDs );
+
+/**
+ * @brief Sets several quads from quadruples of edge IDs.
+ */
+void precicec_setMeshQuads (
+  int        meshID,
+  int        size,
+  const int* edgeIDs );
+
+/**
+ * @brief Sets several quads from quadruples of vertex IDs. Creates missing edges.
+ */
+void precicec_setMeshQuadsWithEdges (
+  int        meshID,
+  int        size,
+  const int* vertexIDs );
+
 /**
  * @brief Writes vector data values given as block.
  *
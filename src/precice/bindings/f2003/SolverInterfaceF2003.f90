@@ -154,6 +154,52 @@ module PreCICE_solver_if_module
       integer(kind=c_int) :: secondEdgeID
       integer(kind=c_int) :: thirdEdgeID
     end subroutine precicef_set_triangle
+
+    subroutine precicef_set_edges(meshID, meshsize, vertexIDs, edgeIDs) &
+      &  bind(c, name='precicef_set_edges_')
+
+      use, intrinsic :: iso_c_binding
+      integer(kind=c_int) :: meshID
+      integer(kind=c_int) :: meshsize
+      integer(kind=c_int) :: vertexIDs(*)
+      integer(kind=c_int) :: edgeIDs(*)
+    end subroutine precicef_set_edges
+
+    subroutine precicef_set_triangles(meshID, meshsize, edgeIDs) &
+      &  bind(c, name='precicef_set_triangles_')
+
+      use, intrinsic :: iso_c_binding
+      integer(kind=c_int) :: meshID
+      integer(kind=c_int) :: meshsize
+      integer(kind=c_int) :: edgeIDs(*)
+    end subroutine precicef_set_triangles
+
+    subroutine precicef_set_triangles_we(meshID, meshsize, vertexIDs) &
+      &  bind(c, name='precicef_set_triangles_we_')
+
+      use, intrinsic :: iso_c_binding
+      integer(kind=c_int) :: meshID
+      integer(kind=c_int) :: meshsize
+      integer(kind=c_int) :: vertexIDs(*)
+    end subroutine precicef_set_triangles_we
+
+    subroutine precicef_set_quads(meshID, meshsize, edgeIDs) &
+      &  bind(c, name='precicef_set_quads_')
+
+      use, intrinsic :: iso_c_binding
+      integer(kind=c_int) :: meshID
+      integer(kind=c_int) :: meshsize
+      integer(kind=c_int) :: edgeIDs(*)
+    end subroutine precicef_set_quads
+
+    subroutine precicef_set_quads_we(meshID, meshsize, vertexIDs) &
+      &  bind(c, name='precicef_set_quads_we_')
+
+      use, intrinsic :: iso_c_binding
+      integer(kind=c_int) :: meshID
+      integer(kind=c_int) :: meshsize
+      integer(kind=c_int) :: vertexIDs(*)
+    end subroutine precicef_set_quads_we
  
     subroutine precicef_read_sdata( dataID, valueIndex, dataValue) &
       &  bind(c, name='precicef_read_sdata_')
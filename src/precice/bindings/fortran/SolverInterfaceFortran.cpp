@@ -257,6 +257,57 @@ void precicef_set_triangle_we_
   impl->setMeshTriangleWithEdges(*meshID, *firstVertexID, *secondVertexID, *thirdVertexID);
 }
 
+void precicef_set_edges_
+(
+  const int* meshID,
+  const int* size,
+  const int* vertexIDs,
+  int*       edgeIDs )
+{
+  CHECK(impl != nullptr,errormsg);
+  impl->setMeshEdges(*meshID, *size, vertexIDs, edgeIDs);
+}
+
+void precicef_set_triangles_
+(
+  const int* meshID,
+  const int* size,
+  const int* edgeIDs )
+{
+  CHECK(impl != nullptr,errormsg);
+  impl->setMeshTriangles(*meshID, *size, edgeIDs);
+}
+
+void precicef_set_triangles_we_
+(
+  const int* meshID,
+  const int* size,
+  const int* vertexIDs )
+{
+  CHECK(impl != nullptr,errormsg);
+  impl->setMeshTrianglesWithEdges(*meshID, *size, vertexIDs);
+}
+
+void precicef_set_quads_
+(
+  const int* meshID,
+  const int* size,
+  const int* edgeIDs )
+{
+  CHECK(impl != nullptr,errormsg);
+  impl->setMeshQuads(*meshID, *size, edgeIDs);
+}
+
+void precicef_set_quads_we_
+(
+  const int* meshID,
+  const int* size,
+  const int* vertexIDs )
+{
+  CHECK(impl != nullptr,errormsg);
+  impl->setMeshQuadsWithEdges(*meshID, *size, vertexIDs);
+}
+
 void precicef_write_bvdata_
 (
   const int* dataID,
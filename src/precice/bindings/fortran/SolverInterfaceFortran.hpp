@@ -307,6 +307,93 @@ void precicef_set_triangle_we_(
   const int* secondVertexID,
   const int* thirdVertexID );
 
+/**
+ * @brief See precice::SolverInterface::setMeshEdges().
+ *
+ * Fortran syntax:
+ * precicef_set_edges(
+ *   INTEGER meshID,
+ *   INTEGER size,
+ *   INTEGER vertexIDs(2*size),
+ *   INTEGER edgeIDs(size) )
+ *
+ * IN:  meshID, size, vertexIDs
+ * OUT: edgeIDs
+ */
+void precicef_set_edges_(
+  const int* meshID,
+  const int* size,
+  const int* vertexIDs,
+  int*       edgeIDs );
+
+/**
+ * @brief See precice::SolverInterface::setMeshTriangles().
+ *
+ * Fortran syntax:
+ * precicef_set_triangles(
+ *   INTEGER meshID,
+ *   INTEGER size,
+ *   INTEGER edgeIDs(3*size) )
+ *
+ * IN:  meshID, size, edgeIDs
+ * OUT: -
+ */
+void precicef_set_triangles_(
+  const int* meshID,
+  const int* size,
+  const int* edgeIDs );
+
+/**
+ * @brief See precice::SolverInterface::setMeshTrianglesWithEdges().
+ *
+ * Fortran syntax:
+ * precicef_set_triangles_we(
+ *   INTEGER meshID,
+ *   INTEGER size,
+ *   INTEGER vertexIDs(3*size) )
+ *
+ * IN:  meshID, size, vertexIDs
+ * OUT: -
+ */
+void precicef_set_triangles_we_(
+  const int* meshID,
+  const int* size,
+  const int* vertexIDs );
+
+/**
+ * @brief See precice::SolverInterface::setMeshQuads().
+ *
+ * Fortran syntax:
+ * precicef_set_quads(
+ *   INTEGER meshID,
+ *   INTEGER size,
+ *   INTEGER edgeIDs(4*size) )
+ *
+ * IN:  meshID, size, edgeIDs
+ * OUT: -
+ */
+void precicef_set_quads_(
+  const int* meshID,
+  const int* size,
+  const int* edgeIDs );
+
+/**
+ * @brief See precice::SolverInterface::setMeshQuadsWithEdges().
+ *
+ * Fortran syntax:
+ * precicef_set_quads_we(
+ *   INTEGER meshID,
+ *   INTEGER size,
+ *   INTEGER vertexIDs(4*size) )
+ *
+ * IN:  meshID, size, vertexIDs
+ * OUT: -
+ */
+void precicef_set_quads_we_(
+  const int* meshID,
+  const int* size,
+  const int* vertexIDs );
+
 /**
  * @brief See precice::SolverInterface::writeBlockVectorData.
  *
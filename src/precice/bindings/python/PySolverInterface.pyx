@@ -1,13 +1,15 @@
+# cython: boundscheck=False
+# Taking the address of the first element of an empty array is fine, preCICE does not access it then.
 from cpython       cimport array
 from libcpp        cimport bool
-from libc.stdlib   cimport free
-from libc.stdlib   cimport malloc
 from libcpp.set    cimport set
 from libcpp.memory cimport shared_ptr
 from libcpp.string cimport string
 from libcpp.memory cimport unique_ptr
 from libcpp.vector cimport vector
 
+import numpy as np
+
 from cpython.version cimport PY_MAJOR_VERSION  # important for determining python version in order to properly normalize string input. See http://docs.cython.org/en/latest/src/tutorial/strings.html#general-notes-about-c-strings and https://github.com/precice/precice/issues/68 . 
 
 cdef bytes convert(s):
@@ -23,6 +25,46 @@ cdef bytes convert(s):
 
 include "PyConstants.pyx"
 
+cdef _doubles (values, int size, name):
+   """
+   Returns values as contiguous array of doubles, contiguous NumPy arrays of doubles are not copied.
+   """
+   array = np.ascontiguousarray(values, dtype=np.double).reshape(-1)
+   if array.size < size:
+      raise ValueError("%s has %d entries, but %d are required." % (name, array.size, size))
+   return array
+
+cdef _ints (values, int size, name):
+   """
+   Returns values as contiguous array of C ints, contiguous NumPy arrays of type intc are not copied.
+   """
+   array = np.ascontiguousarray(values, dtype=np.intc).reshape(-1)
+   if array.size < size:
+      raise ValueError("%s has %d entries, but %d are required." % (name, array.size, size))
+   return array
+
+cdef _output (out, shape, dtype):
+   """
+   Returns out, if preCICE can write to it directly, and a new NumPy array of the given shape otherwise.
+   """
+   size = np.prod(shape, dtype=int)
+   if (isinstance(out, np.ndarray) and out.dtype == dtype and out.size == size
+       and out.flags.c_contiguous and out.flags.writeable):
+      return out
+   return np.empty(shape, dtype=dtype)
+
+cdef _writeBack (out, result):
+   """
+   Copies the result to out, if it could not be written to directly, and returns the result.
+   """
+   if out is None or out is result:
+      return result
+   if isinstance(out, np.ndarray):
+      out[...] = result.reshape(out.shape)
+   else:
+      out[:] = result.reshape(-1).tolist()
+   return result
+
 cdef extern from "./src/precice/SolverInterface.hpp"  namespace "precice":
    cdef cppclass SolverInterface:
       SolverInterface (const string&, int, int) except +
@@ -77,6 +119,16 @@ cdef extern from "./src/precice/SolverInterface.hpp"  namespace "precice":
 
       void setMeshQuadWithEdges (int meshID, int firstVertexID, int secondVertexID, int thirdVertexID, int fourthVertexID)
 
+      void setMeshEdges (int meshID, int size, const int* vertexIDs, int* edgeIDs)
+
+      void setMeshTriangles (int meshID, int size, const int* edgeIDs)
+
+      void setMeshTrianglesWithEdges (int meshID, int size, const int* vertexIDs)
+
+      void setMeshQuads (int meshID, int size, const int* edgeIDs)
+
+      void setMeshQuadsWithEdges (int meshID, int size, const int* vertexIDs)
+
       void mapReadDataTo (int toMeshID)
 
       void mapWriteDataFrom (int fromMeshID)
@@ -180,57 +232,34 @@ cdef class PySolverInterface:
    def getDataID (self, dataName, meshID):
       return self.thisptr.getDataID (convert(dataName), meshID)
 
-   def setMeshVertices (self, meshID, size, positions, ids):
-      cdef int* ids_
-      cdef double* positions_
-      ids_ = <int*> malloc(len(ids) * sizeof(int))
-      positions_ = <double*> malloc(len(positions) * sizeof(double))
-
-      if ids_ is NULL or positions_ is NULL:
-         raise MemoryError()
-      
-      for i in xrange(len(ids)):
-         ids_[i] = ids[i]
-      for i in xrange(len(positions)):
-         positions_[i] = positions[i]
-
-      self.thisptr.setMeshVertices (meshID, size, positions_, ids_)
+   def setMeshVertices (self, meshID, int size, positions, ids=None):
+      """
+      Sets size vertices of the given mesh and returns their IDs as NumPy array.
+      If ids is given, the IDs are written to it as well.
+      """
+      cdef const double[::1] positions_ = _doubles(positions, size * self.getDimensions(), "positions")
+      result = _output(ids, size, np.intc)
+      cdef int[::1] ids_ = result.reshape(-1)
 
-      for i in xrange(len(ids)):
-         ids[i] = ids_[i]
-      for i in xrange(len(positions)):
-         positions[i] = positions_[i]
+      self.thisptr.setMeshVertices (meshID, size, <double*> &positions_[0], &ids_[0])
 
-      free(ids_)
-      free(positions_)
+      return _writeBack(ids, result)
 
    def getMeshVertexSize (self, meshID):
       return self.thisptr.getMeshVertexSize(meshID)
 
-   def getMeshVertexIDsFromPositions (self, meshID, size, positions, ids):
-      cdef int* ids_
-      cdef double* positions_
+   def getMeshVertexIDsFromPositions (self, meshID, int size, positions, ids=None):
+      """
+      Returns the IDs of the vertices at the given positions as NumPy array.
+      If ids is given, the IDs are written to it as well.
+      """
+      cdef const double[::1] positions_ = _doubles(positions, size * self.getDimensions(), "positions")
+      result = _output(ids, size, np.intc)
+      cdef int[::1] ids_ = result.reshape(-1)
 
-      ids_ = <int*> malloc(len(ids) * sizeof(int))
-      positions_ = <double*> malloc(len(positions) * sizeof(double))
+      self.thisptr.getMeshVertexIDsFromPositions (meshID, size, <double*> &positions_[0], &ids_[0])
 
-      if ids_ is NULL or positions_ is NULL:
-         raise MemoryError()
-      
-      for i in xrange(len(ids)):
-         ids_[i] = ids[i]
-      for i in xrange(len(positions)):
-         positions_[i] = positions[i]
-
-      self.thisptr.getMeshVertexIDsFromPositions (meshID, size, positions_, ids_)
-
-      for i in xrange(len(ids)):
-         ids[i] = ids_[i]
-      for i in xrange(len(positions)):
-         positions[i] = positions_[i]
-
-      free(ids_)
-      free(positions_)
+      return _writeBack(ids, result)
 
    def setMeshEdge (self, meshID, firstVertexID, secondVertexID):
       return self.thisptr.setMeshEdge (meshID, firstVertexID, secondVertexID)
@@ -247,147 +276,100 @@ cdef class PySolverInterface:
    def setMeshQuadWithEdges (self, meshID, firstVertexID, secondVertexID, thirdVertexID, fourthVertexID):
       self.thisptr.setMeshQuadWithEdges (meshID, firstVertexID, secondVertexID, thirdVertexID, fourthVertexID)
 
-   def mapReadDataTo (self, toMeshID):
-      self.thisptr.mapReadDataTo (toMeshID)
+   def setMeshEdges (self, meshID, int size, vertexIDs, edgeIDs=None):
+      """
+      Sets size edges given by pairs of vertex IDs and returns the edge IDs as NumPy array.
+      If edgeIDs is given, the IDs are written to it as well.
+      """
+      cdef const int[::1] vertexIDs_ = _ints(vertexIDs, 2 * size, "vertexIDs")
+      result = _output(edgeIDs, size, np.intc)
+      cdef int[::1] edgeIDs_ = result.reshape(-1)
 
-   def mapWriteDataFrom (self, fromMeshID):
-      self.thisptr.mapWriteDataFrom (fromMeshID)
+      self.thisptr.setMeshEdges (meshID, size, &vertexIDs_[0], &edgeIDs_[0])
 
-   def writeBlockVectorData (self, dataID, size, valueIndices, values):
-      cdef int* valueIndices_
-      cdef double* values_
-      valueIndices_ = <int*> malloc(len(valueIndices) * sizeof(int))
-      values_ = <double*> malloc(len(values) * sizeof(double))
+      return _writeBack(edgeIDs, result)
 
-      if valueIndices_ is NULL or values_ is NULL:
-         raise MemoryError()
-      
-      for i in xrange(len(valueIndices)):
-         valueIndices_[i] = valueIndices[i]
-      for i in xrange(len(values)):
-         values_[i] = values[i]
+   def setMeshTriangles (self, meshID, int size, edgeIDs):
+      cdef const int[::1] edgeIDs_ = _ints(edgeIDs, 3 * size, "edgeIDs")
+      self.thisptr.setMeshTriangles (meshID, size, &edgeIDs_[0])
 
-      self.thisptr.writeBlockVectorData (dataID, size, valueIndices_, values_)
+   def setMeshTrianglesWithEdges (self, meshID, int size, vertexIDs):
+      cdef const int[::1] vertexIDs_ = _ints(vertexIDs, 3 * size, "vertexIDs")
+      self.thisptr.setMeshTrianglesWithEdges (meshID, size, &vertexIDs_[0])
 
-      for i in xrange(len(valueIndices)):
-         valueIndices[i] = valueIndices_[i]
-      for i in xrange(len(values)):
-         values[i] = values_[i]
+   def setMeshQuads (self, meshID, int size, edgeIDs):
+      cdef const int[::1] edgeIDs_ = _ints(edgeIDs, 4 * size, "edgeIDs")
+      self.thisptr.setMeshQuads (meshID, size, &edgeIDs_[0])
 
-      free(valueIndices_)
-      free(values_)
-
-   def writeVectorData (self, dataID, valueIndex, value):
-      cdef double* value_
-      value_ = <double*> malloc(len(value) * sizeof(double))
+   def setMeshQuadsWithEdges (self, meshID, int size, vertexIDs):
+      cdef const int[::1] vertexIDs_ = _ints(vertexIDs, 4 * size, "vertexIDs")
+      self.thisptr.setMeshQuadsWithEdges (meshID, size, &vertexIDs_[0])
 
-      if value_ is NULL:
-         raise MemoryError()
-
-      for i in xrange(len(value)):
-         value_[i] = value[i]
-
-      self.thisptr.writeVectorData (dataID, valueIndex, value_)
-
-      for i in xrange(len(value)):
-         value[i] = value_[i]
-
-      free(value_)
-
-   def writeBlockScalarData (self, dataID, size, valueIndices, values):
-      cdef int* valueIndices_
-      cdef double* values_
-      valueIndices_ = <int*> malloc(len(valueIndices) * sizeof(int))
-      values_ = <double*> malloc(len(values) * sizeof(double))
+   def mapReadDataTo (self, toMeshID):
+      self.thisptr.mapReadDataTo (toMeshID)
 
-      if valueIndices_ is NULL or values_ is NULL:
-         raise MemoryError()
-      
-      for i in xrange(len(valueIndices)):
-         valueIndices_[i] = valueIndices[i]
-      for i in xrange(len(values)):
-         values_[i] = values[i]
+   def mapWriteDataFrom (self, fromMeshID):
+      self.thisptr.mapWriteDataFrom (fromMeshID)
 
-      self.thisptr.writeBlockScalarData (dataID, size, valueIndices_, values_)
+   def writeBlockVectorData (self, dataID, int size, valueIndices, values):
+      cdef const int[::1] valueIndices_ = _ints(valueIndices, size, "valueIndices")
+      cdef const double[::1] values_ = _doubles(values, size * self.getDimensions(), "values")
+      self.thisptr.writeBlockVectorData (dataID, size, <int*> &valueIndices_[0], <double*> &values_[0])
 
-      for i in xrange(len(valueIndices)):
-         valueIndices[i] = valueIndices_[i]
-      for i in xrange(len(values)):
-         values[i] = values_[i]
+   def writeVectorData (self, dataID, valueIndex, value):
+      cdef const double[::1] value_ = _doubles(value, self.getDimensions(), "value")
+      self.thisptr.writeVectorData (dataID, valueIndex, &value_[0])
 
-      free(valueIndices_)
-      free(values_)
+   def writeBlockScalarData (self, dataID, int size, valueIndices, values):
+      cdef const int[::1] valueIndices_ = _ints(valueIndices, size, "valueIndices")
+      cdef const double[::1] values_ = _doubles(values, size, "values")
+      self.thisptr.writeBlockScalarData (dataID, size, <int*> &valueIndices_[0], <double*> &values_[0])
 
    def writeScalarData (self, dataID, valueIndex, value):
       self.thisptr.writeScalarData (dataID, valueIndex, value)
 
-   def readBlockVectorData (self, dataID, size, valueIndices, values):
-      cdef int* valueIndices_
-      cdef double* values_
-      valueIndices_ = <int*> malloc(len(valueIndices) * sizeof(int))
-      values_ = <double*> malloc(len(values) * sizeof(double))
-
-      if valueIndices_ is NULL or values_ is NULL:
-         raise MemoryError()
-      
-      for i in xrange(len(valueIndices)):
-         valueIndices_[i] = valueIndices[i]
-      for i in xrange(len(values)):
-         values_[i] = values[i]
-
-      self.thisptr.readBlockVectorData (dataID, size, valueIndices_, values_)
-
-      for i in xrange(len(valueIndices)):
-         valueIndices[i] = valueIndices_[i]
-      for i in xrange(len(values)):
-         values[i] = values_[i]
-
-      free(valueIndices_)
-      free(values_)
-
-   def readVectorData (self, dataID, valueIndex, value):
-      cdef double* value_
-      value_ = <double*> malloc(len(value) * sizeof(double))
-
-      if value_ is NULL:
-         raise MemoryError()
-
-      for i in xrange(len(value)):
-         value_[i] = value[i]
+   def readBlockVectorData (self, dataID, int size, valueIndices, values=None):
+      """
+      Returns the vector values at the given indices as NumPy array of shape (size, dimensions).
+      If values is given, the values are written to it as well.
+      """
+      cdef const int[::1] valueIndices_ = _ints(valueIndices, size, "valueIndices")
+      result = _output(values, (size, self.getDimensions()), np.double)
+      cdef double[::1] values_ = result.reshape(-1)
 
-      self.thisptr.readVectorData (dataID, valueIndex, value_)
+      self.thisptr.readBlockVectorData (dataID, size, <int*> &valueIndices_[0], &values_[0])
 
-      for i in xrange(len(value)):
-         value[i] = value_[i]
+      return _writeBack(values, result)
 
-      free(value_)
+   def readVectorData (self, dataID, valueIndex, value=None):
+      """
+      Returns the vector value at the given index as NumPy array.
+      If value is given, the value is written to it as well.
+      """
+      result = _output(value, self.getDimensions(), np.double)
+      cdef double[::1] value_ = result.reshape(-1)
 
-   def readBlockScalarData (self, dataID, size, valueIndices, values):
-      cdef int* valueIndices_
-      cdef double* values_
-      valueIndices_ = <int*> malloc(len(valueIndices) * sizeof(int))
-      values_ = <double*> malloc(len(values) * sizeof(double))
+      self.thisptr.readVectorData (dataID, valueIndex, &value_[0])
 
-      if valueIndices_ is NULL or values_ is NULL:
-         raise MemoryError()
-      
-      for i in xrange(len(valueIndices)):
-         valueIndices_[i] = valueIndices[i]
-      for i in xrange(len(values)):
-         values_[i] = values[i]
+      return _writeBack(value, result)
 
-      self.thisptr.readBlockScalarData (dataID, size, valueIndices_, values_)
+   def readBlockScalarData (self, dataID, int size, valueIndices, values=None):
+      """
+      Returns the scalar values at the given indices as NumPy array.
+      If values is given, the values are written to it as well.
+      """
+      cdef const int[::1] valueIndices_ = _ints(valueIndices, size, "valueIndices")
+      result = _output(values, size, np.double)
+      cdef double[::1] values_ = result.reshape(-1)
 
-      for i in xrange(len(valueIndices)):
-         valueIndices[i] = valueIndices_[i]
-      for i in xrange(len(values)):
-         values[i] = values_[i]
+      self.thisptr.readBlockScalarData (dataID, size, <int*> &valueIndices_[0], &values_[0])
 
-      free(valueIndices_)
-      free(values_)
+      return _writeBack(values, result)
 
-   def readScalarData (self, int dataID, int valueIndex, double& value):
+   def readScalarData (self, int dataID, int valueIndex):
+      cdef double value = 0.0
       self.thisptr.readScalarData (dataID, valueIndex, value)
+      return value
 
 #   def getMeshHandle (self, meshName):
 #      return self.thisptr.getMeshHandle (meshName)
@@ -1,5 +1,6 @@
 #include "Configuration.hpp"
 #include "xml/XMLAttribute.hpp"
+#include "utils/EventTimings.hpp"
 
 
 namespace precice {
@@ -30,6 +31,19 @@ Configuration:: Configuration()
   attrSyncMode.setDocumentation(doc);
   _tag.addAttribute(attrSyncMode);
 
+  xml::XMLAttribute<double> attrEventsFlushInterval("events-flush-interval");
+  attrEventsFlushInterval.setDefaultValue(0.0);
+  attrEventsFlushInterval.setDocumentation(
+      "If positive, every rank streams its event records to a file while running and writes the "
+      "event statistics every given number of seconds, instead of keeping all records in memory until finalize.");
+  _tag.addAttribute(attrEventsFlushInterval);
+
+  xml::XMLAttribute<bool> attrEventsPerRankDetail("events-per-rank-detail");
+  attrEventsPerRankDetail.setDefaultValue(true);
+  attrEventsPerRankDetail.setDocumentation(
+      "If false, the event timings file only contains statistics aggregated over all ranks and no event log is written.");
+  _tag.addAttribute(attrEventsPerRankDetail);
+
 }
 
 xml::XMLTag& Configuration:: getXMLTag()
@@ -42,6 +56,8 @@ void Configuration::xmlTagCallback(xml::XMLTag& tag)
   TRACE(tag.getName());
   if (tag.getName() == "precice-configuration") {
     precice::syncMode = tag.getBooleanAttributeValue("sync-mode");
+    utils::EventRegistry::instance().setStreaming(tag.getDoubleAttributeValue("events-flush-interval"));
+    utils::EventRegistry::instance().setPerRankDetail(tag.getBooleanAttributeValue("events-per-rank-detail"));
   }
 }
 
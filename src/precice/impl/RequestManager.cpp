@@ -1,14 +1,129 @@
 #include "RequestManager.hpp"
 #include "com/Communication.hpp"
+#include "com/Request.hpp"
 #include "cplscheme/CouplingScheme.hpp"
 #include "precice/impl/SolverInterfaceImpl.hpp"
 #include <algorithm>
+#include <cstring>
+#include <string>
 #include <utility>
 #include <vector>
 
 namespace precice {
 namespace impl {
 
+namespace {
+
+static_assert(sizeof(double) % sizeof(int) == 0, "Doubles cannot be packed into request frames.");
+
+/// Number of ints a double occupies in a request frame
+constexpr int INTS_PER_DOUBLE = sizeof(double) / sizeof(int);
+
+/// Number of buffered ints, from which on requests are sent without waiting for a reply
+constexpr size_t MAX_BUFFERED_REQUESTS_SIZE = 1 << 20;
+
+void pack
+(
+  std::vector<int>& buffer,
+  const int*        values,
+  int               size )
+{
+  buffer.insert(buffer.end(), values, values + size);
+}
+
+void pack
+(
+  std::vector<int>& buffer,
+  int               value )
+{
+  buffer.push_back(value);
+}
+
+void pack
+(
+  std::vector<int>& buffer,
+  const double*     values,
+  int               size )
+{
+  size_t position = buffer.size();
+  buffer.resize(position + size * INTS_PER_DOUBLE);
+  std::memcpy(buffer.data() + position, values, size * sizeof(double));
+}
+
+void pack
+(
+  std::vector<int>& buffer,
+  double            value )
+{
+  pack(buffer, &value, 1);
+}
+
+void pack
+(
+  std::vector<int>&  buffer,
+  const std::string& value )
+{
+  buffer.push_back(value.size());
+  buffer.insert(buffer.end(), value.begin(), value.end());
+}
+
+} // namespace
+
+/// Reads the payload of a request frame in the order it has been packed.
+class RequestManager::FrameReader
+{
+public:
+
+  FrameReader ( const int* begin, const int* end )
+  :
+    _position(begin),
+    _end(end)
+  {}
+
+  int readInt()
+  {
+    int value;
+    read(&value, 1);
+    return value;
+  }
+
+  double readDouble()
+  {
+    double value;
+    read(&value, 1);
+    return value;
+  }
+
+  std::string readString()
+  {
+    int size = readInt();
+    assertion(_position + size <= _end, size);
+    std::string value(_position, _position + size);
+    _position += size;
+    return value;
+  }
+
+  void read ( int* values, int size )
+  {
+    assertion(_position + size <= _end, size);
+    std::copy(_position, _position + size, values);
+    _position += size;
+  }
+
+  void read ( double* values, int size )
+  {
+    assertion(_position + size * INTS_PER_DOUBLE <= _end, size);
+    std::memcpy(values, _position, size * sizeof(double));
+    _position += size * INTS_PER_DOUBLE;
+  }
+
+private:
+
+  const int* _position;
+
+  const int* _end;
+};
+
 RequestManager:: RequestManager
 (
   SolverInterfaceImpl&  solverInterfaceImpl,
@@ -24,227 +139,239 @@ void RequestManager:: handleRequests()
 {
   TRACE();
   int clientCommSize = _com->getRemoteCommunicatorSize();
-  int clientCounter = 0;
-  std::list<int> clientRanks;
   DEBUG("ClientCommSize " << clientCommSize);
 
+  // Every client announces a batch of request frames by its size
   std::vector<com::PtrRequest> requests(clientCommSize);
-  std::vector<int> requestIDs(clientCommSize,-1);
-
+  std::vector<int> batchSizes(clientCommSize, -1);
   for(int clientRank = 0; clientRank<clientCommSize; clientRank++){
-     requests[clientRank] = _com->aReceive(requestIDs[clientRank], clientRank);
+     requests[clientRank] = _com->aReceive(batchSizes[clientRank], clientRank);
   }
 
-  int rankSender = 0;
-  int requestID = -1;
-  bool collectiveRequest = false;
-  bool singleRequest = false;
+  // Clients which issued a collective request, they are not listened to until all clients did
+  std::list<int> clientRanks;
+  int collectiveRequestID = -1;
+  std::vector<std::vector<int>> collectivePayloads(clientCommSize);
+  std::vector<int> batch;
   while(true){
-    if((std::find(clientRanks.begin(), clientRanks.end(), rankSender) == clientRanks.end()) &&
-       requests[rankSender]->test()){
-      requestID = requestIDs[rankSender];
-      CHECK(requestID != -1, "Receiving of request ID failed");
+    int rankSender = static_cast<int>(com::Request::waitAny(requests));
+    requests[rankSender].reset();
+    CHECK(batchSizes[rankSender] > 0, "Receiving of requests failed");
+    batch.resize(batchSizes[rankSender]);
+    _com->receive(batch.data(), batch.size(), rankSender);
+    DEBUG("Received " << batch.size() << " request values from rank " << rankSender);
+
+    bool collectiveRequest = false;
+    const int* position = batch.data();
+    const int* end = batch.data() + batch.size();
+    while (position != end){
+      // A frame consists of request ID, payload size and payload
+      int requestID = position[0];
+      const int* payload = position + 2;
+      position = payload + position[1];
+      assertion(position <= end);
       DEBUG("Received request ID " << requestID << " from rank " << rankSender);
+
+      switch (requestID){
+      case REQUEST_INITIALIZE:
+      case REQUEST_INITIALIZE_DATA:
+      case REQUEST_ADVANCE:
+      case REQUEST_FINALIZE:
+      case REQUEST_MAP_WRITE_DATA_FROM:
+      case REQUEST_MAP_READ_DATA_TO:
+        DEBUG("Collective request " << requestID << " by rank " << rankSender);
+        assertion(position == end, "A collective request has to be the last one of a batch");
+        CHECK(clientRanks.empty() || requestID == collectiveRequestID,
+              "Processes issued different collective requests (" << requestID << " and "
+              << collectiveRequestID << ") to the server!");
+        collectiveRequestID = requestID;
+        collectivePayloads[rankSender].assign(payload, position);
+        clientRanks.push_front(rankSender);
+        collectiveRequest = true;
+        break;
+      default: {
+        FrameReader frame(payload, position);
+        handleRequest(requestID, rankSender, frame);
+        break;
+      }
+      }
     }
-    else{
-      rankSender++;
-      if(rankSender==clientCommSize) rankSender = 0;
+
+    if (not collectiveRequest){
+      requests[rankSender] = _com->aReceive(batchSizes[rankSender], rankSender);
+      continue;
+    }
+    assertion(clientRanks.size() <= static_cast<size_t>(clientCommSize), clientRanks.size(), clientCommSize);
+    if (clientRanks.size() < static_cast<size_t>(clientCommSize)){
       continue;
     }
 
-    switch (requestID){
+    switch (collectiveRequestID){
     case REQUEST_INITIALIZE:
-      DEBUG("Request initialize by rank " << rankSender);
-      clientCounter++;
-      assertion(clientCounter <= clientCommSize, clientCounter, clientCommSize);
-      clientRanks.push_front(rankSender);
-      if (clientCounter == clientCommSize){
-        handleRequestInitialze(clientRanks);
-        collectiveRequest = true;
-      }
+      handleRequestInitialze(clientRanks);
       break;
     case REQUEST_INITIALIZE_DATA:
-      DEBUG("Request initialize data by rank " << rankSender);
-      clientCounter++;
-      assertion(clientCounter <= clientCommSize, clientCounter, clientCommSize);
-      clientRanks.push_front(rankSender);
-      if (clientCounter == clientCommSize){
-        handleRequestInitialzeData(clientRanks);
-        collectiveRequest = true;
-      }
+      handleRequestInitialzeData(clientRanks);
       break;
     case REQUEST_ADVANCE:
-      DEBUG("Request advance by rank " << rankSender);
-      clientCounter++;
-      assertion(clientCounter <= clientCommSize, clientCounter, clientCommSize);
-      clientRanks.push_front(rankSender);
-      if (clientCounter == clientCommSize){
-        handleRequestAdvance(clientRanks);
-        collectiveRequest = true;
-      }
+      handleRequestAdvance(clientRanks, collectivePayloads);
       break;
     case REQUEST_FINALIZE:
-      DEBUG("Request finalize by rank " << rankSender);
-      clientCounter++;
-      assertion(clientCounter <= clientCommSize, clientCounter, clientCommSize);
-      clientRanks.push_front(rankSender);
-      if (clientCounter == clientCommSize){
-        handleRequestFinalize();
-        clientCounter = 0;
-        clientRanks.clear();
-        return;
-      }
-      break;
-    case REQUEST_FULFILLED_ACTION:
-      handleRequestFulfilledAction(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_SET_MESH_VERTEX:
-      handleRequestSetMeshVertex(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_GET_MESH_VERTEX_SIZE:
-      handleRequestGetMeshVertexSize(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_RESET_MESH:
-      handleRequestResetMesh(rankSender);
-      break;
-    case REQUEST_SET_MESH_VERTICES:
-      handleRequestSetMeshVertices(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_GET_MESH_VERTICES:
-      handleRequestGetMeshVertices(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_GET_MESH_VERTEX_IDS_FROM_POSITIONS:
-      handleRequestGetMeshVertexIDsFromPositions(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_SET_MESH_EDGE:
-      handleRequestSetMeshEdge(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_SET_MESH_TRIANGLE:
-      handleRequestSetMeshTriangle(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_SET_MESH_TRIANGLE_WITH_EDGES:
-      handleRequestSetMeshTriangleWithEdges(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_SET_MESH_QUAD:
-      handleRequestSetMeshQuad(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_SET_MESH_QUAD_WITH_EDGES:
-      handleRequestSetMeshQuadWithEdges(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_WRITE_BLOCK_SCALAR_DATA:
-      handleRequestWriteBlockScalarData(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_WRITE_SCALAR_DATA:
-      handleRequestWriteScalarData(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_WRITE_BLOCK_VECTOR_DATA:
-      handleRequestWriteBlockVectorData(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_WRITE_VECTOR_DATA:
-      handleRequestWriteVectorData(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_READ_BLOCK_SCALAR_DATA:
-      handleRequestReadBlockScalarData(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_READ_SCALAR_DATA:
-      handleRequestReadScalarData(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_READ_VETOR_DATA:
-      handleRequestReadVectorData(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_READ_BLOCK_VECTOR_DATA:
-      handleRequestReadBlockVectorData(rankSender);
-      singleRequest = true;
-      break;
+      handleRequestFinalize();
+      return;
     case REQUEST_MAP_WRITE_DATA_FROM:
-      DEBUG("Request map written data by rank " << rankSender);
-      clientCounter++;
-      assertion(clientCounter <= clientCommSize, clientCounter, clientCommSize);
-      clientRanks.push_front(rankSender);
-      if (clientCounter == clientCommSize){
-        handleRequestMapWriteDataFrom(clientRanks);
-        collectiveRequest = true;
-      }
+      handleRequestMapWriteDataFrom(clientRanks, collectivePayloads);
       break;
     case REQUEST_MAP_READ_DATA_TO:
-      DEBUG("Request map read data by rank " << rankSender);
-      clientCounter++;
-      assertion(clientCounter <= clientCommSize, clientCounter, clientCommSize);
-      clientRanks.push_front(rankSender);
-      if (clientCounter == clientCommSize){
-        handleRequestMapReadDataTo(clientRanks);
-        collectiveRequest = true;
-      }
-      break;
-    case REQUEST_PING:
-      //bool ping = true;
-      _com->send(true, rankSender);
-      singleRequest = true;
+      handleRequestMapReadDataTo(clientRanks, collectivePayloads);
       break;
     default:
-      ERROR("Unknown RequestID \"" << requestID << "\"");
-      break;
+      assertion(false, collectiveRequestID);
     }
 
-    // open receive again and clean up
-    if(singleRequest){
-      requestIDs[rankSender] = -1;
-      requests[rankSender] = _com->aReceive(requestIDs[rankSender], rankSender);
-      singleRequest = false;
-    }
-    else if(collectiveRequest){
-      assertion(clientRanks.size()== static_cast<size_t>(clientCommSize));
-      for(int rank : clientRanks){
-        requests[rank] = _com->aReceive(requestIDs[rank], rank);
-      }
-      clientCounter = 0;
-      clientRanks.clear();
-      collectiveRequest = false;
+    // open receives again and clean up
+    for(int rank : clientRanks){
+      requests[rank] = _com->aReceive(batchSizes[rank], rank);
     }
+    clientRanks.clear();
+    collectiveRequestID = -1;
+  }
+}
 
-    requestID = -1;
+void RequestManager:: handleRequest
+(
+  int          requestID,
+  int          rankSender,
+  FrameReader& frame )
+{
+  switch (requestID){
+  case REQUEST_FULFILLED_ACTION:
+    handleRequestFulfilledAction(frame);
+    break;
+  case REQUEST_SET_MESH_VERTEX:
+    handleRequestSetMeshVertex(rankSender, frame);
+    break;
+  case REQUEST_GET_MESH_VERTEX_SIZE:
+    handleRequestGetMeshVertexSize(rankSender, frame);
+    break;
+  case REQUEST_RESET_MESH:
+    handleRequestResetMesh(frame);
+    break;
+  case REQUEST_SET_MESH_VERTICES:
+    handleRequestSetMeshVertices(rankSender, frame);
+    break;
+  case REQUEST_GET_MESH_VERTICES:
+    handleRequestGetMeshVertices(rankSender, frame);
+    break;
+  case REQUEST_GET_MESH_VERTEX_IDS_FROM_POSITIONS:
+    handleRequestGetMeshVertexIDsFromPositions(rankSender, frame);
+    break;
+  case REQUEST_SET_MESH_EDGE:
+    handleRequestSetMeshEdge(rankSender, frame);
+    break;
+  case REQUEST_SET_MESH_TRIANGLE:
+    handleRequestSetMeshTriangle(frame);
+    break;
+  case REQUEST_SET_MESH_TRIANGLE_WITH_EDGES:
+    handleRequestSetMeshTriangleWithEdges(frame);
+    break;
+  case REQUEST_SET_MESH_QUAD:
+    handleRequestSetMeshQuad(frame);
+    break;
+  case REQUEST_SET_MESH_QUAD_WITH_EDGES:
+    handleRequestSetMeshQuadWithEdges(frame);
+    break;
+  case REQUEST_SET_MESH_EDGES:
+    handleRequestSetMeshEdges(rankSender, frame);
+    break;
+  case REQUEST_SET_MESH_TRIANGLES:
+  case REQUEST_SET_MESH_TRIANGLES_WITH_EDGES:
+  case REQUEST_SET_MESH_QUADS:
+  case REQUEST_SET_MESH_QUADS_WITH_EDGES:
+    handleRequestSetMeshElements(requestID, frame);
+    break;
+  case REQUEST_WRITE_BLOCK_SCALAR_DATA:
+    handleRequestWriteBlockScalarData(frame);
+    break;
+  case REQUEST_WRITE_SCALAR_DATA:
+    handleRequestWriteScalarData(frame);
+    break;
+  case REQUEST_WRITE_BLOCK_VECTOR_DATA:
+    handleRequestWriteBlockVectorData(frame);
+    break;
+  case REQUEST_WRITE_VECTOR_DATA:
+    handleRequestWriteVectorData(frame);
+    break;
+  case REQUEST_READ_BLOCK_SCALAR_DATA:
+    handleRequestReadBlockScalarData(rankSender, frame);
+    break;
+  case REQUEST_READ_SCALAR_DATA:
+    handleRequestReadScalarData(rankSender, frame);
+    break;
+  case REQUEST_READ_VETOR_DATA:
+    handleRequestReadVectorData(rankSender, frame);
+    break;
+  case REQUEST_READ_BLOCK_VECTOR_DATA:
+    handleRequestReadBlockVectorData(rankSender, frame);
+    break;
+  case REQUEST_PING:
+    _com->send(true, rankSender);
+    break;
+  default:
+    ERROR("Unknown RequestID \"" << requestID << "\"");
+    break;
+  }
+}
+
+void RequestManager:: beginRequest
+(
+  Request requestID )
+{
+  _requestStart = _requestBuffer.size();
+  _requestBuffer.push_back(requestID);
+  _requestBuffer.push_back(0); // Payload size, set by endRequest()
+}
 
-    rankSender++;
-    if(rankSender==clientCommSize) rankSender = 0;
+void RequestManager:: endRequest
+(
+  bool flush )
+{
+  _requestBuffer[_requestStart + 1] = _requestBuffer.size() - _requestStart - 2;
+  if (flush || _requestBuffer.size() >= MAX_BUFFERED_REQUESTS_SIZE){
+    sendRequests();
   }
 }
+
+void RequestManager:: sendRequests()
+{
+  TRACE(_requestBuffer.size());
+  _com->send(static_cast<int>(_requestBuffer.size()), 0);
+  _com->send(_requestBuffer.data(), _requestBuffer.size(), 0);
+  _requestBuffer.clear();
+}
+
 void RequestManager:: requestPing()
 {
   TRACE();
-  _com->send(REQUEST_PING, 0);
-  int dummy = 0;
-  _com->receive(dummy, 0);
+  beginRequest(REQUEST_PING);
+  endRequest(true);
+  bool pong = false;
+  _com->receive(pong, 0);
 }
 
 void RequestManager:: requestInitialize()
 {
   TRACE();
-  _com->send(REQUEST_INITIALIZE, 0);
+  beginRequest(REQUEST_INITIALIZE);
+  endRequest(true);
   _couplingScheme->receiveState(_com, 0);
 }
 
 void RequestManager:: requestInitialzeData()
 {
   TRACE();
-  _com->send(REQUEST_INITIALIZE_DATA, 0);
+  beginRequest(REQUEST_INITIALIZE_DATA);
+  endRequest(true);
   _couplingScheme->receiveState(_com, 0);
 }
 
@@ -253,15 +380,17 @@ void RequestManager:: requestAdvance
   double dt )
 {
   TRACE();
-  _com->send(REQUEST_ADVANCE, 0);
-  _com->send(dt, 0);
+  beginRequest(REQUEST_ADVANCE);
+  pack(_requestBuffer, dt);
+  endRequest(true);
   _couplingScheme->receiveState(_com, 0);
 }
 
 void RequestManager:: requestFinalize()
 {
   TRACE();
-  _com->send(REQUEST_FINALIZE, 0);
+  beginRequest(REQUEST_FINALIZE);
+  endRequest(true);
 }
 
 
@@ -270,8 +399,9 @@ void RequestManager:: requestFulfilledAction
   const std::string& action )
 {
   TRACE();
-  _com->send(REQUEST_FULFILLED_ACTION, 0);
-  _com->send(action, 0);
+  beginRequest(REQUEST_FULFILLED_ACTION);
+  pack(_requestBuffer, action);
+  endRequest(false);
 }
 
 int RequestManager:: requestSetMeshVertex
@@ -280,9 +410,10 @@ int RequestManager:: requestSetMeshVertex
   Eigen::VectorXd& position )
 {
   TRACE();
-  _com->send(REQUEST_SET_MESH_VERTEX, 0);
-  _com->send(meshID, 0);
-  _com->send(position.data(), position.size(), 0);
+  beginRequest(REQUEST_SET_MESH_VERTEX);
+  pack(_requestBuffer, meshID);
+  pack(_requestBuffer, position.data(), position.size());
+  endRequest(true);
   int index = -1;
   _com->receive(index, 0);
   return index;
@@ -293,8 +424,9 @@ int RequestManager:: requestGetMeshVertexSize
   int meshID )
 {
   TRACE(meshID);
-  _com->send(REQUEST_GET_MESH_VERTEX_SIZE, 0);
-  _com->send(meshID, 0);
+  beginRequest(REQUEST_GET_MESH_VERTEX_SIZE);
+  pack(_requestBuffer, meshID);
+  endRequest(true);
   int size = -1;
   _com->receive(size, 0);
   return size;
@@ -305,8 +437,9 @@ void RequestManager:: requestResetMesh
   int meshID )
 {
   TRACE(meshID);
-  _com->send(REQUEST_RESET_MESH, 0);
-  _com->send(meshID, 0);
+  beginRequest(REQUEST_RESET_MESH);
+  pack(_requestBuffer, meshID);
+  endRequest(false);
 }
 
 void RequestManager:: requestSetMeshVertices
@@ -317,10 +450,11 @@ void RequestManager:: requestSetMeshVertices
   int*    ids )
 {
   TRACE();
-  _com->send(REQUEST_SET_MESH_VERTICES, 0);
-  _com->send(meshID, 0);
-  _com->send(size, 0);
-  _com->send(positions, size*_interface.getDimensions(), 0);
+  beginRequest(REQUEST_SET_MESH_VERTICES);
+  int data[2] = {meshID, size};
+  pack(_requestBuffer, data, 2);
+  pack(_requestBuffer, positions, size*_interface.getDimensions());
+  endRequest(true);
   _com->receive(ids, size, 0);
 }
 
@@ -332,10 +466,11 @@ void RequestManager:: requestGetMeshVertices
   double* positions )
 {
   TRACE();
-  _com->send(REQUEST_GET_MESH_VERTICES, 0);
-  _com->send(meshID, 0);
-  _com->send(size, 0);
-  _com->send(ids, size, 0);
+  beginRequest(REQUEST_GET_MESH_VERTICES);
+  int data[2] = {meshID, size};
+  pack(_requestBuffer, data, 2);
+  pack(_requestBuffer, ids, size);
+  endRequest(true);
   _com->receive(positions, size*_interface.getDimensions(), 0);
 }
 
@@ -347,10 +482,11 @@ void RequestManager:: requestGetMeshVertexIDsFromPositions
   int*    ids )
 {
   TRACE(size);
-  _com->send(REQUEST_GET_MESH_VERTEX_IDS_FROM_POSITIONS, 0);
-  _com->send(meshID, 0);
-  _com->send(size, 0);
-  _com->send(positions, size*_interface.getDimensions(), 0);
+  beginRequest(REQUEST_GET_MESH_VERTEX_IDS_FROM_POSITIONS);
+  int data[2] = {meshID, size};
+  pack(_requestBuffer, data, 2);
+  pack(_requestBuffer, positions, size*_interface.getDimensions());
+  endRequest(true);
   _com->receive(ids, size, 0);
 }
 
@@ -362,9 +498,10 @@ int RequestManager:: requestSetMeshEdge
   int secondVertexID )
 {
   TRACE(meshID, firstVertexID, secondVertexID);
-  _com->send(REQUEST_SET_MESH_EDGE, 0);
+  beginRequest(REQUEST_SET_MESH_EDGE);
   int data[3] = { meshID, firstVertexID, secondVertexID };
-  _com->send(data, 3, 0);
+  pack(_requestBuffer, data, 3);
+  endRequest(true);
   int createdEdgeID = -1;
   _com->receive(createdEdgeID, 0);
   return createdEdgeID;
@@ -378,9 +515,10 @@ void RequestManager:: requestSetMeshTriangle
   int thirdEdgeID )
 {
   TRACE(meshID, firstEdgeID, secondEdgeID, thirdEdgeID);
-  _com->send(REQUEST_SET_MESH_TRIANGLE, 0);
+  beginRequest(REQUEST_SET_MESH_TRIANGLE);
   int data[4] = {meshID, firstEdgeID, secondEdgeID, thirdEdgeID};
-  _com->send(data, 4, 0);
+  pack(_requestBuffer, data, 4);
+  endRequest(false);
 }
 
 void RequestManager:: requestSetMeshTriangleWithEdges
@@ -392,9 +530,10 @@ void RequestManager:: requestSetMeshTriangleWithEdges
 {
   TRACE(meshID, firstVertexID,
                 secondVertexID, thirdVertexID);
-  _com->send(REQUEST_SET_MESH_TRIANGLE_WITH_EDGES, 0);
+  beginRequest(REQUEST_SET_MESH_TRIANGLE_WITH_EDGES);
   int data[4] = {meshID, firstVertexID, secondVertexID, thirdVertexID};
-  _com->send(data, 4, 0);
+  pack(_requestBuffer, data, 4);
+  endRequest(false);
 }
 
 void RequestManager:: requestSetMeshQuad
@@ -406,9 +545,10 @@ void RequestManager:: requestSetMeshQuad
   int fourthEdgeID )
 {
   TRACE(meshID, firstEdgeID, secondEdgeID, thirdEdgeID, fourthEdgeID);
-  _com->send(REQUEST_SET_MESH_QUAD, 0);
+  beginRequest(REQUEST_SET_MESH_QUAD);
   int data[5] = {meshID, firstEdgeID, secondEdgeID, thirdEdgeID, fourthEdgeID};
-  _com->send(data, 5, 0);
+  pack(_requestBuffer, data, 5);
+  endRequest(false);
 }
 
 void RequestManager:: requestSetMeshQuadWithEdges
@@ -420,9 +560,82 @@ void RequestManager:: requestSetMeshQuadWithEdges
   int fourthVertexID )
 {
   TRACE(meshID, firstVertexID, secondVertexID, thirdVertexID, fourthVertexID);
-  _com->send(REQUEST_SET_MESH_QUAD_WITH_EDGES, 0);
+  beginRequest(REQUEST_SET_MESH_QUAD_WITH_EDGES);
   int data[5] = {meshID, firstVertexID, secondVertexID, thirdVertexID, fourthVertexID};
-  _com->send(data, 5, 0);
+  pack(_requestBuffer, data, 5);
+  endRequest(false);
+}
+
+void RequestManager:: requestSetMeshEdges
+(
+  int        meshID,
+  int        size,
+  const int* vertexIDs,
+  int*       edgeIDs )
+{
+  TRACE(meshID, size);
+  beginRequest(REQUEST_SET_MESH_EDGES);
+  int data[2] = {meshID, size};
+  pack(_requestBuffer, data, 2);
+  pack(_requestBuffer, vertexIDs, 2 * size);
+  endRequest(true);
+  _com->receive(edgeIDs, size, 0);
+}
+
+void RequestManager:: requestSetMeshTriangles
+(
+  int        meshID,
+  int        size,
+  const int* edgeIDs )
+{
+  TRACE(meshID, size);
+  beginRequest(REQUEST_SET_MESH_TRIANGLES);
+  int data[2] = {meshID, size};
+  pack(_requestBuffer, data, 2);
+  pack(_requestBuffer, edgeIDs, 3 * size);
+  endRequest(false);
+}
+
+void RequestManager:: requestSetMeshTrianglesWithEdges
+(
+  int        meshID,
+  int        size,
+  const int* vertexIDs )
+{
+  TRACE(meshID, size);
+  beginRequest(REQUEST_SET_MESH_TRIANGLES_WITH_EDGES);
+  int data[2] = {meshID, size};
+  pack(_requestBuffer, data, 2);
+  pack(_requestBuffer, vertexIDs, 3 * size);
+  endRequest(false);
+}
+
+void RequestManager:: requestSetMeshQuads
+(
+  int        meshID,
+  int        size,
+  const int* edgeIDs )
+{
+  TRACE(meshID, size);
+  beginRequest(REQUEST_SET_MESH_QUADS);
+  int data[2] = {meshID, size};
+  pack(_requestBuffer, data, 2);
+  pack(_requestBuffer, edgeIDs, 4 * size);
+  endRequest(false);
+}
+
+void RequestManager:: requestSetMeshQuadsWithEdges
+(
+  int        meshID,
+  int        size,
+  const int* vertexIDs )
+{
+  TRACE(meshID, size);
+  beginRequest(REQUEST_SET_MESH_QUADS_WITH_EDGES);
+  int data[2] = {meshID, size};
+  pack(_requestBuffer, data, 2);
+  pack(_requestBuffer, vertexIDs, 4 * size);
+  endRequest(false);
 }
 
 void RequestManager:: requestWriteBlockScalarData (
@@ -432,11 +645,12 @@ void RequestManager:: requestWriteBlockScalarData (
   double* values )
 {
   TRACE(dataID, size);
-  _com->send(REQUEST_WRITE_BLOCK_SCALAR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(size, 0);
-  _com->send(valueIndices, size, 0);
-  _com->send(values, size, 0);
+  beginRequest(REQUEST_WRITE_BLOCK_SCALAR_DATA);
+  int data[2] = {dataID, size};
+  pack(_requestBuffer, data, 2);
+  pack(_requestBuffer, valueIndices, size);
+  pack(_requestBuffer, values, size);
+  endRequest(false);
 }
 
 void RequestManager:: requestWriteScalarData
@@ -446,10 +660,11 @@ void RequestManager:: requestWriteScalarData
   double value )
 {
   TRACE();
-  _com->send(REQUEST_WRITE_SCALAR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(valueIndex, 0);
-  _com->send(value, 0);
+  beginRequest(REQUEST_WRITE_SCALAR_DATA);
+  int data[2] = {dataID, valueIndex};
+  pack(_requestBuffer, data, 2);
+  pack(_requestBuffer, value);
+  endRequest(false);
 }
 
 void RequestManager:: requestWriteBlockVectorData (
@@ -459,11 +674,12 @@ void RequestManager:: requestWriteBlockVectorData (
   double* values )
 {
   TRACE(dataID);
-  _com->send(REQUEST_WRITE_BLOCK_VECTOR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(size, 0);
-  _com->send(valueIndices, size, 0);
-  _com->send(values, size*_interface.getDimensions(), 0);
+  beginRequest(REQUEST_WRITE_BLOCK_VECTOR_DATA);
+  int data[2] = {dataID, size};
+  pack(_requestBuffer, data, 2);
+  pack(_requestBuffer, valueIndices, size);
+  pack(_requestBuffer, values, size*_interface.getDimensions());
+  endRequest(false);
 }
 
 void RequestManager:: requestWriteVectorData
@@ -473,10 +689,11 @@ void RequestManager:: requestWriteVectorData
   double* value )
 {
   TRACE();
-  _com->send(REQUEST_WRITE_VECTOR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(valueIndex, 0);
-  _com->send(value, _interface.getDimensions(), 0);
+  beginRequest(REQUEST_WRITE_VECTOR_DATA);
+  int data[2] = {dataID, valueIndex};
+  pack(_requestBuffer, data, 2);
+  pack(_requestBuffer, value, _interface.getDimensions());
+  endRequest(false);
 }
 
 void RequestManager:: requestReadBlockScalarData (
@@ -486,10 +703,11 @@ void RequestManager:: requestReadBlockScalarData (
   double* values )
 {
   TRACE(dataID, size);
-  _com->send(REQUEST_READ_BLOCK_SCALAR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(size, 0);
-  _com->send(valueIndices, size, 0);
+  beginRequest(REQUEST_READ_BLOCK_SCALAR_DATA);
+  int data[2] = {dataID, size};
+  pack(_requestBuffer, data, 2);
+  pack(_requestBuffer, valueIndices, size);
+  endRequest(true);
   _com->receive(values, size, 0);
 }
 
@@ -500,9 +718,10 @@ void RequestManager:: requestReadScalarData
   double& value )
 {
   TRACE();
-  _com->send(REQUEST_READ_SCALAR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(valueIndex, 0);
+  beginRequest(REQUEST_READ_SCALAR_DATA);
+  int data[2] = {dataID, valueIndex};
+  pack(_requestBuffer, data, 2);
+  endRequest(true);
   _com->receive(value, 0);
 }
 
@@ -514,10 +733,11 @@ void RequestManager:: requestReadBlockVectorData
   double* values )
 {
   TRACE(dataID, size);
-  _com->send(REQUEST_READ_BLOCK_VECTOR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(size, 0);
-  _com->send(valueIndices, size, 0);
+  beginRequest(REQUEST_READ_BLOCK_VECTOR_DATA);
+  int data[2] = {dataID, size};
+  pack(_requestBuffer, data, 2);
+  pack(_requestBuffer, valueIndices, size);
+  endRequest(true);
   _com->receive(values, size*_interface.getDimensions(), 0);
 }
 
@@ -528,9 +748,10 @@ void RequestManager:: requestReadVectorData
   double* value )
 {
   TRACE();
-  _com->send(REQUEST_READ_VETOR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(valueIndex, 0);
+  beginRequest(REQUEST_READ_VETOR_DATA);
+  int data[2] = {dataID, valueIndex};
+  pack(_requestBuffer, data, 2);
+  endRequest(true);
   _com->receive(value, _interface.getDimensions(), 0);
 }
 
@@ -539,10 +760,9 @@ void RequestManager:: requestMapWriteDataFrom
   int fromMeshID )
 {
   TRACE(fromMeshID);
-  _com->send(REQUEST_MAP_WRITE_DATA_FROM, 0);
-  int ping;
-  _com->receive(ping, 0);
-  _com->send(fromMeshID, 0);
+  beginRequest(REQUEST_MAP_WRITE_DATA_FROM);
+  pack(_requestBuffer, fromMeshID);
+  endRequest(true);
 }
 
 void RequestManager:: requestMapReadDataTo
@@ -550,10 +770,9 @@ void RequestManager:: requestMapReadDataTo
   int toMeshID )
 {
   TRACE(toMeshID);
-  _com->send(REQUEST_MAP_READ_DATA_TO, 0);
-  int ping;
-  _com->receive(ping, 0);
-  _com->send(toMeshID, 0);
+  beginRequest(REQUEST_MAP_READ_DATA_TO);
+  pack(_requestBuffer, toMeshID);
+  endRequest(true);
 }
 
 void RequestManager:: handleRequestInitialze
@@ -580,16 +799,17 @@ void RequestManager:: handleRequestInitialzeData
 
 void RequestManager:: handleRequestAdvance
 (
-  const std::list<int>& clientRanks )
+  const std::list<int>&                clientRanks,
+  const std::vector<std::vector<int>>& payloads )
 {
   TRACE();
   auto iter = clientRanks.begin();
-  double oldDt;
-  _com->receive(oldDt, *iter);
+  const std::vector<int>& oldPayload = payloads[*iter];
+  double oldDt = FrameReader(oldPayload.data(), oldPayload.data() + oldPayload.size()).readDouble();
   iter++;
   for (; iter != clientRanks.end(); iter++){
-    double dt;
-    _com->receive(dt, *iter);
+    const std::vector<int>& payload = payloads[*iter];
+    double dt = FrameReader(payload.data(), payload.data() + payload.size()).readDouble();
     CHECK(math::equals(dt, oldDt),
           "Ambiguous timestep length when calling request advance from several processes!");
     oldDt = dt;
@@ -608,220 +828,249 @@ void RequestManager:: handleRequestFinalize()
 
 void RequestManager:: handleRequestFulfilledAction
 (
-  int rankSender )
+  FrameReader& frame )
 {
-  TRACE(rankSender);
-  std::string action;
-  _com->receive(action, rankSender);
-  _interface.fulfilledAction(action);
+  TRACE();
+  _interface.fulfilledAction(frame.readString());
 }
 
 void RequestManager:: handleRequestSetMeshVertex
 (
-  int rankSender )
+  int          rankSender,
+  FrameReader& frame )
 {
   TRACE(rankSender);
-  int meshID = -1;
-  _com->receive(meshID, rankSender);
+  int meshID = frame.readInt();
   double position[_interface.getDimensions()];
-  _com->receive(position, _interface.getDimensions(), rankSender);
+  frame.read(position, _interface.getDimensions());
   int index = _interface.setMeshVertex(meshID, position);
   _com->send(index, rankSender);
 }
 
 void RequestManager:: handleRequestGetMeshVertexSize
 (
-  int rankSender )
+  int          rankSender,
+  FrameReader& frame )
 {
   TRACE(rankSender);
-  int meshID = -1;
-  _com->receive(meshID, rankSender);
+  int meshID = frame.readInt();
   int size = _interface.getMeshVertexSize(meshID);
   _com->send(size, rankSender);
 }
 
 void RequestManager:: handleRequestResetMesh
 (
-  int rankSender )
+  FrameReader& frame )
 {
-  TRACE(rankSender);
-  int meshID = -1;
-  _com->receive(meshID, rankSender);
-  _interface.resetMesh(meshID);
+  TRACE();
+  _interface.resetMesh(frame.readInt());
 }
 
 
 void RequestManager:: handleRequestSetMeshVertices
 (
-  int rankSender )
+  int          rankSender,
+  FrameReader& frame )
 {
   TRACE(rankSender);
-  int meshID = -1;
-  _com->receive(meshID, rankSender);
-  int size = -1;
-  _com->receive(size, rankSender);
+  int meshID = frame.readInt();
+  int size = frame.readInt();
   CHECK(size > 0, "You cannot call setMeshVertices with size=0.");
   std::vector<double> positions(size*_interface.getDimensions());
-  _com->receive(positions, rankSender);
+  frame.read(positions.data(), positions.size());
   std::vector<int> ids(size);
   _interface.setMeshVertices(meshID, size, positions.data(), ids.data());
-  _com->send(ids, rankSender);
+  _com->send(ids.data(), ids.size(), rankSender);
 }
 
 void RequestManager:: handleRequestGetMeshVertices
 (
-  int rankSender )
+  int          rankSender,
+  FrameReader& frame )
 {
   TRACE(rankSender);
-  int meshID = -1;
-  int size = -1;
-  _com->receive(meshID, rankSender);
-  _com->receive(size, rankSender);
+  int meshID = frame.readInt();
+  int size = frame.readInt();
   assertion(size > 0, size);
   std::vector<int> ids(size);
+  frame.read(ids.data(), size);
   std::vector<double> positions(size*_interface.getDimensions());
-  _com->receive(ids, rankSender);
   _interface.getMeshVertices(meshID, size, ids.data(), positions.data());
-  _com->send(positions, rankSender);
+  _com->send(positions.data(), positions.size(), rankSender);
 }
 
 void RequestManager:: handleRequestGetMeshVertexIDsFromPositions
 (
-  int rankSender )
+  int          rankSender,
+  FrameReader& frame )
 {
   TRACE(rankSender);
-  int meshID = -1;
-  int size = -1;
-  _com->receive(meshID, rankSender);
-  _com->receive(size, rankSender);
+  int meshID = frame.readInt();
+  int size = frame.readInt();
   assertion(size > 0, size);
-  std::vector<int> ids(size);
   std::vector<double> positions(size*_interface.getDimensions());
-  _com->receive(positions, rankSender);
+  frame.read(positions.data(), positions.size());
+  std::vector<int> ids(size);
   _interface.getMeshVertexIDsFromPositions(meshID, size, positions.data(), ids.data());
-  _com->send(ids, rankSender);
+  _com->send(ids.data(), ids.size(), rankSender);
 }
 
 void RequestManager:: handleRequestSetMeshEdge
 (
-  int rankSender )
+  int          rankSender,
+  FrameReader& frame )
 {
   TRACE(rankSender);
   int data[3]; // 0: meshID, 1: firstVertexID, 2: secondVertexID
-  _com->receive(data, 3, rankSender);
+  frame.read(data, 3);
   int createEdgeID = _interface.setMeshEdge(data[0], data[1], data[2]);
   _com->send(createEdgeID, rankSender);
 }
 
 void RequestManager:: handleRequestSetMeshTriangle
 (
-  int rankSender )
+  FrameReader& frame )
 {
-  TRACE(rankSender);
+  TRACE();
   int data[4]; // 0: meshID, 1,2,3: edge IDs
-  _com->receive(data, 4, rankSender);
+  frame.read(data, 4);
   _interface.setMeshTriangle(data[0], data[1], data[2], data[3]);
 }
 
 void RequestManager:: handleRequestSetMeshTriangleWithEdges
 (
-  int rankSender )
+  FrameReader& frame )
 {
-  TRACE(rankSender);
+  TRACE();
   int data[4]; // 0: meshID, 1,2,3: vertex IDs
-  _com->receive(data, 4, rankSender);
+  frame.read(data, 4);
   _interface.setMeshTriangleWithEdges(data[0], data[1], data[2], data[3]);
 }
 
 void RequestManager:: handleRequestSetMeshQuad
 (
-  int rankSender )
+  FrameReader& frame )
 {
-  TRACE(rankSender);
+  TRACE();
   int data[5]; // 0: meshID, 1,2,3,4: edge IDs
-  _com->receive(data, 5, rankSender);
+  frame.read(data, 5);
   _interface.setMeshQuad(data[0], data[1], data[2], data[3], data[4]);
 }
 
 void RequestManager:: handleRequestSetMeshQuadWithEdges
 (
-  int rankSender )
+  FrameReader& frame )
 {
-  TRACE(rankSender);
+  TRACE();
   int data[5]; // 0: meshID, 1,2,3,4: vertex IDs
-  _com->receive(data, 5, rankSender);
+  frame.read(data, 5);
   _interface.setMeshQuadWithEdges(data[0], data[1], data[2], data[3], data[4]);
 }
 
-void RequestManager:: handleRequestWriteScalarData
+void RequestManager:: handleRequestSetMeshEdges
 (
-  int rankSender )
+  int          rankSender,
+  FrameReader& frame )
 {
   TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int index = -1;
-  _com->receive(index, rankSender);
-  double data;
-  _com->receive(data, rankSender);
+  int data[2]; // 0: meshID, 1: number of edges
+  frame.read(data, 2);
+  std::vector<int> vertexIDs(2 * data[1]);
+  frame.read(vertexIDs.data(), vertexIDs.size());
+  std::vector<int> edgeIDs(data[1]);
+  _interface.setMeshEdges(data[0], data[1], vertexIDs.data(), edgeIDs.data());
+  _com->send(edgeIDs.data(), edgeIDs.size(), rankSender);
+}
+
+void RequestManager:: handleRequestSetMeshElements
+(
+  int          requestID,
+  FrameReader& frame )
+{
+  TRACE(requestID);
+  int data[2]; // 0: meshID, 1: number of elements
+  frame.read(data, 2);
+  bool triangles = requestID == REQUEST_SET_MESH_TRIANGLES
+                   || requestID == REQUEST_SET_MESH_TRIANGLES_WITH_EDGES;
+  std::vector<int> ids((triangles ? 3 : 4) * data[1]);
+  frame.read(ids.data(), ids.size());
+  switch (requestID){
+  case REQUEST_SET_MESH_TRIANGLES:
+    _interface.setMeshTriangles(data[0], data[1], ids.data());
+    break;
+  case REQUEST_SET_MESH_TRIANGLES_WITH_EDGES:
+    _interface.setMeshTrianglesWithEdges(data[0], data[1], ids.data());
+    break;
+  case REQUEST_SET_MESH_QUADS:
+    _interface.setMeshQuads(data[0], data[1], ids.data());
+    break;
+  case REQUEST_SET_MESH_QUADS_WITH_EDGES:
+    _interface.setMeshQuadsWithEdges(data[0], data[1], ids.data());
+    break;
+  default:
+    assertion(false, requestID);
+  }
+}
+
+void RequestManager:: handleRequestWriteScalarData
+(
+  FrameReader& frame )
+{
+  TRACE();
+  int dataID = frame.readInt();
+  int index = frame.readInt();
+  double data = frame.readDouble();
   _interface.writeScalarData(dataID, index, data);
 }
 
 void RequestManager:: handleRequestWriteBlockScalarData
 (
-  int rankSender )
+  FrameReader& frame )
 {
-  TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int size = -1;
-  _com->receive(size, rankSender);
+  TRACE();
+  int dataID = frame.readInt();
+  int size = frame.readInt();
   std::vector<int> indices(size);
-  _com->receive(indices, rankSender);
+  frame.read(indices.data(), size);
   std::vector<double> data(size);
-  _com->receive(data, rankSender);
+  frame.read(data.data(), size);
   _interface.writeBlockScalarData(dataID, size, indices.data(), data.data());
 }
 
 void RequestManager:: handleRequestWriteBlockVectorData
 (
-  int rankSender )
+  FrameReader& frame )
 {
-  TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int size = -1;
-  _com->receive(size, rankSender);
+  TRACE();
+  int dataID = frame.readInt();
+  int size = frame.readInt();
   std::vector<int> indices(size);
-  _com->receive(indices, rankSender);
+  frame.read(indices.data(), size);
   std::vector<double> data(size*_interface.getDimensions());
-  _com->receive(data, rankSender);
+  frame.read(data.data(), data.size());
   _interface.writeBlockVectorData(dataID, size, indices.data(), data.data());
 }
 
 void RequestManager:: handleRequestWriteVectorData
 (
-  int rankSender )
+  FrameReader& frame )
 {
-  TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int index = -1;
-  _com->receive( index, rankSender);
+  TRACE();
+  int dataID = frame.readInt();
+  int index = frame.readInt();
   double data[_interface.getDimensions()];
-  _com->receive(data, _interface.getDimensions(), rankSender);
+  frame.read(data, _interface.getDimensions());
   _interface.writeVectorData(dataID, index, data);
 }
 
 void RequestManager:: handleRequestReadScalarData
 (
-  int rankSender )
+  int          rankSender,
+  FrameReader& frame )
 {
   TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int index = -1;
-  _com->receive(index, rankSender);
+  int dataID = frame.readInt();
+  int index = frame.readInt();
   double data;
   _interface.readScalarData(dataID, index, data);
   _com->send(data, rankSender); // Send back result
@@ -829,45 +1078,42 @@ void RequestManager:: handleRequestReadScalarData
 
 void RequestManager:: handleRequestReadBlockScalarData
 (
-  int rankSender )
+  int          rankSender,
+  FrameReader& frame )
 {
   TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int size = -1;
-  _com->receive(size, rankSender);
+  int dataID = frame.readInt();
+  int size = frame.readInt();
   std::vector<int> indices(size);
-  _com->receive(indices, rankSender);
+  frame.read(indices.data(), size);
   std::vector<double> data(size);
   _interface.readBlockScalarData(dataID, size, indices.data(), data.data());
-  _com->send(data, rankSender);
+  _com->send(data.data(), data.size(), rankSender);
 }
 
 void RequestManager:: handleRequestReadBlockVectorData
 (
-  int rankSender )
+  int          rankSender,
+  FrameReader& frame )
 {
   TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int size = -1;
-  _com->receive(size, rankSender);
+  int dataID = frame.readInt();
+  int size = frame.readInt();
   std::vector<int> indices(size);
-  _com->receive(indices, rankSender);
+  frame.read(indices.data(), size);
   std::vector<double> data(size*_interface.getDimensions());
   _interface.readBlockVectorData(dataID, size, indices.data(), data.data());
-  _com->send(data, rankSender);
+  _com->send(data.data(), data.size(), rankSender);
 }
 
 void RequestManager:: handleRequestReadVectorData
 (
-  int rankSender )
+  int          rankSender,
+  FrameReader& frame )
 {
   TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int index = -1;
-  _com->receive(index, rankSender);
+  int dataID = frame.readInt();
+  int index = frame.readInt();
   double data[_interface.getDimensions()];
   _interface.readVectorData(dataID, index, data);
   _com->send(data, _interface.getDimensions(), rankSender);
@@ -875,19 +1121,15 @@ void RequestManager:: handleRequestReadVectorData
 
 void RequestManager:: handleRequestMapWriteDataFrom
 (
-  const std::list<int>& clientRanks )
+  const std::list<int>&                clientRanks,
+  const std::vector<std::vector<int>>& payloads )
 {
   TRACE();
   auto iter = clientRanks.begin();
-  int ping = 0;
-  _com->send(ping, *iter);
-  int oldMeshID;
-  _com->receive(oldMeshID, *iter);
+  int oldMeshID = payloads[*iter].front();
   iter++;
   for (; iter != clientRanks.end(); iter++){
-    _com->send(ping, *iter);
-    int meshID;
-    _com->receive(meshID, *iter);
+    int meshID = payloads[*iter].front();
     CHECK(meshID == oldMeshID,
           "Ambiguous mesh ID when calling map written data from several processes!");
     oldMeshID = meshID;
@@ -897,19 +1139,15 @@ void RequestManager:: handleRequestMapWriteDataFrom
 
 void RequestManager:: handleRequestMapReadDataTo
 (
-  const std::list<int>& clientRanks )
+  const std::list<int>&                clientRanks,
+  const std::vector<std::vector<int>>& payloads )
 {
   TRACE();
   auto iter = clientRanks.begin();
-  int ping = 0;
-  _com->send(ping, *iter);
-  int oldMeshID;
-  _com->receive(oldMeshID, *iter);
+  int oldMeshID = payloads[*iter].front();
   iter++;
   for (; iter != clientRanks.end(); iter++){
-    _com->send(ping, *iter);
-    int meshID;
-    _com->receive(meshID, *iter);
+    int meshID = payloads[*iter].front();
     CHECK(meshID == oldMeshID,
           "Ambiguous mesh IDs (" << meshID << " and " << oldMeshID
           <<  ") when calling map read data from several processes!");
@@ -5,6 +5,8 @@
 #include "logging/Logger.hpp"
 #include <set>
 #include <list>
+#include <string>
+#include <vector>
 #include <Eigen/Core>
 
 namespace precice {
@@ -16,7 +18,13 @@ namespace precice {
 namespace precice {
 namespace impl {
 
-/// Takes requests from clients and handles requests on server side.
+/**
+ * @brief Takes requests from clients and handles requests on server side.
+ *
+ * Every request is packed into a frame [request ID, payload size, payload]. Clients buffer
+ * the frames and send them as one batch, as soon as a request needs a reply from the server
+ * or is a collective one. Requests without a reply thus do not cost a message each.
+ */
 class RequestManager
 {
 public:
@@ -115,6 +123,37 @@ public:
     int thirdVertexID,
     int fourthVertexID );
 
+  /// Requests set several mesh edges from server.
+  void requestSetMeshEdges (
+    int        meshID,
+    int        size,
+    const int* vertexIDs,
+    int*       edgeIDs );
+
+  /// Requests set several mesh triangles from server.
+  void requestSetMeshTriangles (
+    int        meshID,
+    int        size,
+    const int* edgeIDs );
+
+  /// Requests set several mesh triangles with edges from server.
+  void requestSetMeshTrianglesWithEdges (
+    int        meshID,
+    int        size,
+    const int* vertexIDs );
+
+  /// Requests set several mesh quads from server.
+  void requestSetMeshQuads (
+    int        meshID,
+    int        size,
+    const int* edgeIDs );
+
+  /// Requests set several mesh quads with edges from server.
+  void requestSetMeshQuadsWithEdges (
+    int        meshID,
+    int        size,
+    const int* vertexIDs );
+
   /// Requests write block scalar data from server.
   void requestWriteBlockScalarData (
     int     dataID,
@@ -193,6 +232,11 @@ private:
     REQUEST_SET_MESH_TRIANGLE_WITH_EDGES,
     REQUEST_SET_MESH_QUAD,
     REQUEST_SET_MESH_QUAD_WITH_EDGES,
+    REQUEST_SET_MESH_EDGES,
+    REQUEST_SET_MESH_TRIANGLES,
+    REQUEST_SET_MESH_TRIANGLES_WITH_EDGES,
+    REQUEST_SET_MESH_QUADS,
+    REQUEST_SET_MESH_QUADS_WITH_EDGES,
     REQUEST_WRITE_SCALAR_DATA,
     REQUEST_WRITE_BLOCK_SCALAR_DATA,
     REQUEST_WRITE_VECTOR_DATA,
@@ -214,83 +258,124 @@ private:
 
   cplscheme::PtrCouplingScheme _couplingScheme;
 
+  /// Reads the payload of a received request frame.
+  class FrameReader;
+
+  /// Buffered request frames of a client, which have not been sent yet.
+  std::vector<int> _requestBuffer;
+
+  /// Position of the frame in _requestBuffer, which is currently packed.
+  size_t _requestStart = 0;
+
+  /// Starts a new request frame in the request buffer, the payload is appended to it.
+  void beginRequest ( Request requestID );
+
+  /**
+   * @brief Completes the current request frame.
+   *
+   * @param[in] flush Sends all buffered requests, required if the server replies to the request.
+   */
+  void endRequest ( bool flush );
+
+  /// Sends all buffered request frames to the server as one batch.
+  void sendRequests();
+
+  /// Dispatches a request, which is not collective, to its handle method.
+  void handleRequest ( int requestID, int rankSender, FrameReader& frame );
+
   /// Handles request initialize from client.
   void handleRequestInitialze ( const std::list<int>& clientRanks );
 
   /// Handles request initialize data from client.
   void handleRequestInitialzeData ( const std::list<int>& clientRanks );
 
-  /// Handles request advance from client.
-  void handleRequestAdvance ( const std::list<int>& clientRanks );
+  /// Handles request advance from client, payloads are indexed by client rank.
+  void handleRequestAdvance (
+    const std::list<int>&                clientRanks,
+    const std::vector<std::vector<int>>& payloads );
 
   /// Handles request finalize from client.
   void handleRequestFinalize();
 
   /// Handles request fulfilled action from client.
-  void handleRequestFulfilledAction ( int rankSender );
+  void handleRequestFulfilledAction ( FrameReader& frame );
 
   /// Handles request set mesh vertex from client.
-  void handleRequestSetMeshVertex ( int rankSender );
+  void handleRequestSetMeshVertex ( int rankSender, FrameReader& frame );
 
   /// Handles request get mesh vertex size from client.
-  void handleRequestGetMeshVertexSize(int rankSender);
+  void handleRequestGetMeshVertexSize ( int rankSender, FrameReader& frame );
 
   /// Handles request reset mesh from client.
-  void handleRequestResetMesh(int rankSender);
+  void handleRequestResetMesh ( FrameReader& frame );
 
   /// Handles request set vertex positions from client.
-  void handleRequestSetMeshVertices ( int rankSender );
+  void handleRequestSetMeshVertices ( int rankSender, FrameReader& frame );
 
   /// Handles request get vertex positions from client.
-  void handleRequestGetMeshVertices ( int rankSender );
+  void handleRequestGetMeshVertices ( int rankSender, FrameReader& frame );
 
   /// Handles request get vertex IDs from client.
-  void handleRequestGetMeshVertexIDsFromPositions ( int rankSender );
+  void handleRequestGetMeshVertexIDsFromPositions ( int rankSender, FrameReader& frame );
 
   /// Handles request set mesh edge from client.
-  void handleRequestSetMeshEdge ( int rankSender );
+  void handleRequestSetMeshEdge ( int rankSender, FrameReader& frame );
 
   /// Handles request set mesh triangle from client.
-  void handleRequestSetMeshTriangle ( int rankSender );
+  void handleRequestSetMeshTriangle ( FrameReader& frame );
 
   /// Handles request set mesh triangle with edges from client.
-  void handleRequestSetMeshTriangleWithEdges ( int rankSender );
+  void handleRequestSetMeshTriangleWithEdges ( FrameReader& frame );
 
   /// Handles request set mesh quad from client.
-  void handleRequestSetMeshQuad ( int rankSender );
+  void handleRequestSetMeshQuad ( FrameReader& frame );
 
   /// Handles request set mesh quad with edges from client.
-  void handleRequestSetMeshQuadWithEdges ( int rankSender );
+  void handleRequestSetMeshQuadWithEdges ( FrameReader& frame );
+
+  /// Handles request set several mesh edges from client.
+  void handleRequestSetMeshEdges ( int rankSender, FrameReader& frame );
+
+  /**
+   * @brief Handles the requests to set several triangles or quads from client.
+   *
+   * @param[in] requestID One of the batched triangle and quad requests, defines the element type.
+   */
+  void handleRequestSetMeshElements ( int requestID, FrameReader& frame );
 
   /// Handles request write block scalar data from client.
-  void handleRequestWriteBlockScalarData ( int rankSender );
+  void handleRequestWriteBlockScalarData ( FrameReader& frame );
 
   /// Handles request write scalar data from client.
-  void handleRequestWriteScalarData ( int rankSender );
+  void handleRequestWriteScalarData ( FrameReader& frame );
 
   /// Handles request write block vector data from client.
-  void handleRequestWriteBlockVectorData ( int rankSender );
+  void handleRequestWriteBlockVectorData ( FrameReader& frame );
 
   /// Handles request write vector data from client.
-  void handleRequestWriteVectorData ( int rankSender );
+  void handleRequestWriteVectorData ( FrameReader& frame );
 
   /// Handles request read block scalar data from client.
-  void handleRequestReadBlockScalarData ( int rankSender );
+  void handleRequestReadBlockScalarData ( int rankSender, FrameReader& frame );
 
   /// Handles request read scalar data from client.
-  void handleRequestReadScalarData ( int rankSender );
+  void handleRequestReadScalarData ( int rankSender, FrameReader& frame );
 
   /// Handles request read block vector data from client.
-  void handleRequestReadBlockVectorData ( int rankSender );
+  void handleRequestReadBlockVectorData ( int rankSender, FrameReader& frame );
 
   /// Handles request read vector data from client.
-  void handleRequestReadVectorData ( int rankSender );
+  void handleRequestReadVectorData ( int rankSender, FrameReader& frame );
 
-  /// Handles request map written data from client.
-  void handleRequestMapWriteDataFrom ( const std::list<int>& clientRanks );
+  /// Handles request map written data from client, payloads are indexed by client rank.
+  void handleRequestMapWriteDataFrom (
+    const std::list<int>&                clientRanks,
+    const std::vector<std::vector<int>>& payloads );
 
-  /// Handles request map read data from client.
-  void handleRequestMapReadDataTo ( const std::list<int>& clientRanks );
+  /// Handles request map read data from client, payloads are indexed by client rank.
+  void handleRequestMapReadDataTo (
+    const std::list<int>&                clientRanks,
+    const std::vector<std::vector<int>>& payloads );
 
 };
 
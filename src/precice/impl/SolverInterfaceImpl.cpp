@@ -30,7 +30,12 @@
 #include "partition/ReceivedPartition.hpp"
 #include "partition/ProvidedPartition.hpp"
 
+#include <algorithm>
 #include <csignal> // used for installing crash handler
+#include <cstdint>
+#include <exception>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 
 #include "logging/Logger.hpp"
@@ -50,6 +55,66 @@ bool syncMode = false;
 
 namespace impl {
 
+namespace {
+
+/// Finds the edges of a mesh by their vertices and creates missing edges.
+class EdgeLookup
+{
+public:
+  explicit EdgeLookup ( mesh::Mesh& mesh )
+  :
+    _mesh(mesh)
+  {
+    _edges.reserve(mesh.edges().size());
+    for (mesh::Edge& edge : mesh.edges()) {
+      _edges.emplace(key(edge.vertex(0), edge.vertex(1)), &edge);
+    }
+  }
+
+  /// Returns an edge between the given vertices, in any orientation, creates it if it does not exist.
+  mesh::Edge& getOrCreate ( mesh::Vertex& vertexOne, mesh::Vertex& vertexTwo )
+  {
+    auto inserted = _edges.emplace(key(vertexOne, vertexTwo), nullptr);
+    if (inserted.second) {
+      inserted.first->second = &_mesh.createEdge(vertexOne, vertexTwo);
+    }
+    return *inserted.first->second;
+  }
+
+private:
+  static std::uint64_t key ( const mesh::Vertex& vertexOne, const mesh::Vertex& vertexTwo )
+  {
+    std::uint32_t first = vertexOne.getID();
+    std::uint32_t second = vertexTwo.getID();
+    if (first > second) {
+      std::swap(first, second);
+    }
+    return (static_cast<std::uint64_t>(first) << 32) | second;
+  }
+
+  mesh::Mesh& _mesh;
+
+  std::unordered_map<std::uint64_t, mesh::Edge*> _edges;
+};
+
+/// Joins all threads when leaving the scope, also if an exception is thrown.
+struct ScopedJoin {
+  explicit ScopedJoin ( std::vector<std::thread>& threads ) : _threads(threads) {}
+
+  ~ScopedJoin()
+  {
+    for (std::thread& thread : _threads) {
+      if (thread.joinable()) {
+        thread.join();
+      }
+    }
+  }
+
+  std::vector<std::thread>& _threads;
+};
+
+}
+
 SolverInterfaceImpl:: SolverInterfaceImpl
 (
   std::string participantName,
@@ -83,7 +148,22 @@ void SolverInterfaceImpl:: configure
   const std::string& configurationFileName )
 {
   config::Configuration config;
-  xml::configure(config.getXMLTag(), configurationFileName);
+  utils::Parallel::initializeMPI(nullptr, nullptr);
+  if (_accessorCommunicatorSize > 1 && utils::Parallel::getCommunicatorSize() == _accessorCommunicatorSize){
+    // All processes of the global communicator belong to this participant. The first one
+    // parses and validates the file and broadcasts the read tags to all others.
+    std::vector<int> serializedTags;
+    if (utils::Parallel::getProcessRank() == 0){
+      serializedTags = xml::configureAndSerialize(config.getXMLTag(), configurationFileName);
+    }
+    utils::Parallel::broadcast(serializedTags, 0);
+    if (utils::Parallel::getProcessRank() != 0){
+      xml::configureSerialized(config.getXMLTag(), serializedTags);
+    }
+  }
+  else {
+    xml::configure(config.getXMLTag(), configurationFileName);
+  }
   if(_accessorProcessRank==0){
     INFO("Configuring preCICE with configuration: \"" << configurationFileName << "\"" );
   }
@@ -189,47 +269,17 @@ double SolverInterfaceImpl:: initialize()
     _requestManager->requestInitialize();
   }
   else {
-    // Setup communication
-
     INFO("Setting up master communication to coupling partner/s " );
-    for (auto& m2nPair : _m2ns) {
-      m2n::PtrM2N& m2n = m2nPair.second.m2n;
-      std::string localName = _accessorName;
-      if (_serverMode) localName += "Server";
-      std::string remoteName(m2nPair.first);
-      CHECK(m2n.get() != nullptr,
-            "M2N communication from " << localName << " to participant "
-            << remoteName << " could not be created! Check compile flags used!");
-      if (m2nPair.second.isRequesting){
-        m2n->requestMasterConnection(remoteName, localName);
-      }
-      else {
-        m2n->acceptMasterConnection(localName, remoteName);
-      }
-    }
+    connectMastersAndPreparePartitions();
     INFO("Coupling partner/s are connected " );
 
-
     DEBUG("Perform initializations");
-
-
+    Event e1("computePartitions", precice::syncMode);
     computePartitions();
+    e1.stop();
 
     INFO("Setting up slaves communication to coupling partner/s " );
-    for (auto& m2nPair : _m2ns) {
-      m2n::PtrM2N& m2n = m2nPair.second.m2n;
-      std::string localName = _accessorName;
-      std::string remoteName(m2nPair.first);
-      CHECK(m2n.get() != nullptr,
-                   "Communication from " << localName << " to participant "
-                   << remoteName << " could not be created! Check compile flags used!");
-      if (m2nPair.second.isRequesting){
-        m2n->requestSlavesConnection(remoteName, localName);
-      }
-      else {
-        m2n->acceptSlavesConnection(localName, remoteName);
-      }
-    }
+    connectSlaves();
     INFO("Slaves are connected" );
 
     std::set<action::Action::Timing> timings;
@@ -243,7 +293,9 @@ double SolverInterfaceImpl:: initialize()
     double time = 0.0;
     int timestep = 1;
 
+    Event e2("initializeCouplingScheme", precice::syncMode);
     _couplingScheme->initialize(time, timestep);
+    e2.stop();
 
     dt = _couplingScheme->getNextTimestepMaxLength();
 
@@ -317,7 +369,8 @@ double SolverInterfaceImpl:: advance
   auto & solverInitEvent = EventRegistry::instance().getStoredEvent("solver.initialize");
   solverInitEvent.stop(precice::syncMode);
 
-  Event e("advance", precice::syncMode);
+  static const utils::EventID advanceEvent = EventRegistry::instance().getEventID("advance");
+  Event e(advanceEvent, precice::syncMode);
   utils::ScopedEventPrefix sep("advance/");
 
   CHECK(_couplingScheme->isInitialized(), "initialize() has to be called before advance()");
@@ -452,9 +505,9 @@ void SolverInterfaceImpl:: finalize()
     _accessor->getClientServerCommunication()->closeConnection();
   }
 
-  // Stop and print Event logging
+  // Stop and print Event logging, which is collective on all ranks of this participant
   precice::utils::EventRegistry::instance().finalize();
-  if (not precice::testMode and not precice::utils::MasterSlave::_slaveMode) {
+  if (not precice::testMode) {
     precice::utils::EventRegistry::instance().printAll();
   }
 
@@ -1048,6 +1101,158 @@ void SolverInterfaceImpl:: setMeshQuadWithEdges
   }
 }
 
+void SolverInterfaceImpl:: setMeshEdges
+(
+  int        meshID,
+  int        size,
+  const int* vertexIDs,
+  int*       edgeIDs )
+{
+  TRACE(meshID, size);
+  if (_clientMode){
+    _requestManager->requestSetMeshEdges(meshID, size, vertexIDs, edgeIDs);
+    return;
+  }
+  CHECK(not _couplingScheme->isInitialized(), "Edges can only be defined before initialize() is called");
+  MeshContext& context = _accessor->meshContext(meshID);
+  if (context.meshRequirement != mapping::Mapping::MeshRequirement::FULL){
+    std::fill(edgeIDs, edgeIDs + size, -1);
+    return;
+  }
+  mesh::PtrMesh& mesh = context.mesh;
+  int vertexCount = mesh->vertices().size();
+  mesh->reserve(0, size, 0);
+  for (int i = 0; i < size; i++){
+    const int* ids = vertexIDs + 2 * i;
+    assertion(ids[0] >= 0 && ids[0] < vertexCount, ids[0], vertexCount);
+    assertion(ids[1] >= 0 && ids[1] < vertexCount, ids[1], vertexCount);
+    edgeIDs[i] = mesh->createEdge(mesh->vertices()[ids[0]], mesh->vertices()[ids[1]]).getID();
+  }
+}
+
+void SolverInterfaceImpl:: setMeshTriangles
+(
+  int        meshID,
+  int        size,
+  const int* edgeIDs )
+{
+  TRACE(meshID, size);
+  if (_clientMode){
+    _requestManager->requestSetMeshTriangles(meshID, size, edgeIDs);
+    return;
+  }
+  CHECK(not _couplingScheme->isInitialized(), "Triangles can only be defined before initialize() is called");
+  MeshContext& context = _accessor->meshContext(meshID);
+  if (context.meshRequirement == mapping::Mapping::MeshRequirement::FULL){
+    mesh::PtrMesh& mesh = context.mesh;
+    int edgeCount = mesh->edges().size();
+    mesh->reserve(0, 0, size);
+    for (int i = 0; i < size; i++){
+      const int* ids = edgeIDs + 3 * i;
+      for (int j = 0; j < 3; j++){
+        assertion(ids[j] >= 0 && ids[j] < edgeCount, ids[j], edgeCount);
+      }
+      mesh->createTriangle(mesh->edges()[ids[0]], mesh->edges()[ids[1]], mesh->edges()[ids[2]]);
+    }
+  }
+}
+
+void SolverInterfaceImpl:: setMeshTrianglesWithEdges
+(
+  int        meshID,
+  int        size,
+  const int* vertexIDs )
+{
+  TRACE(meshID, size);
+  if (_clientMode){
+    _requestManager->requestSetMeshTrianglesWithEdges(meshID, size, vertexIDs);
+    return;
+  }
+  CHECK(not _couplingScheme->isInitialized(), "Triangles can only be defined before initialize() is called");
+  MeshContext& context = _accessor->meshContext(meshID);
+  if (context.meshRequirement == mapping::Mapping::MeshRequirement::FULL){
+    mesh::PtrMesh& mesh = context.mesh;
+    int vertexCount = mesh->vertices().size();
+    mesh->reserve(0, 0, size);
+    EdgeLookup edges(*mesh);
+    for (int i = 0; i < size; i++){
+      const int* ids = vertexIDs + 3 * i;
+      for (int j = 0; j < 3; j++){
+        assertion(ids[j] >= 0 && ids[j] < vertexCount, ids[j], vertexCount);
+      }
+      mesh::Vertex& v0 = mesh->vertices()[ids[0]];
+      mesh::Vertex& v1 = mesh->vertices()[ids[1]];
+      mesh::Vertex& v2 = mesh->vertices()[ids[2]];
+      mesh::Edge& e0 = edges.getOrCreate(v0, v1);
+      mesh::Edge& e1 = edges.getOrCreate(v1, v2);
+      mesh::Edge& e2 = edges.getOrCreate(v2, v0);
+      mesh->createTriangle(e0, e1, e2);
+    }
+  }
+}
+
+void SolverInterfaceImpl:: setMeshQuads
+(
+  int        meshID,
+  int        size,
+  const int* edgeIDs )
+{
+  TRACE(meshID, size);
+  if (_clientMode){
+    _requestManager->requestSetMeshQuads(meshID, size, edgeIDs);
+    return;
+  }
+  CHECK(not _couplingScheme->isInitialized(), "Quads can only be defined before initialize() is called");
+  MeshContext& context = _accessor->meshContext(meshID);
+  if (context.meshRequirement == mapping::Mapping::MeshRequirement::FULL){
+    mesh::PtrMesh& mesh = context.mesh;
+    int edgeCount = mesh->edges().size();
+    for (int i = 0; i < size; i++){
+      const int* ids = edgeIDs + 4 * i;
+      for (int j = 0; j < 4; j++){
+        assertion(ids[j] >= 0 && ids[j] < edgeCount, ids[j], edgeCount);
+      }
+      mesh->createQuad(mesh->edges()[ids[0]], mesh->edges()[ids[1]],
+                       mesh->edges()[ids[2]], mesh->edges()[ids[3]]);
+    }
+  }
+}
+
+void SolverInterfaceImpl:: setMeshQuadsWithEdges
+(
+  int        meshID,
+  int        size,
+  const int* vertexIDs )
+{
+  TRACE(meshID, size);
+  if (_clientMode){
+    _requestManager->requestSetMeshQuadsWithEdges(meshID, size, vertexIDs);
+    return;
+  }
+  CHECK(not _couplingScheme->isInitialized(), "Quads can only be defined before initialize() is called");
+  MeshContext& context = _accessor->meshContext(meshID);
+  if (context.meshRequirement == mapping::Mapping::MeshRequirement::FULL){
+    mesh::PtrMesh& mesh = context.mesh;
+    int vertexCount = mesh->vertices().size();
+    EdgeLookup edges(*mesh);
+    for (int i = 0; i < size; i++){
+      const int* ids = vertexIDs + 4 * i;
+      for (int j = 0; j < 4; j++){
+        assertion(ids[j] >= 0 && ids[j] < vertexCount, ids[j], vertexCount);
+      }
+      mesh::Vertex& v0 = mesh->vertices()[ids[0]];
+      mesh::Vertex& v1 = mesh->vertices()[ids[1]];
+      mesh::Vertex& v2 = mesh->vertices()[ids[2]];
+      mesh::Vertex& v3 = mesh->vertices()[ids[3]];
+      mesh::Edge& e0 = edges.getOrCreate(v0, v1);
+      mesh::Edge& e1 = edges.getOrCreate(v1, v2);
+      mesh::Edge& e2 = edges.getOrCreate(v2, v3);
+      mesh::Edge& e3 = edges.getOrCreate(v3, v0);
+      mesh->createQuad(e0, e1, e2, e3);
+    }
+  }
+}
+
 void SolverInterfaceImpl:: mapWriteDataFrom
 (
   int fromMeshID )
@@ -1513,6 +1718,105 @@ void SolverInterfaceImpl:: configurePartitions
   }
 }
 
+void SolverInterfaceImpl:: connectMastersAndPreparePartitions()
+{
+  TRACE();
+  Event e("connectMasters");
+
+  std::vector<std::thread> threads;
+  std::vector<Event::Clock::duration> durations(_m2ns.size(), Event::Clock::duration::zero());
+  // Errors in the threads are thrown instead of exiting the program and reported below
+  std::vector<std::exception_ptr> failures(_m2ns.size());
+  size_t index = 0;
+  {
+    ScopedJoin join(threads);
+    for (auto& m2nPair : _m2ns) {
+      m2n::PtrM2N m2n = m2nPair.second.m2n;
+      std::string localName = _accessorName;
+      if (_serverMode) localName += "Server";
+      std::string remoteName(m2nPair.first);
+      CHECK(m2n.get() != nullptr,
+            "M2N communication from " << localName << " to participant "
+            << remoteName << " could not be created! Check compile flags used!");
+      bool isRequesting = m2nPair.second.isRequesting;
+      std::string acceptorName = isRequesting ? remoteName : localName;
+      std::string requesterName = isRequesting ? localName : remoteName;
+      Event::Clock::duration& duration = durations[index];
+      std::exception_ptr& failure = failures[index];
+      index++;
+      auto connect = [m2n, acceptorName, requesterName, isRequesting, &duration] {
+        auto start = Event::Clock::now();
+        m2n->connectMasters(acceptorName, requesterName, isRequesting);
+        duration = Event::Clock::now() - start;
+      };
+      if (m2n->isMasterConnectionThreadSafe() && not utils::MasterSlave::_slaveMode){
+        threads.emplace_back([connect, &failure] {
+          logging::throwOnError = true;
+          try {
+            connect();
+          }
+          catch (...) {
+            failure = std::current_exception();
+          }
+        });
+      }
+      else {
+        connect();
+      }
+    }
+
+    // Gathering the provided meshes overlaps with waiting for the partners
+    Event e1("preparePartitions", precice::syncMode);
+    for (MeshContext* meshContext : _accessor->usedMeshContexts()){
+      meshContext->partition->prepare();
+    }
+    e1.stop();
+  }
+
+  index = 0;
+  for (auto& m2nPair : _m2ns) {
+    if (failures[index]) {
+      try {
+        std::rethrow_exception(failures[index]);
+      }
+      catch (const std::exception& error) {
+        ERROR("Connecting to participant " << m2nPair.first << " failed: " << error.what());
+      }
+    }
+    index++;
+  }
+
+  index = 0;
+  for (auto& m2nPair : _m2ns) {
+    m2nPair.second.m2n->broadcastMasterConnection();
+    if (not utils::MasterSlave::_slaveMode){
+      // Events are not thread-safe, hence the connections are timed in their threads and reported here
+      Event("connectMaster." + m2nPair.first, durations[index]);
+    }
+    index++;
+  }
+}
+
+void SolverInterfaceImpl:: connectSlaves()
+{
+  TRACE();
+  Event e("connectSlaves", precice::syncMode);
+  for (auto& m2nPair : _m2ns) {
+    m2n::PtrM2N& m2n = m2nPair.second.m2n;
+    std::string localName = _accessorName;
+    std::string remoteName(m2nPair.first);
+    CHECK(m2n.get() != nullptr,
+                 "Communication from " << localName << " to participant "
+                 << remoteName << " could not be created! Check compile flags used!");
+    if (m2nPair.second.isRequesting){
+      m2n->requestSlavesConnection(remoteName, localName);
+    }
+    else {
+      m2n->acceptSlavesConnection(localName, remoteName);
+    }
+  }
+}
+
 void SolverInterfaceImpl:: computePartitions()
 {
   //We need to do this in two loops: First, communicate the mesh and later compute the partition.
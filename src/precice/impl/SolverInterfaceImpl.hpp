@@ -28,6 +28,7 @@ namespace precice {
 namespace PreciceTests {
   namespace Serial {
     struct TestConfiguration;
+    struct testBlockMeshFunctions;
   }
 }
 
@@ -297,6 +298,37 @@ public:
     int thirdVertexID,
     int fourthVertexID );
 
+  /// Sets several edges of a solver mesh, see SolverInterface::setMeshEdges().
+  void setMeshEdges (
+    int        meshID,
+    int        size,
+    const int* vertexIDs,
+    int*       edgeIDs );
+
+  /// Sets several triangles of a solver mesh, see SolverInterface::setMeshTriangles().
+  void setMeshTriangles (
+    int        meshID,
+    int        size,
+    const int* edgeIDs );
+
+  /// Sets several triangles and creates missing edges, see SolverInterface::setMeshTrianglesWithEdges().
+  void setMeshTrianglesWithEdges (
+    int        meshID,
+    int        size,
+    const int* vertexIDs );
+
+  /// Sets several quadrangles of a solver mesh, see SolverInterface::setMeshQuads().
+  void setMeshQuads (
+    int        meshID,
+    int        size,
+    const int* edgeIDs );
+
+  /// Sets several quadrangles and creates missing edges, see SolverInterface::setMeshQuadsWithEdges().
+  void setMeshQuadsWithEdges (
+    int        meshID,
+    int        size,
+    const int* vertexIDs );
+
   /**
    * @brief Computes and maps all write data mapped from mesh with given ID.
    *
@@ -557,6 +589,18 @@ private:
   void configurePartitions (
     const m2n::M2NConfiguration::SharedPointer& m2nConfig );
 
+  /**
+   * @brief Sets up the master connections to all coupling partners and prepares the partitions meanwhile.
+   *
+   * Connections which support it are set up in one thread per partner on the master, s.t. waiting
+   * for several partners overlaps. A pool of fewer threads could deadlock, if partners wait for
+   * each other. The partitions are prepared on the calling thread, which keeps all MPI calls there.
+   */
+  void connectMastersAndPreparePartitions();
+
+  /// Sets up the slaves connections to all coupling partners.
+  void connectSlaves();
+
   /// Communicate meshes and create partition
   void computePartitions();
 
@@ -601,6 +645,7 @@ private:
 
   /// To allow white box tests.
   friend struct PreciceTests::Serial::TestConfiguration;
+  friend struct PreciceTests::Serial::testBlockMeshFunctions;
 };
 
 }} // namespace precice, impl
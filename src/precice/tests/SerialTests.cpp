@@ -5,13 +5,24 @@
 #include "precice/impl/Participant.hpp"
 #include "precice/impl/MeshContext.hpp"
 #include "precice/impl/DataContext.hpp"
+#include "precice/impl/WatchPoint.hpp"
 #include "precice/SolverInterface.hpp"
 #include "precice/Constants.hpp"
 #include "utils/Parallel.hpp"
 #include "precice/Constants.hpp"
 #include "precice/impl/Participant.hpp"
 #include "precice/config/Configuration.hpp"
+#include "precice/config/ParticipantConfiguration.hpp"
+#include "precice/config/SolverInterfaceConfiguration.hpp"
+#include "cplscheme/CouplingScheme.hpp"
+#include "cplscheme/config/CouplingSchemeConfiguration.hpp"
+#include "io/ExportContext.hpp"
+#include "mesh/config/DataConfiguration.hpp"
+#include "mesh/config/MeshConfiguration.hpp"
 #include "utils/MasterSlave.hpp"
+#include "mesh/Edge.hpp"
+#include "mesh/Quad.hpp"
+#include "mesh/Triangle.hpp"
 
 using namespace precice;
 
@@ -81,6 +92,79 @@ BOOST_AUTO_TEST_CASE(TestConfiguration)
   BOOST_TEST(comsol->_usedMeshContexts.size() == 1);
 }
 
+namespace {
+
+/// Describes the configured objects, which have to be equal for equal configurations
+std::vector<std::string> describe(const config::Configuration &config)
+{
+  const config::SolverInterfaceConfiguration &interfaceConfig = config.getSolverInterfaceConfiguration();
+  std::vector<std::string> objects;
+  objects.push_back("dimensions " + std::to_string(interfaceConfig.getDimensions()));
+  for (const auto &data : interfaceConfig.getDataConfiguration()->data()) {
+    objects.push_back("data " + data.name + " " + std::to_string(data.dimensions));
+  }
+  for (const mesh::PtrMesh &mesh : interfaceConfig.getMeshConfiguration()->meshes()) {
+    objects.push_back("mesh " + mesh->getName() + " " + std::to_string(mesh->getID()));
+    for (const mesh::PtrData &data : mesh->data()) {
+      objects.push_back("  data " + data->getName() + " " + std::to_string(data->getID()));
+    }
+  }
+  for (const auto &m2n : interfaceConfig.getM2NConfiguration()->m2ns()) {
+    objects.push_back("m2n " + std::get<1>(m2n) + " " + std::get<2>(m2n));
+  }
+  for (const impl::PtrParticipant &participant : interfaceConfig.getParticipantConfiguration()->getParticipants()) {
+    objects.push_back("participant " + participant->getName() + " " + std::to_string(participant->getID()));
+    for (const impl::MeshContext *context : participant->usedMeshContexts()) {
+      objects.push_back("  use-mesh " + context->mesh->getName() + " from " + context->receiveMeshFrom +
+                        " provide " + std::to_string(context->provideMesh));
+    }
+    for (const impl::DataContext &context : participant->writeDataContexts()) {
+      objects.push_back("  write-data " + context.fromData->getName() + " " + context.mesh->getName());
+    }
+    for (const impl::DataContext &context : participant->readDataContexts()) {
+      objects.push_back("  read-data " + context.toData->getName() + " " + context.mesh->getName());
+    }
+    objects.push_back("  mappings " + std::to_string(participant->readMappingContexts().size()) +
+                      " " + std::to_string(participant->writeMappingContexts().size()));
+    objects.push_back("  actions " + std::to_string(participant->actions().size()));
+    for (const io::ExportContext &context : participant->exportContexts()) {
+      objects.push_back("  export " + context.type + " " + context.location + " " +
+                        std::to_string(context.timestepInterval));
+    }
+    for (const impl::PtrWatchPoint &watchPoint : participant->watchPoints()) {
+      objects.push_back("  watch-point " + watchPoint->mesh()->getName());
+    }
+    const cplscheme::CouplingSchemeConfiguration &schemeConfig = *interfaceConfig.getCouplingSchemeConfiguration();
+    if (schemeConfig.hasCouplingScheme(participant->getName())) {
+      const cplscheme::PtrCouplingScheme &scheme = schemeConfig.getCouplingScheme(participant->getName());
+      objects.push_back("  coupling-scheme " + std::to_string(scheme->getMaxTime()) + " " +
+                        std::to_string(scheme->getTimestepLength()));
+      for (const std::string &partner : scheme->getCouplingPartners()) {
+        objects.push_back("    partner " + partner);
+      }
+    }
+  }
+  return objects;
+}
+
+}
+
+/// Test that a configuration from serialized tags equals the one read from the file.
+BOOST_AUTO_TEST_CASE(TestConfigurationSerialized)
+{
+  std::string filename = _pathToTests + "/configuration.xml";
+  config::Configuration parsedConfig;
+  std::vector<int> serializedTags = xml::configureAndSerialize(parsedConfig.getXMLTag(), filename);
+  std::vector<std::string> parsedObjects = describe(parsedConfig);
+  BOOST_TEST(parsedObjects.size() == 40);
+
+  // Same global IDs as for the parsed configuration
+  reset();
+  config::Configuration deserializedConfig;
+  xml::configureSerialized(deserializedConfig.getXMLTag(), serializedTags);
+  BOOST_TEST(describe(deserializedConfig) == parsedObjects, boost::test_tools::per_element());
+}
+
 /// Test to run simple "do nothing" coupling between two solvers.
 BOOST_AUTO_TEST_CASE(TestExplicit,
                      * testing::MinRanks(2)
@@ -1473,6 +1557,88 @@ BOOST_AUTO_TEST_CASE(testMappingNearestProjection,
   }
 }
 
+/// Tests the block functions to define edges, triangles and quads
+BOOST_AUTO_TEST_CASE(testBlockMeshFunctions)
+{
+  SolverInterface cplInterface("SolverOne", 0, 1);
+  config::Configuration config;
+  xml::configure(config.getXMLTag(), _pathToTests + "mapping-nearest-projection.xml");
+  cplInterface._impl->configure(config.getSolverInterfaceConfiguration());
+  const int meshID = cplInterface.getMeshID("MeshOne");
+  mesh::Mesh& mesh = *cplInterface._impl->_accessor->meshContext(meshID).mesh;
+
+  // Two adjacent unit squares in the plane z = 0
+  //  v3 - v4 - v5
+  //  |    |    |
+  //  v0 - v1 - v2
+  std::vector<double> coords{0.0, 0.0, 0.0,  1.0, 0.0, 0.0,  2.0, 0.0, 0.0,
+                             0.0, 1.0, 0.0,  1.0, 1.0, 0.0,  2.0, 1.0, 0.0};
+  std::vector<int> v(6);
+  cplInterface.setMeshVertices(meshID, 6, coords.data(), v.data());
+
+  // Triangle v0, v1, v4 from explicitly defined edges
+  const std::vector<int> edgeVertices{v[0], v[1],  v[1], v[4],  v[4], v[0]};
+  std::vector<int> e(3);
+  cplInterface.setMeshEdges(meshID, 3, edgeVertices.data(), e.data());
+  BOOST_TEST(mesh.edges().size() == 3);
+  for (int i = 0; i < 3; i++) {
+    BOOST_TEST(e[i] == mesh.edges()[e[i]].getID());
+    BOOST_TEST(mesh.edges()[e[i]].vertex(0).getID() == edgeVertices[2 * i]);
+    BOOST_TEST(mesh.edges()[e[i]].vertex(1).getID() == edgeVertices[2 * i + 1]);
+  }
+  cplInterface.setMeshTriangles(meshID, 1, e.data());
+  BOOST_TEST(mesh.triangles().size() == 1);
+
+  // Returns the ID of the edge between two vertices in any orientation, -1 if there is none
+  auto edgeID = [&mesh](int vertexA, int vertexB) {
+    for (mesh::Edge& edge : mesh.edges()) {
+      int id0 = edge.vertex(0).getID();
+      int id1 = edge.vertex(1).getID();
+      if ((id0 == vertexA and id1 == vertexB) or (id0 == vertexB and id1 == vertexA))
+        return edge.getID();
+    }
+    return -1;
+  };
+
+  // Triangles v0, v4, v3 and v4, v1, v2: the edges v0-v4 and v4-v1 exist in opposite orientation
+  // and are reused, the edges v4-v3, v3-v0, v1-v2 and v2-v4 are created
+  const std::vector<int> triangleVertices{v[0], v[4], v[3],  v[4], v[1], v[2]};
+  cplInterface.setMeshTrianglesWithEdges(meshID, 2, triangleVertices.data());
+  BOOST_TEST(mesh.edges().size() == 7);
+  BOOST_TEST(mesh.triangles().size() == 3);
+  BOOST_TEST(edgeID(v[0], v[4]) == e[2]);
+  BOOST_TEST(edgeID(v[4], v[1]) == e[1]);
+  const int e43 = edgeID(v[4], v[3]);
+  const int e30 = edgeID(v[3], v[0]);
+  const int e12 = edgeID(v[1], v[2]);
+  const int e24 = edgeID(v[2], v[4]);
+  BOOST_TEST_REQUIRE(e43 >= 0);
+  BOOST_TEST_REQUIRE(e30 >= 0);
+  BOOST_TEST_REQUIRE(e12 >= 0);
+  BOOST_TEST_REQUIRE(e24 >= 0);
+  BOOST_TEST(&mesh.triangles()[1].edge(0) == &mesh.edges()[e[2]]);
+  BOOST_TEST(&mesh.triangles()[1].edge(1) == &mesh.edges()[e43]);
+  BOOST_TEST(&mesh.triangles()[1].edge(2) == &mesh.edges()[e30]);
+  BOOST_TEST(&mesh.triangles()[2].edge(0) == &mesh.edges()[e[1]]);
+  BOOST_TEST(&mesh.triangles()[2].edge(1) == &mesh.edges()[e12]);
+  BOOST_TEST(&mesh.triangles()[2].edge(2) == &mesh.edges()[e24]);
+
+  // Quad v0, v1, v4, v3 from existing edges: v0-v1, v1-v4, v4-v3, v3-v0
+  const std::vector<int> quadEdges{e[0], e[1], e43, e30};
+  cplInterface.setMeshQuads(meshID, 1, quadEdges.data());
+  BOOST_TEST(mesh.quads().size() == 1);
+  BOOST_TEST(mesh.edges().size() == 7);
+
+  // Quad v1, v2, v5, v4 shares the edge v1-v2 with the second triangle and v4-v1 with the first quad
+  const std::vector<int> quadVertices{v[1], v[2], v[5], v[4]};
+  cplInterface.setMeshQuadsWithEdges(meshID, 1, quadVertices.data());
+  BOOST_TEST(mesh.quads().size() == 2);
+  BOOST_TEST(mesh.edges().size() == 9);
+  BOOST_TEST(&mesh.quads()[1].edge(0) == &mesh.edges()[e12]);
+  BOOST_TEST(&mesh.quads()[1].edge(3) == &mesh.edges()[e[1]]);
+  BOOST_TEST(mesh.vertices().size() == 6);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 #endif // PRECICE_NO_MPI
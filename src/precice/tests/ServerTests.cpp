@@ -190,6 +190,111 @@ BOOST_AUTO_TEST_CASE(testCouplingModeParallelWithOneServer, * testing::OnSize(4)
   }
 }
 
+/// Block data and on-demand mappings through a server, with buffered requests exceeding the request buffer
+BOOST_AUTO_TEST_CASE(testBlockDataAndMappingWithOneServer,
+                     * testing::MinRanks(3)
+                     * boost::unit_test::fixture<testing::MPICommRestrictFixture>(std::vector<int>({0, 1, 2})))
+{
+  if (utils::Parallel::getCommunicatorSize() != 3)
+    return;
+
+  int rank = utils::Parallel::getProcessRank();
+  std::string configFile = _pathToTests + "cplmode-2.xml";
+  double positions[] = {0.0, 0.0, 1.0, 0.0, 1.0, 1.0, 0.0, 1.0};
+  int ids[] = {-1, -1, -1, -1};
+  int size = 4;
+  if (rank == 0){
+    SolverInterface interface("ParticipantA", 0, 1);
+    config::Configuration config;
+    xml::configure(config.getXMLTag(), configFile);
+    interface._impl->configure(config.getSolverInterfaceConfiguration());
+    int meshID = interface.getMeshID("MeshA");
+    int scalarDataAID = interface.getDataID("ScalarDataA", meshID);
+    int vectorDataAID = interface.getDataID("VectorDataA", meshID);
+    int scalarDataBID = interface.getDataID("ScalarDataB", meshID);
+    int vectorDataBID = interface.getDataID("VectorDataB", meshID);
+    interface.setMeshVertices(meshID, size, positions, ids);
+
+    double dt = interface.initialize();
+    int timestep = 0;
+    while (interface.isCouplingOngoing()){
+      Eigen::Vector4d scalarValues = Eigen::Vector4d::LinSpaced(timestep, timestep + 3);
+      Eigen::Matrix<double, 8, 1> vectorValues = -Eigen::Matrix<double, 8, 1>::LinSpaced(timestep, timestep + 7);
+      interface.writeBlockScalarData(scalarDataAID, size, ids, scalarValues.data());
+      interface.writeBlockVectorData(vectorDataAID, size, ids, vectorValues.data());
+      dt = interface.advance(dt);
+
+      Eigen::Vector4d readScalarValues;
+      Eigen::Matrix<double, 8, 1> readVectorValues;
+      interface.readBlockScalarData(scalarDataBID, size, ids, readScalarValues.data());
+      interface.readBlockVectorData(vectorDataBID, size, ids, readVectorValues.data());
+      BOOST_TEST(readScalarValues == (2.0 * scalarValues));
+      BOOST_TEST(readVectorValues == (2.0 * vectorValues));
+      timestep++;
+    }
+    interface.finalize();
+    BOOST_TEST(timestep == 3);
+  }
+  else if (rank == 1){
+    SolverInterface interface("ParticipantB", 0, 1);
+    config::Configuration config;
+    xml::configure(config.getXMLTag(), configFile);
+    interface._impl->configure(config.getSolverInterfaceConfiguration());
+    int meshID = interface.getMeshID("MeshB");
+    int scalarDataAID = interface.getDataID("ScalarDataA", meshID);
+    int vectorDataAID = interface.getDataID("VectorDataA", meshID);
+    int scalarDataBID = interface.getDataID("ScalarDataB", meshID);
+    int vectorDataBID = interface.getDataID("VectorDataB", meshID);
+    interface.setMeshVertices(meshID, size, positions, ids);
+    // Elements are buffered without reply, the nearest-neighbor mappings ignore them
+    interface.setMeshQuadWithEdges(meshID, ids[0], ids[1], ids[2], ids[3]);
+    int triangles[] = {ids[0], ids[1], ids[2], ids[0], ids[2], ids[3]};
+    interface.setMeshTrianglesWithEdges(meshID, 2, triangles);
+
+    double dt = interface.initialize();
+    int timestep = 0;
+    while (interface.isCouplingOngoing()){
+      interface.mapReadDataTo(meshID);
+      Eigen::Vector4d scalarValues;
+      Eigen::Matrix<double, 8, 1> vectorValues;
+      interface.readBlockScalarData(scalarDataAID, size, ids, scalarValues.data());
+      interface.readBlockVectorData(vectorDataAID, size, ids, vectorValues.data());
+      BOOST_TEST(scalarValues == (Eigen::Vector4d::LinSpaced(timestep, timestep + 3)));
+      BOOST_TEST(vectorValues == (-Eigen::Matrix<double, 8, 1>::LinSpaced(timestep, timestep + 7)));
+
+      scalarValues *= 2.0;
+      vectorValues *= 2.0;
+      if (timestep == 0){
+        // Writes the same values often enough to exceed the size limit of buffered requests, which flushes them
+        for (int i = 0; i < (1 << 16); i++){
+          interface.writeBlockVectorData(vectorDataBID, size, ids, vectorValues.data());
+        }
+      }
+      interface.writeBlockScalarData(scalarDataBID, size, ids, scalarValues.data());
+      interface.writeBlockVectorData(vectorDataBID, size, ids, vectorValues.data());
+      interface.mapWriteDataFrom(meshID);
+      dt = interface.advance(dt);
+      timestep++;
+    }
+    interface.finalize();
+    BOOST_TEST(timestep == 3);
+  }
+  else {
+    assertion(rank == 2, rank);
+    bool isServer = true;
+    impl::SolverInterfaceImpl server("ParticipantB", 0, 1, isServer);
+
+    // Perform manual configuration without overwritting logging config
+    mesh::Mesh::resetGeometryIDsGlobally();
+    mesh::Data::resetDataCount();
+    impl::Participant::resetParticipantCount();
+    config::Configuration config;
+    xml::configure(config.getXMLTag(), configFile);
+    server.configure(config.getSolverInterfaceConfiguration());
+    server.runServer();
+  }
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -15,6 +15,8 @@
 #include <chrono>
 #include <utility>
 #include <limits>
+#include <sstream>
+#include <numeric>
 #ifndef PRECICE_NO_MPI
 #include <mpi.h>
 #endif
@@ -24,16 +26,34 @@
 namespace precice {
 namespace utils {
 
-struct MPI_EventData
+namespace {
+
+/// Writes a timestamp in the format used by all event files
+void writeTimestamp(std::ostream &out, std::chrono::system_clock::time_point timestamp)
 {
-  char name[255] = {'\0'};
-  int rank, count = 0;
-  long total = 0, max = 0, min = 0;
-  int dataSize = 0, stateChangesSize = 0;
-};
+  using namespace std::chrono;
+  std::time_t ts = system_clock::to_time_t(timestamp);
+  auto ms = duration_cast<milliseconds>(timestamp.time_since_epoch()) % 1000;
+  out << std::put_time(std::localtime(&ts), "%FT%T") << "." << std::setfill('0') << std::setw(3) << ms.count() << std::setfill(' ');
+}
+
+#ifndef PRECICE_NO_MPI
+/// Sets the timestamp on all ranks to the one of rank 0, s.t. the files of all ranks name the same run
+void broadcastTimestamp(std::chrono::system_clock::time_point & timestamp, MPI_Comm comm)
+{
+  using std::chrono::system_clock;
+  long long ticks = timestamp.time_since_epoch().count();
+  MPI_Bcast(&ticks, 1, MPI_LONG_LONG, 0, comm);
+  timestamp = system_clock::time_point(system_clock::duration(ticks));
+}
+#endif
+
+}
+
+logging::Logger Event::_log("utils::Events");
 
 Event::Event(std::string eventName, Clock::duration initialDuration)
-  : name(EventRegistry::instance().prefix + eventName),
+  : name(EventRegistry::instance().getPrefix() + eventName),
     duration(initialDuration)
 {
   EventRegistry::instance().put(this);
@@ -45,7 +65,16 @@ Event::Event(std::string eventName, bool barrier, bool autostart)
 {
   // Set prefix here: workaround to omit data lock between instance() and Event ctor
   if (eventName != "_GLOBAL")
-    name = EventRegistry::instance().prefix + eventName;
+    name = EventRegistry::instance().getPrefix() + eventName;
+  if (autostart) {
+    start(_barrier);
+  }
+}
+
+Event::Event(EventID eventID, bool barrier, bool autostart)
+  : _barrier(barrier)
+{
+  _index = EventRegistry::instance().getEventIndex(eventID);
   if (autostart) {
     start(_barrier);
   }
@@ -62,9 +91,9 @@ void Event::start(bool barrier)
     Parallel::synchronizeProcesses();
     
   state = State::STARTED;
-  stateChanges.push_back(std::make_tuple(State::STARTED, Clock::now()));
   starttime = Clock::now();
-  DEBUG("Started event " << name);
+  stateChanges.emplace_back(State::STARTED, starttime);
+  DEBUG("Started event " << getName());
 }
 
 void Event::stop(bool barrier)
@@ -73,17 +102,17 @@ void Event::stop(bool barrier)
     if (barrier)
       Parallel::synchronizeProcesses();
 
+    auto stoptime = Clock::now();
     if (state == State::STARTED) {
-      auto stoptime = Clock::now();
       duration += Clock::duration(stoptime - starttime);
     }
-    stateChanges.push_back(std::make_tuple(State::STOPPED, Clock::now()));
+    stateChanges.emplace_back(State::STOPPED, stoptime);
     state = State::STOPPED;
     EventRegistry::instance().put(this);
     data.clear();
     stateChanges.clear();
     duration = Clock::duration::zero();
-    DEBUG("Stopped event " << name);
+    DEBUG("Stopped event " << getName());
   }
 }
 
@@ -94,10 +123,10 @@ void Event::pause(bool barrier)
       Parallel::synchronizeProcesses();
 
     auto stoptime = Clock::now();
-    stateChanges.push_back(std::make_tuple(State::PAUSED, Clock::now()));
+    stateChanges.emplace_back(State::PAUSED, stoptime);
     state = State::PAUSED;
     duration += Clock::duration(stoptime - starttime);
-    DEBUG("Paused event " << name);
+    DEBUG("Paused event " << getName());
   }
 }
 
@@ -106,27 +135,21 @@ Event::Clock::duration Event::getDuration()
   return duration;
 }
 
-// -----------------------------------------------------------------------
-
-EventData::EventData(std::string _name) :
-  name(_name)
+std::string Event::getName() const
 {
-  rank =  Parallel::getProcessRank();
+  if (_index >= 0)
+    return EventRegistry::instance().events[_index].getName();
+  return name;
 }
 
-EventData::EventData(std::string _name, int _rank, long _count, long _total,
-                     long _max, long _min, std::vector<int> _data, Event::StateChanges _stateChanges)
-  :  max(std::chrono::milliseconds(_max)),
-     min(std::chrono::milliseconds(_min)),
-     total(std::chrono::milliseconds(_total)),
-     rank(_rank),
-     stateChanges(_stateChanges),
-     name(_name),
-     count(_count),
-     data(_data)
+// -----------------------------------------------------------------------
+
+EventData::EventData(std::string _name, int _rank) :
+  rank(_rank),
+  name(_name)
 {}
 
-void EventData::put(Event* event)
+void EventData::put(Event* event, bool keepRecords)
 {
   count++;
   Event::Clock::duration duration = event->getDuration();
@@ -134,7 +157,9 @@ void EventData::put(Event* event)
   min = std::min(duration, min);
   max = std::max(duration, max);
   data.insert(std::end(data), std::begin(event->data), std::end(event->data));
-  stateChanges.insert(std::end(stateChanges), std::begin(event->stateChanges), std::end(event->stateChanges));
+  if (keepRecords) {
+    stateChanges.insert(std::end(stateChanges), std::begin(event->stateChanges), std::end(event->stateChanges));
+  }
 }
 
 std::string EventData::getName() const
@@ -144,6 +169,8 @@ std::string EventData::getName() const
 
 long EventData::getAvg() const
 {
+  if (count == 0)
+    return 0;
   return (std::chrono::duration_cast<std::chrono::milliseconds>(total) / count).count();
 }
 
@@ -177,6 +204,11 @@ const std::vector<int> & EventData::getData() const
   return data;
 }
 
+void EventData::clearData()
+{
+  data.clear();
+}
+
 
 void EventData::print(std::ostream &out)
 {
@@ -193,12 +225,8 @@ void EventData::print(std::ostream &out)
 
 void EventData::writeCSV(std::ostream &out)
 {
-  using namespace std::chrono;
-  auto now = EventRegistry::instance().getTimestamp();
-  std::time_t ts = system_clock::to_time_t(now);
-  auto ms = duration_cast<milliseconds>(now.time_since_epoch()) % 1000;
-        
-  out << std::put_time(std::localtime(&ts), "%FT%T") << "." << std::setw(3) << ms.count() << ","
+  writeTimestamp(out, EventRegistry::instance().getTimestamp());
+  out << ","
       << EventRegistry::instance().runName << ","
       << rank << ","
       << getName() << ","
@@ -222,13 +250,9 @@ void EventData::writeCSV(std::ostream &out)
 void EventData::writeEventLog(std::ostream &out)
 {
   using namespace std::chrono;
-  auto now = EventRegistry::instance().getTimestamp();
-  std::time_t ts = system_clock::to_time_t(now);
-  auto ms = duration_cast<milliseconds>(now.time_since_epoch()) % 1000;
-  
   for (auto & sc : stateChanges) {
-    out << std::put_time(std::localtime(&ts), "%FT%T") << "." << std::setw(3) << ms.count() << ","
-        << EventRegistry::instance().runName << ","
+    writeTimestamp(out, EventRegistry::instance().getTimestamp());
+    out << "," << EventRegistry::instance().runName << ","
         << name << ","
         << rank << ","
         << duration_cast<milliseconds>(std::get<1>(sc).time_since_epoch()).count() << ","
@@ -239,6 +263,8 @@ void EventData::writeEventLog(std::ostream &out)
 
 // -----------------------------------------------------------------------
 
+logging::Logger EventRegistry::_log("utils::Events");
+
 EventRegistry & EventRegistry::instance()
 {
   static EventRegistry instance;
@@ -249,9 +275,66 @@ void EventRegistry::initialize(std::string appName, std::string run)
 {
   applicationName = appName;
   runName = run;
+
+#ifndef PRECICE_NO_MPI
+  // All participants share the global communicator with mpi-single, hence the ranks are grouped by
+  // the application name. The color of a group is the lowest global rank with that name.
+  auto & globalComm = Parallel::getGlobalCommunicator();
+  int globalRank, globalSize;
+  MPI_Comm_rank(globalComm, &globalRank);
+  MPI_Comm_size(globalComm, &globalSize);
+  int length = applicationName.size();
+  std::vector<int> lengths(globalSize), offsets(globalSize, 0);
+  MPI_Allgather(&length, 1, MPI_INT, lengths.data(), 1, MPI_INT, globalComm);
+  std::partial_sum(lengths.begin(), lengths.end() - 1, offsets.begin() + 1);
+  std::vector<char> names(offsets.back() + lengths.back());
+  MPI_Allgatherv(const_cast<char*>(applicationName.data()), length, MPI_CHAR,
+                 names.data(), lengths.data(), offsets.data(), MPI_CHAR, globalComm);
+  int color = globalRank;
+  for (int i = 0; i < globalRank; i++) {
+    if (lengths[i] == length and std::equal(applicationName.begin(), applicationName.end(), names.begin() + offsets[i])) {
+      color = i;
+      break;
+    }
+  }
+  if (communicator != MPI_COMM_NULL)
+    MPI_Comm_free(&communicator);
+  MPI_Comm_split(globalComm, color, globalRank, &communicator);
+  MPI_Comm_rank(communicator, &rank);
+  MPI_Comm_size(communicator, &size);
+  for (auto & data : events)
+    data.rank = rank;
+#endif
   
   globalEvent.start(true);
+  runStart = Event::Clock::now();
+  runStartTimestamp = std::chrono::system_clock::now();
+#ifndef PRECICE_NO_MPI
+  broadcastTimestamp(runStartTimestamp, communicator);
+#endif
   initialized = true;
+
+  if (flushInterval > 0) {
+    std::string name = applicationName.empty() ? "" : applicationName + "-";
+    std::string eventLogFile = name + "events-" + std::to_string(rank) + ".log";
+    std::string timingsFile = name + "eventTimings-" + std::to_string(rank) + ".log";
+    bool eventLogExists = std::ifstream(eventLogFile).is_open();
+    bool timingsExists = std::ifstream(timingsFile).is_open();
+    eventLogStream.open(eventLogFile, std::ios::out | std::ios::app);
+    timingsStream.open(timingsFile, std::ios::out | std::ios::app);
+    if (not eventLogExists)
+      eventLogStream << "RunTimestamp,RunName,Name,Rank,Timestamp,State" << "\n";
+    if (not timingsExists)
+      timingsStream << "Timestamp,RunName,Rank,Name,Count,Total,Min,Max,Avg,T%,Data" << std::endl;
+    streamBuffer.reserve(streamBufferSize);
+    lastFlush = runStart;
+  }
+}
+
+void EventRegistry::setStreaming(double interval, size_t bufferSize)
+{
+  flushInterval = interval;
+  streamBufferSize = std::max<size_t>(bufferSize, 1);
 }
 
 void EventRegistry::finalize()
@@ -261,12 +344,18 @@ void EventRegistry::finalize()
   initialized = false;
   for (auto & e : storedEvents)
     e.second.stop();
-  collect();
+  if (eventLogStream.is_open()) {
+    flushStream(true);
+    eventLogStream.close();
+    timingsStream.close();
+  }
 }
 
 void EventRegistry::clear()
 {
-  events.clear();
+  // Interned events keep their index, only the data is reset
+  for (auto & data : events)
+    data = EventData(data.getName(), rank);
 }
 
 void EventRegistry::signal_handler(int signal)
@@ -279,11 +368,93 @@ void EventRegistry::signal_handler(int signal)
 
 void EventRegistry::put(Event* event)
 {
-  /// Construct or return EventData object with name as key and name as arg to ctor.
-  auto data = std::get<0>(events.emplace(std::piecewise_construct,
-                                         std::forward_as_tuple(event->name),
-                                         std::forward_as_tuple(event->name)));
-  data->second.put(event);
+  int index = event->_index >= 0 ? event->_index : getEventIndex(event->name);
+  bool streaming = eventLogStream.is_open();
+  events[index].put(event, not streaming);
+  if (streaming) {
+    for (auto & stateChange : event->stateChanges) {
+      streamBuffer.push_back(StateChangeRecord{index, std::get<0>(stateChange), std::get<1>(stateChange)});
+      if (streamBuffer.size() >= streamBufferSize)
+        flushStream(false);
+    }
+    // The attached data is written with the statistics, hence they are also flushed if too much data is held
+    streamedDataSize += event->data.size();
+    if (streamedDataSize >= streamBufferSize
+        or (not event->stateChanges.empty()
+            and std::get<1>(event->stateChanges.back()) - lastFlush > std::chrono::duration<double>(flushInterval)))
+      flushStream(true);
+  }
+}
+
+void EventRegistry::flushStream(bool force)
+{
+  using namespace std::chrono;
+  for (auto & record : streamBuffer) {
+    writeTimestamp(eventLogStream, runStartTimestamp);
+    eventLogStream << "," << runName << ","
+                   << events[record.eventIndex].getName() << ","
+                   << rank << ","
+                   << duration_cast<milliseconds>(record.timestamp.time_since_epoch()).count() << ","
+                   << static_cast<int>(record.state) << "\n";
+  }
+  streamBuffer.clear();
+  eventLogStream.flush();
+
+  if (force) {
+    // The timestamp of statistics is the time they have been written
+    timestamp = system_clock::now();
+    for (auto & e : eventIndices) {
+      if (events[e.second].getCount() > 0)
+        events[e.second].writeCSV(timingsStream);
+      events[e.second].clearData();
+    }
+    streamedDataSize = 0;
+    lastFlush = Event::Clock::now();
+  }
+}
+
+EventID EventRegistry::getEventID(std::string const & name)
+{
+  auto insertion = eventIDs.emplace(name, eventIDNames.size());
+  if (insertion.second)
+    eventIDNames.push_back(name);
+  EventID eventID;
+  eventID.index = insertion.first->second;
+  return eventID;
+}
+
+const EventData & EventRegistry::getEventData(std::string const & fullName)
+{
+  return events[getEventIndex(fullName)];
+}
+
+int EventRegistry::getEventIndex(std::string const & fullName)
+{
+  auto insertion = eventIndices.emplace(fullName, events.size());
+  if (insertion.second)
+    events.emplace_back(fullName, rank);
+  return insertion.first->second;
+}
+
+int EventRegistry::getEventIndex(EventID eventID)
+{
+  assert(eventID.isValid() and eventID.index < static_cast<int>(eventIDNames.size()));
+  std::vector<int> & resolved = resolvedIndices[prefixIndex];
+  if (eventID.index >= static_cast<int>(resolved.size()))
+    resolved.resize(eventIDNames.size(), -1);
+  int & index = resolved[eventID.index];
+  if (index < 0)
+    index = getEventIndex(prefix + eventIDNames[eventID.index]);
+  return index;
+}
+
+void EventRegistry::setPrefix(std::string const & newPrefix)
+{
+  prefix = newPrefix;
+  auto insertion = prefixIndices.emplace(prefix, resolvedIndices.size());
+  if (insertion.second)
+    resolvedIndices.emplace_back();
+  prefixIndex = insertion.first->second;
 }
 
 Event & EventRegistry::getStoredEvent(std::string const & name)
@@ -292,12 +463,12 @@ Event & EventRegistry::getStoredEvent(std::string const & name)
   // but leads to unexpected results, such as not getting the event you want, because someone else up the
   // stack set a prefix.
   auto previousPrefix = prefix;
-  prefix = "";
+  setPrefix("");
   auto insertion = storedEvents.emplace(std::piecewise_construct,
                                         std::forward_as_tuple(name),
                                         std::forward_as_tuple(name, false, false));
 
-  prefix = previousPrefix;
+  setPrefix(previousPrefix);
   return std::get<0>(insertion)->second;
 }
 
@@ -309,11 +480,18 @@ std::chrono::system_clock::time_point EventRegistry::getTimestamp()
 
 Event::Clock::duration EventRegistry::getDuration()
 {
-  return events.at("_GLOBAL").total;
+  if (initialized)
+    return Event::Clock::now() - runStart;
+  return events.at(eventIndices.at("_GLOBAL")).total;
 }
 
 void EventRegistry::printAll()
 {
+#ifndef PRECICE_NO_MPI
+  // The event log uses the timestamp as RunTimestamp
+  broadcastTimestamp(timestamp, communicator);
+#endif
+  collect();
   print();
 
   std::string csvFile, logFile;
@@ -326,23 +504,22 @@ void EventRegistry::printAll()
     logFile = applicationName + "-events.log";
   }
   writeCSV(csvFile);
-  writeEventLogs(logFile);
+  // In streaming mode, all state changes have already been written by each rank
+  if (flushInterval <= 0 and perRankDetail)
+    writeEventLogs(logFile);
   
 }
 
 
 void EventRegistry::print(std::ostream &out)
 {
-  int rank =  Parallel::getProcessRank();
-  int size = Parallel::getCommunicatorSize();
-  
   if (rank == 0) {
     using std::endl;
     using std::setw; using std::setprecision;
     using std::left; using std::right;
     
     std::time_t ts = std::chrono::system_clock::to_time_t(timestamp);
-    auto totalDuration = events.at("_GLOBAL").getTotal();
+    auto totalDuration = events.at(eventIndices.at("_GLOBAL")).getTotal();
 
     out << "Run finished at " << std::asctime(std::localtime(&ts));
 
@@ -363,8 +540,10 @@ void EventRegistry::print(std::ostream &out)
       });
     table.printHeader();
       
-    for (auto & e : events) {
-      auto & ev = e.second;
+    for (auto & e : eventIndices) {
+      auto & ev = events[e.second];
+      if (ev.getCount() == 0)
+        continue;
       table.printLine(ev.getName(), ev.getCount(), ev.getTotal(), ev.getMax(),
                       ev.getMin(), ev.getAvg(), ev.getTimePercentage());
     }        
@@ -382,75 +561,74 @@ void EventRegistry::print()
 
 void EventRegistry::writeCSV(std::string filename)
 {
-  int rank =  Parallel::getProcessRank();
-  int size = Parallel::getCommunicatorSize();
-  
-  if (rank != 0)
-    return;
-  
-  bool fileExists = std::ifstream(filename).is_open();
-   
-  std::ofstream outfile;
-  outfile.open(filename, std::ios::out | std::ios::app);
-  if (not fileExists)
-    outfile << "Timestamp,RunName,Rank,Name,Count,Total,Min,Max,Avg,T%,Data" << std::endl;
-   
-  std::time_t ts = std::chrono::system_clock::to_time_t(timestamp);
-  std::tm tm = *std::localtime(&ts);
-
-  outfile << "# Run finished at: " << std::put_time(&tm, "%F %T") << std::endl
-          << "# Number of processors: " << size << std::endl
-          << "# Timestamp,RunName,Rank,Name,Count,Total,Min,Max,Avg,T%,Data" << std::endl;
-         
-  
-  for (auto e : globalEvents) {
-    auto & ev = e.second;
-    ev.writeCSV(outfile);
+  std::ostringstream text;
+  if (rank == 0) {
+    std::time_t ts = std::chrono::system_clock::to_time_t(timestamp);
+    std::tm tm = *std::localtime(&ts);
+    text << "# Run finished at: " << std::put_time(&tm, "%F %T") << std::endl
+         << "# Number of processors: " << size << std::endl
+         << "# Timestamp,RunName,Rank,Name,Count,Total,Min,Max,Avg,T%,Data" << std::endl;
   }
-  
-  outfile.close();
+
+  if (perRankDetail) {
+    for (auto & e : eventIndices) {
+      if (events[e.second].getCount() > 0)
+        events[e.second].writeCSV(text);
+    }
+  }
+  else if (rank == 0) {
+    // Rank -1 denotes statistics of all ranks
+    using std::chrono::duration_cast;
+    using std::chrono::milliseconds;
+    for (auto & e : globalStats) {
+      auto & stats = e.second;
+      auto total = duration_cast<milliseconds>(stats.total).count();
+      writeTimestamp(text, timestamp);
+      text << "," << runName << ",-1," << e.first << ","
+           << stats.count << "," << total << ","
+           << duration_cast<milliseconds>(stats.min).count() << ","
+           << duration_cast<milliseconds>(stats.max).count() << ","
+           << total / std::max(stats.count, 1L) << ","
+           << static_cast<int>(static_cast<double>(stats.total.count()) / (getDuration().count() * stats.ranks) * 100)
+           << ",\"[]\"" << std::endl;
+    }
+  }
+
+  writeOrdered(filename, "Timestamp,RunName,Rank,Name,Count,Total,Min,Max,Avg,T%,Data\n", text.str());
 }
 
 void EventRegistry::writeEventLogs(std::string filename)
 {
-  int rank =  Parallel::getProcessRank();
-    
-  if (rank != 0)
-    return;
-  
-  bool fileExists = std::ifstream(filename).is_open();
-   
-  std::ofstream outfile;
-  outfile.open(filename, std::ios::out | std::ios::app);
-  if (not fileExists)
-    outfile << "RunTimestamp,RunName,Name,Rank,Timestamp,State" << "\n";
-   
-  for (auto e : globalEvents) {
-    auto & ev = e.second;
-    ev.writeEventLog(outfile);
-  }
-  
-  outfile.close();
+  std::ostringstream text;
+  for (auto & e : eventIndices)
+    events[e.second].writeEventLog(text);
+  writeOrdered(filename, "RunTimestamp,RunName,Name,Rank,Timestamp,State\n", text.str());
 }
 
-
- 
-std::map<std::string, GlobalEventStats> getGlobalStats(GlobalEvents events)
+void EventRegistry::writeOrdered(std::string const & filename, std::string const & header, std::string const & text)
 {
-  std::map<std::string, GlobalEventStats> globalStats;
-  for (auto & e : events) {
-    auto ev = e.second;
-    GlobalEventStats & stats = globalStats[e.first];
-    if (ev.max > stats.max) {
-      stats.max = ev.max;
-      stats.maxRank = ev.rank;
-    }
-    if (ev.min < stats.min) {
-      stats.min = ev.min;
-      stats.minRank = ev.rank;
-    }    
+  int fileExists = rank == 0 and std::ifstream(filename).is_open();
+
+#ifndef PRECICE_NO_MPI
+  // The broadcast ensures that rank 0 checked for the file before any rank creates it
+  MPI_Bcast(&fileExists, 1, MPI_INT, 0, communicator);
+  std::string out = (rank == 0 and not fileExists) ? header + text : text;
+
+  MPI_File file;
+  int error = MPI_File_open(communicator, const_cast<char*>(filename.c_str()),
+                            MPI_MODE_WRONLY | MPI_MODE_CREATE | MPI_MODE_APPEND, MPI_INFO_NULL, &file);
+  if (error != MPI_SUCCESS) {
+    WARN("Could not open " << filename << " for writing event timings.");
+    return;
   }
-  return globalStats;
+  MPI_File_write_ordered(file, const_cast<char*>(out.data()), out.size(), MPI_CHAR, MPI_STATUS_IGNORE);
+  MPI_File_close(&file);
+#else
+  std::ofstream outfile(filename, std::ios::out | std::ios::app);
+  if (not fileExists)
+    outfile << header;
+  outfile << text;
+#endif
 }
 
 void EventRegistry::printGlobalStats()
@@ -459,8 +637,7 @@ void EventRegistry::printGlobalStats()
       {10, "Max"}, {10, "MaxOnRank"}, {10, "Min"}, {10, "MinOnRank"}, {10, "Min/Max"} });
   t.printHeader();
   
-  auto stats = getGlobalStats(globalEvents);
-  for (auto & e : stats) {
+  for (auto & e : globalStats) {
     auto & ev = e.second;
     double rel = 0;
     if (ev.max != Event::Clock::duration::zero()) // Guard against division by zero
@@ -469,98 +646,131 @@ void EventRegistry::printGlobalStats()
   }
 }
 
+void EventRegistry::setPerRankDetail(bool detail)
+{
+  perRankDetail = detail;
+}
+
+namespace {
+
+/// Serializes names, separated by '\0'
+std::vector<char> packNames(std::vector<std::string> const & names)
+{
+  std::vector<char> buffer;
+  for (auto & name : names) {
+    buffer.insert(buffer.end(), name.begin(), name.end());
+    buffer.push_back('\0');
+  }
+  return buffer;
+}
+
+std::vector<std::string> unpackNames(std::vector<char> const & buffer)
+{
+  std::vector<std::string> names;
+  auto begin = buffer.begin();
+  while (begin != buffer.end()) {
+    auto end = std::find(begin, buffer.end(), '\0');
+    names.emplace_back(begin, end);
+    begin = end == buffer.end() ? end : end + 1;
+  }
+  return names;
+}
+
+}
 
 void EventRegistry::collect()
 {
-  #ifndef PRECICE_NO_MPI
-  // Register MPI datatype
-  MPI_Datatype MPI_EVENTDATA;
-  int blocklengths[] = {255, 2, 3, 2};
-  MPI_Aint displacements[] = {offsetof(MPI_EventData, name), offsetof(MPI_EventData, rank),
-                              offsetof(MPI_EventData, total), offsetof(MPI_EventData, dataSize)};
-  MPI_Datatype types[] = {MPI_CHAR, MPI_INT, MPI_LONG, MPI_INT};
-  MPI_Type_create_struct(4, blocklengths, displacements, types, &MPI_EVENTDATA);
-  MPI_Type_commit(&MPI_EVENTDATA);
- 
-  int rank, MPIsize;
-  MPI_Comm_rank(Parallel::getGlobalCommunicator(), &rank);
-  MPI_Comm_size(Parallel::getGlobalCommunicator(), &MPIsize);
-  
-  std::vector<MPI_Request> requests;
-  std::vector<int> eventsPerRank(MPIsize);
-  size_t eventsSize = events.size();
-  MPI_Gather(&eventsSize, 1, MPI_INT, eventsPerRank.data(), 1, MPI_INT, 0, Parallel::getGlobalCommunicator());
-
-  std::vector<MPI_EventData> eventSendBuf(events.size());
-  std::vector<std::unique_ptr<char[]>> packSendBuf(events.size());
-  int i = 0;
-  for (const auto & ev : events) {
-    MPI_EventData eventdata;
-    MPI_Request req;
-    
-    assert(ev.first.size() <= 255);
-    ev.first.copy(eventSendBuf[i].name, 255);
-    eventSendBuf[i].rank = rank;
-    eventSendBuf[i].count = ev.second.getCount();
-    eventSendBuf[i].total = ev.second.getTotal();
-    eventSendBuf[i].max = ev.second.getMax();
-    eventSendBuf[i].min = ev.second.getMin();
-    eventSendBuf[i].dataSize = ev.second.getData().size();
-    eventSendBuf[i].stateChangesSize = ev.second.stateChanges.size();
-    
-    int packSize = 0, pSize = 0;
-    // int packSize = sizeof(int) * ev.second.getData().size() +
-      // sizeof(Event::StateChanges::value_type) * ev.second.stateChanges.size();
-    MPI_Pack_size(ev.second.getData().size(), MPI_INT, Parallel::getGlobalCommunicator(), &pSize);
-    packSize += pSize;
-    MPI_Pack_size(ev.second.stateChanges.size() * sizeof(Event::StateChanges::value_type),
-                  MPI_BYTE, Parallel::getGlobalCommunicator(), &pSize);
-    packSize += pSize;
-    
-    packSendBuf[i] = std::unique_ptr<char[]>(new char[packSize]);
-    int position = 0;
-    MPI_Pack(const_cast<int*>(ev.second.getData().data()), ev.second.getData().size(),
-             MPI_INT, packSendBuf[i].get(), packSize, &position, Parallel::getGlobalCommunicator());
-    MPI_Pack(const_cast<Event::StateChanges::pointer>(ev.second.stateChanges.data()),
-             ev.second.stateChanges.size() * sizeof(Event::StateChanges::value_type),
-             MPI_BYTE, packSendBuf[i].get(), packSize, &position, Parallel::getGlobalCommunicator());
-
-    MPI_Isend(&eventSendBuf[i], 1, MPI_EVENTDATA, 0, 0, Parallel::getGlobalCommunicator(), &req);
-    requests.push_back(req);
-    MPI_Isend(packSendBuf[i].get(), position, MPI_PACKED, 0, 0, Parallel::getGlobalCommunicator(), &req);
-    requests.push_back(req);
-    ++i;
+  globalStats.clear();
+  std::vector<std::string> names;
+  for (auto & e : eventIndices) {
+    if (events[e.second].getCount() > 0)
+      names.push_back(e.first);
   }
-  
-  if (rank == 0) {
-    for (int i = 0; i < MPIsize; ++i) {
-      for (int j = 0; j < eventsPerRank[i]; ++j) {
-        MPI_EventData ev;
-        MPI_Recv(&ev, 1, MPI_EVENTDATA, i, MPI_ANY_TAG, Parallel::getGlobalCommunicator(), MPI_STATUS_IGNORE);
-        std::vector<int> recvData(ev.dataSize);
-        Event::StateChanges recvStateChanges(ev.stateChangesSize);
-        MPI_Status status;
-        int packSize = 0, position = 0;
-        MPI_Probe(i, MPI_ANY_TAG, Parallel::getGlobalCommunicator(), &status);
-        MPI_Get_count(&status, MPI_PACKED, &packSize);
-        char packBuffer[packSize];
-        MPI_Recv(packBuffer, packSize, MPI_PACKED, i, MPI_ANY_TAG,
-                 Parallel::getGlobalCommunicator(), MPI_STATUS_IGNORE);
-        MPI_Unpack(packBuffer, packSize, &position, recvData.data(), ev.dataSize, MPI_INT,
-                   Parallel::getGlobalCommunicator());
-        MPI_Unpack(packBuffer, packSize, &position, recvStateChanges.data(),
-                   ev.stateChangesSize * sizeof(Event::StateChanges::value_type), MPI_BYTE,
-                   Parallel::getGlobalCommunicator());
-          
-        globalEvents.emplace(std::piecewise_construct, std::forward_as_tuple(ev.name),
-                             std::forward_as_tuple(ev.name, ev.rank, ev.count, ev.total, ev.max, ev.min,
-                                                   recvData, recvStateChanges));
-
-      }
+
+  #ifndef PRECICE_NO_MPI
+  auto & comm = communicator;
+
+  // Merge the sorted names of all ranks along a binary tree towards rank 0 and broadcast the result,
+  // which gives the same table of events on all ranks.
+  for (int step = 1; step < size; step *= 2) {
+    if (rank % (2 * step) == step) {
+      std::vector<char> buffer = packNames(names);
+      MPI_Send(buffer.data(), buffer.size(), MPI_CHAR, rank - step, 0, comm);
+      break;
+    }
+    if (rank + step < size) {
+      MPI_Status status;
+      int count = 0;
+      MPI_Probe(rank + step, 0, comm, &status);
+      MPI_Get_count(&status, MPI_CHAR, &count);
+      std::vector<char> buffer(count);
+      MPI_Recv(buffer.data(), count, MPI_CHAR, rank + step, 0, comm, MPI_STATUS_IGNORE);
+      std::vector<std::string> received = unpackNames(buffer);
+      std::vector<std::string> merged;
+      std::set_union(names.begin(), names.end(), received.begin(), received.end(), std::back_inserter(merged));
+      names.swap(merged);
     }
-  }    
-  MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
-  MPI_Type_free(&MPI_EVENTDATA);
+  }
+  std::vector<char> buffer = packNames(names);
+  int bufferSize = buffer.size();
+  MPI_Bcast(&bufferSize, 1, MPI_INT, 0, comm);
+  buffer.resize(bufferSize);
+  MPI_Bcast(buffer.data(), bufferSize, MPI_CHAR, 0, comm);
+  names = unpackNames(buffer);
+
+  // Reduce the statistics over the common table
+  struct DoubleInt
+  {
+    double value;
+    int rank;
+  };
+  size_t const n = names.size();
+  std::vector<long> counts(n, 0), ranks(n, 0);
+  std::vector<double> totals(n, 0.0);
+  std::vector<DoubleInt> mins(n, DoubleInt{std::numeric_limits<double>::max(), rank});
+  std::vector<DoubleInt> maxs(n, DoubleInt{-1.0, rank});
+  for (size_t i = 0; i < n; i++) {
+    auto found = eventIndices.find(names[i]);
+    if (found == eventIndices.end() or events[found->second].getCount() == 0)
+      continue;
+    auto & data = events[found->second];
+    counts[i] = data.getCount();
+    ranks[i] = 1;
+    totals[i] = data.total.count();
+    mins[i].value = data.min.count();
+    maxs[i].value = data.max.count();
+  }
+  bool const isRoot = rank == 0;
+  MPI_Reduce(isRoot ? MPI_IN_PLACE : counts.data(), counts.data(), n, MPI_LONG, MPI_SUM, 0, comm);
+  MPI_Reduce(isRoot ? MPI_IN_PLACE : ranks.data(), ranks.data(), n, MPI_LONG, MPI_SUM, 0, comm);
+  MPI_Reduce(isRoot ? MPI_IN_PLACE : totals.data(), totals.data(), n, MPI_DOUBLE, MPI_SUM, 0, comm);
+  MPI_Reduce(isRoot ? MPI_IN_PLACE : mins.data(), mins.data(), n, MPI_DOUBLE_INT, MPI_MINLOC, 0, comm);
+  MPI_Reduce(isRoot ? MPI_IN_PLACE : maxs.data(), maxs.data(), n, MPI_DOUBLE_INT, MPI_MAXLOC, 0, comm);
+  if (not isRoot)
+    return;
+
+  for (size_t i = 0; i < n; i++) {
+    GlobalEventStats & stats = globalStats[names[i]];
+    stats.count = counts[i];
+    stats.ranks = ranks[i];
+    stats.total = Event::Clock::duration(static_cast<Event::Clock::rep>(totals[i]));
+    stats.min = Event::Clock::duration(static_cast<Event::Clock::rep>(mins[i].value));
+    stats.minRank = mins[i].rank;
+    stats.max = Event::Clock::duration(static_cast<Event::Clock::rep>(maxs[i].value));
+    stats.maxRank = maxs[i].rank;
+  }
+  #else
+  for (auto & name : names) {
+    auto & data = events[eventIndices.at(name)];
+    GlobalEventStats & stats = globalStats[name];
+    stats.count = data.getCount();
+    stats.ranks = 1;
+    stats.total = data.total;
+    stats.min = data.min;
+    stats.minRank = 0;
+    stats.max = data.max;
+    stats.maxRank = 0;
+  }
   #endif
 }
 
@@ -569,8 +779,8 @@ size_t EventRegistry::getMaxNameWidth()
 {
   size_t maxEventWidth = 0;
   for (auto & ev : events)
-    if (ev.second.getName().size() > maxEventWidth)
-      maxEventWidth = ev.second.getName().size();
+    if (ev.getName().size() > maxEventWidth)
+      maxEventWidth = ev.getName().size();
   
   return maxEventWidth;
 }
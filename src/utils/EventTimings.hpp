@@ -1,15 +1,39 @@
 #pragma once
 
 #include <chrono>
+#include <deque>
+#include <fstream>
 #include <list>
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include <string>
 #include "logging/Logger.hpp"
+#include "utils/Parallel.hpp"
+
+// Forward declaration to friend the boost test struct
+namespace UtilsTests {
+namespace EventTimingsTests {
+struct ParallelStatistics;
+}}
 
 namespace precice {
 namespace utils {
 
+/// Handle of an event name, interned by EventRegistry::getEventID().
+/** Events created from an EventID neither build nor look up strings, which makes them cheap enough for
+hot paths. Create the handle once per site, e.g. as function-local static or as member. */
+struct EventID
+{
+  /// Index of the interned name, negative if not interned yet
+  int index = -1;
+
+  bool isValid() const
+  {
+    return index >= 0;
+  }
+};
+
 /// Represents an event that can be started and stopped.
 /** Additionally to the duration there is a special property that can be set for a event.
 A property is a a key-value pair with a numerical value that can be used to trace certain events,
@@ -42,6 +66,9 @@ public:
   /** Use barrier == true with caution, as it can lead to deadlocks. */
   Event(std::string eventName, bool barrier = false, bool autostart = true);
 
+  /// Creates a new event from an interned name, otherwise like the constructor above.
+  Event(EventID eventID, bool barrier = false, bool autostart = true);
+
   /// Stops the event if it's running and report its times to the EventRegistry
   ~Event();
 
@@ -57,6 +84,9 @@ public:
   /// Gets the duration of the event.
   Clock::duration getDuration();
 
+  /// Returns the full name of the event, including the prefix.
+  std::string getName() const;
+
   std::vector<int> data;
 
   StateChanges stateChanges;
@@ -68,8 +98,13 @@ private:
   Clock::duration duration = Clock::duration::zero();
   State state = State::STOPPED;
   bool _barrier = false;
-  logging::Logger _log{"utils::Events"};
-  
+
+  /// Index of the EventData in the EventRegistry, negative for events created by name
+  int _index = -1;
+
+  static logging::Logger _log;
+
+  friend class EventRegistry;
 };
 
 
@@ -78,13 +113,10 @@ private:
 class EventData
 {
 public:
-  explicit EventData(std::string _name);
-  
-  EventData(std::string _name, int _rank, long _count, long _total,
-            long _max, long _min, std::vector<int> _data, Event::StateChanges stateChanges);
+  EventData(std::string _name, int _rank);
   
-  /// Adds an Events data.
-  void put(Event* event);
+  /// Adds an Events data. The state changes are only kept, if keepRecords is true.
+  void put(Event* event, bool keepRecords = true);
 
   std::string getName() const;
 
@@ -108,6 +140,9 @@ public:
 
   const std::vector<int> & getData() const;
 
+  /// Drops the attached data, e.g., after it has been streamed to a file.
+  void clearData();
+
   void print(std::ostream &out);
 
   void writeCSV(std::ostream &out);
@@ -130,14 +165,15 @@ private:
 /// Holds data aggregated from all MPI ranks for one event
 struct GlobalEventStats
 {
-  // std::string name;
   int maxRank, minRank;
   Event::Clock::duration max   = Event::Clock::duration::min();
   Event::Clock::duration min   = Event::Clock::duration::max();
-};
-
+  Event::Clock::duration total = Event::Clock::duration::zero();
+  long count = 0;
 
-using GlobalEvents = std::multimap<std::string, EventData>;
+  /// Number of ranks that recorded the event
+  int ranks = 0;
+};
 
 /// High level object that stores data of all events.
 /** Call EventRegistry::intialize at the beginning of your application and
@@ -156,6 +192,9 @@ public:
   
   /// Sets the global start time
   /**
+   * Needs to be called on all ranks of the global communicator. The ranks with the same applicationName
+   * form the communicator printAll() is collective on.
+   *
    * @param[in] applicationName A name that is added to the logfile to distinguish different participants
    * @param[in] run A name of the run, will be printed as a separate column with each Event.
    */
@@ -164,6 +203,25 @@ public:
   /// Sets the global end time
   void finalize();
 
+  /// Enables streaming of the events to files of every rank, must be called before initialize().
+  /**
+   * Instead of keeping all state changes in memory until finalize, they are written to
+   * APPNAME-events-RANK.log whenever bufferSize of them have been recorded. Every flushInterval
+   * seconds, the statistics of all events are appended to APPNAME-eventTimings-RANK.log.
+   * Each line of statistics holds the data attached to the event since the previous line. The statistics
+   * are also written earlier, if bufferSize data values have been attached. Hence, the data is only contained
+   * in these files and not in the file written by printAll().
+   * Both files use the same format as the files written by printAll().
+   *
+   * @param[in] flushInterval Seconds between writing statistics, streaming is disabled if not positive
+   * @param[in] bufferSize Number of state changes and of data values held in memory
+   */
+  void setStreaming(double flushInterval, size_t bufferSize = 4096);
+
+  /// Enables or disables writing the statistics and state changes of every rank in printAll().
+  /** If disabled, only the statistics aggregated over all ranks are written and no event log. */
+  void setPerRankDetail(bool perRankDetail);
+
   /// Clears the registry. needed for tests
   void clear();
 
@@ -173,6 +231,17 @@ public:
   /// Records the event.
   void put(Event* event);
 
+  /// Interns an event name, which is then cheap to create events from.
+  /**
+   * Events created in every iteration, e.g. in Mapping::map(), should keep the ID in a member and
+   * only intern the name on first use, which avoids building and looking up the name each time.
+   * The current prefix is not part of the interned name, but applied whenever an event is created.
+   */
+  EventID getEventID(std::string const & name);
+
+  /// Returns the data recorded so far for the event with the given full name.
+  const EventData & getEventData(std::string const & fullName);
+
   /// Make this returning a reference or smart ptr?
   Event & getStoredEvent(std::string const & name);
 
@@ -183,6 +252,7 @@ public:
   Event::Clock::duration getDuration();
 
   /// Prints a verbose report to stdout and a terse one to EventTimings-AppName.log
+  /** Needs to be called on all ranks of the participant after initialize(), as the files are written collectively. */
   void printAll();
 
   /// Prints the result table to an arbitrary stream.
@@ -192,14 +262,22 @@ public:
   /// Convenience function: Prints to std::cout
   void print();
 
+  /// Appends the statistics to a CSV file, needs to be called on all ranks of the participant.
   void writeCSV(std::string filename);
 
+  /// Appends the state changes to a CSV file, needs to be called on all ranks of the participant.
   void writeEventLogs(std::string filename);
   
+  /// Prints the statistics aggregated over all ranks of the participant, only available on rank 0 in printAll().
   void printGlobalStats();
 
-  /// Currently active prefix. Changing that applies to newly created events.
-  std::string prefix;
+  /// Sets the currently active prefix. Changing that applies to newly created events.
+  void setPrefix(std::string const & newPrefix);
+
+  std::string const & getPrefix() const
+  {
+    return prefix;
+  }
   
   /// A name that is added to the logfile to identify a run
   std::string runName;
@@ -208,32 +286,108 @@ private:
   /// Private, empty constructor for singleton pattern
   EventRegistry()
     : globalEvent("_GLOBAL", true, false) // Unstarted, it's started in initialize
-  {}
+  {
+    setPrefix("");
+  }
+
+  /// Returns the index of the EventData with the given full name, creates it if needed.
+  int getEventIndex(std::string const & fullName);
+
+  /// Returns the index of the EventData of the interned name under the current prefix.
+  int getEventIndex(EventID eventID);
   
-  /// Gather EventData from all ranks on rank 0.
+  /// Aggregates the statistics of all ranks of the participant on rank 0 by reductions over a common table of event names.
   void collect();
+
+  /// Appends text of all ranks of the participant in rank order to a file, header is only written by rank 0 to a new file.
+  void writeOrdered(std::string const & filename, std::string const & header, std::string const & text);
   
   /// Returns length of longest name
   size_t getMaxNameWidth();
 
+  /// Writes the buffered state changes and, if forced or the flush interval has passed, the statistics
+  void flushStream(bool force);
+
+  /// A state change buffered for streaming
+  struct StateChangeRecord
+  {
+    int eventIndex;
+    Event::State state;
+    Event::Clock::time_point timestamp;
+  };
+
   /// Event for measuring global time, also acts as a barrier
   Event globalEvent;
   
   bool initialized = false;
+
+  /// Communicator of the ranks with the same application name, set in initialize()
+  Parallel::Communicator communicator = MPI_COMM_NULL;
+
+  /// Rank in and size of the communicator
+  int rank = 0;
+  int size = 1;
   
   /// Timestamp when the run finished
   std::chrono::system_clock::time_point timestamp;
 
-  /// Map of name -> events for this rank only
-  std::map<std::string, EventData> events;
+  /// Timestamp and time point when the run started
+  std::chrono::system_clock::time_point runStartTimestamp;
+  Event::Clock::time_point runStart;
+
+  /// Seconds between writing statistics in streaming mode, streaming is disabled if not positive
+  double flushInterval = 0;
+
+  size_t streamBufferSize = 0;
+
+  std::vector<StateChangeRecord> streamBuffer;
+
+  /// Number of data values attached to events since the statistics have been written
+  size_t streamedDataSize = 0;
+
+  Event::Clock::time_point lastFlush;
+
+  std::ofstream eventLogStream;
+
+  std::ofstream timingsStream;
+
+  /// Events for this rank only. A deque, s.t. references stay valid when events are added.
+  std::deque<EventData> events;
+
+  /// Map of full name -> index in events, also defines the order of output
+  std::map<std::string, int> eventIndices;
+
+  /// Interned names, indexed by EventID
+  std::vector<std::string> eventIDNames;
+
+  std::unordered_map<std::string, int> eventIDs;
+
+  /// Currently active prefix
+  std::string prefix;
+
+  /// Index of the current prefix in resolvedIndices
+  int prefixIndex = 0;
+
+  std::map<std::string, int> prefixIndices;
+
+  /// Per prefix: EventID -> index in events, negative if not resolved yet
+  std::vector<std::vector<int>> resolvedIndices;
+
+  friend class Event;
 
   std::map<std::string, Event> storedEvents;
 
-  /// Multimap of name -> EventData of events for all ranks
-  GlobalEvents globalEvents;
+  /// Statistics aggregated over all ranks, only set on rank 0
+  std::map<std::string, GlobalEventStats> globalStats;
+
+  bool perRankDetail = true;
 
   /// A name that is added to the logfile to distinguish different participants
   std::string applicationName;
+
+  static logging::Logger _log;
+
+  friend struct UtilsTests::EventTimingsTests::ParallelStatistics;
 };
 
 
@@ -244,13 +398,13 @@ public:
   
   ScopedEventPrefix(const std::string & name)
   {
-    previousName = EventRegistry::instance().prefix;
-    EventRegistry::instance().prefix += name;
+    previousName = EventRegistry::instance().getPrefix();
+    EventRegistry::instance().setPrefix(previousName + name);
   }
 
   ~ScopedEventPrefix()
   {
-    EventRegistry::instance().prefix = previousName;
+    EventRegistry::instance().setPrefix(previousName);
   }
   
 private:
@@ -208,6 +208,18 @@ void Parallel::synchronizeProcesses()
 #endif // not PRECICE_NO_MPI
 }
 
+void Parallel::broadcast(std::vector<int> &values, int rankBroadcaster)
+{
+#ifndef PRECICE_NO_MPI
+  TRACE(values.size(), rankBroadcaster);
+  assertion(_isInitialized);
+  int size = values.size();
+  MPI_Bcast(&size, 1, MPI_INT, rankBroadcaster, _globalCommunicator);
+  values.resize(size);
+  MPI_Bcast(values.data(), size, MPI_INT, rankBroadcaster, _globalCommunicator);
+#endif // not PRECICE_NO_MPI
+}
+
 void Parallel::synchronizeLocalProcesses()
 {
 #ifndef PRECICE_NO_MPI
@@ -73,6 +73,13 @@ public:
   /// Synchronizes all processes.
   static void synchronizeProcesses();
 
+  /**
+   * @brief Broadcasts values from rankBroadcaster to all processes of the global communicator.
+   *
+   * The receiving processes resize values to the size given by the broadcasting one.
+   */
+  static void broadcast(std::vector<int> &values, int rankBroadcaster);
+
   /**
    * @brief Synchronizes all local processes.
    *
@@ -1,5 +1,7 @@
 #include "Petsc.hpp"
 #include "utils/Parallel.hpp"
+#include "utils/assertion.hpp"
+#include "versions.hpp"
 
 #ifndef PRECICE_NO_PETSC
 #include "petsc.h"
@@ -485,6 +487,74 @@ bool KSPSolver::solveTranspose(Vector &b, Vector &x)
   return (convReason > 0);
 }
 
+bool KSPSolver::solve(std::vector<Vector *> const &bs, std::vector<Vector *> const &xs)
+{
+  assertion(bs.size() == xs.size(), bs.size(), xs.size());
+  if (bs.empty())
+    return true;
+  if (bs.size() == 1)
+    return solve(*bs.front(), *xs.front());
+
+#if PETSC_MAJOR > 3 or (PETSC_MAJOR == 3 and PETSC_MINOR >= 14)
+  PetscErrorCode ierr = 0;
+  PetscInt const nrhs = bs.size();
+  MPI_Comm       comm;
+  ierr = PetscObjectGetComm((PetscObject) ksp, &comm); CHKERRQ(ierr);
+
+  // Creates a dense matrix with the layout of v and one column per right-hand side
+  auto createDense = [&](Vector &v, Mat *m) -> PetscErrorCode {
+    PetscInt localRows, globalRows;
+    PetscErrorCode ierr = 0;
+    ierr = VecGetLocalSize(v, &localRows); CHKERRQ(ierr);
+    ierr = VecGetSize(v, &globalRows); CHKERRQ(ierr);
+    ierr = MatCreateDense(comm, localRows, PETSC_DECIDE, globalRows, nrhs, nullptr, m); CHKERRQ(ierr);
+    return ierr;
+  };
+
+  Mat B = nullptr, X = nullptr;
+  KSPConvergedReason convReason = KSP_CONVERGED_ITERATING;
+
+  // Runs in a function, s.t. B and X are also destroyed if any of the calls fails
+  auto solveDense = [&]() -> PetscErrorCode {
+    PetscErrorCode ierr = 0;
+    ierr = createDense(*bs.front(), &B); CHKERRQ(ierr);
+    ierr = createDense(*xs.front(), &X); CHKERRQ(ierr);
+    for (PetscInt k = 0; k < nrhs; k++) {
+      Vec column;
+      ierr = MatDenseGetColumnVecWrite(B, k, &column); CHKERRQ(ierr);
+      ierr = VecCopy(*bs[k], column); CHKERRQ(ierr);
+      ierr = MatDenseRestoreColumnVecWrite(B, k, &column); CHKERRQ(ierr);
+      ierr = MatDenseGetColumnVecWrite(X, k, &column); CHKERRQ(ierr);
+      ierr = VecCopy(*xs[k], column); CHKERRQ(ierr);
+      ierr = MatDenseRestoreColumnVecWrite(X, k, &column); CHKERRQ(ierr);
+    }
+
+    ierr = KSPMatSolve(ksp, B, X); CHKERRQ(ierr);
+    ierr = KSPGetConvergedReason(ksp, &convReason); CHKERRQ(ierr);
+
+    for (PetscInt k = 0; k < nrhs; k++) {
+      Vec column;
+      ierr = MatDenseGetColumnVecRead(X, k, &column); CHKERRQ(ierr);
+      ierr = VecCopy(column, *xs[k]); CHKERRQ(ierr);
+      ierr = MatDenseRestoreColumnVecRead(X, k, &column); CHKERRQ(ierr);
+    }
+    return ierr;
+  };
+
+  PetscErrorCode solveError = solveDense();
+  ierr = MatDestroy(&B); CHKERRQ(ierr);
+  ierr = MatDestroy(&X); CHKERRQ(ierr);
+  CHKERRQ(solveError);
+  return (convReason > 0);
+#else
+  bool converged = true;
+  for (size_t k = 0; k < bs.size(); k++) {
+    converged = solve(*bs[k], *xs[k]) and converged;
+  }
+  return converged;
+#endif
+}
+
 
 /////////////////////////////////////////////////////////////////////////
 
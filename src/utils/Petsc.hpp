@@ -36,6 +36,7 @@ private:
 
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "petscvec.h"
 #include "petscmat.h"
@@ -223,6 +224,15 @@ public:
 
   /// Solves the transposed linear system, returns false it not converged
   bool solveTranspose(Vector &b, Vector &x);
+
+  /**
+   * @brief Solves the linear system for several right-hand sides, returns false if not converged
+   *
+   * With PETSc >= 3.14, all right-hand sides are solved at once by KSPMatSolve on dense
+   * multi-column matrices. Otherwise, the systems are solved one after another.
+   * The entries of xs are used as initial guesses, if the KSP is set to a nonzero initial guess.
+   */
+  bool solve(std::vector<Vector *> const &bs, std::vector<Vector *> const &xs);
 };
 
 
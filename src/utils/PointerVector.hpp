@@ -129,6 +129,12 @@ public:
       _content.clear ();
    }
 
+   /// Reserves storage for at least size pointers.
+   void reserve ( size_t size )
+   {
+      _content.reserve ( size );
+   }
+
    /**
     * @brief Returns true, if no pointers are contained in the vector.
     */
@@ -4,17 +4,25 @@
 
 #include <boost/filesystem.hpp>
 
+#include <algorithm>
 #include <fstream>
 #include <sstream>
+#include <thread>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
 
 namespace precice
 {
 namespace utils
 {
 
-std::string Publisher::_pdp;
+thread_local std::string Publisher::_pdp;
 
-std::stack<std::string> Publisher::_dps;
+thread_local std::stack<std::string> Publisher::_dps;
 
 Publisher::ScopedPushDirectory::ScopedPushDirectory(std::string const &dp)
 {
@@ -102,14 +110,109 @@ Publisher::Publisher(std::string const &fp)
 {
 }
 
+namespace
+{
+
+/// First and maximal time to wait between two attempts to open a published file
+const std::chrono::milliseconds MIN_WAIT(1);
+const std::chrono::milliseconds MAX_WAIT(256);
+
+/**
+ * @brief Waits until the given file is published, but at most for the given time.
+ *
+ * On Linux, inotify wakes up the caller as soon as the file is renamed into its directory, which is the last step
+ * of Publisher::write(). Other files in the directory, including temporary files of writers, do not wake up the caller.
+ * Shared file systems often do not report changes of other hosts, hence the timeout still applies.
+ */
+class FileWatch
+{
+public:
+  explicit FileWatch(std::string const &filePath)
+  {
+#ifdef __linux__
+    boost::filesystem::path path(filePath);
+    std::string directory = path.parent_path().string();
+    _fileName = path.filename().string();
+    _fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (_fd >= 0 and inotify_add_watch(_fd, directory.empty() ? "." : directory.c_str(), IN_MOVED_TO) < 0) {
+      close(_fd);
+      _fd = -1;
+    }
+#endif
+  }
+
+  ~FileWatch()
+  {
+#ifdef __linux__
+    if (_fd >= 0)
+      close(_fd);
+#endif
+  }
+
+  void wait(std::chrono::milliseconds timeout)
+  {
+#ifdef __linux__
+    if (_fd >= 0) {
+      auto const deadline  = std::chrono::steady_clock::now() + timeout;
+      auto       remaining = timeout;
+      while (remaining.count() > 0) {
+        pollfd pfd{_fd, POLLIN, 0};
+        if (poll(&pfd, 1, static_cast<int>(remaining.count())) > 0 and readEvents())
+          return;
+        remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+      }
+      return;
+    }
+#endif
+    std::this_thread::sleep_for(timeout);
+  }
+
+private:
+#ifdef __linux__
+  /// Reads all pending events, returns true if one of them refers to the watched file
+  bool readEvents()
+  {
+    alignas(inotify_event) char buffer[4096];
+    bool    found = false;
+    ssize_t length;
+    while ((length = ::read(_fd, buffer, sizeof(buffer))) > 0) {
+      for (char const *p = buffer; p < buffer + length;) {
+        auto const *event = reinterpret_cast<inotify_event const *>(p);
+        if (event->len > 0 and _fileName == event->name)
+          found = true;
+        p += sizeof(inotify_event) + event->len;
+      }
+    }
+    return found;
+  }
+
+  std::string _fileName;
+#endif
+
+  int _fd = -1;
+};
+
+} // namespace
+
 std::string Publisher::read() const
 {
   std::ifstream ifs;
   std::string   data;
 
-  do {
+  ifs.open(filePath(), std::ifstream::in);
+  if (not ifs) {
+    // Wait with exponential backoff, s.t. many waiting ranks do not flood the file system with requests
+    FileWatch watch(filePath());
+    std::chrono::milliseconds timeout = MIN_WAIT;
+    ifs.clear();
     ifs.open(filePath(), std::ifstream::in);
-  } while (not ifs);
+    while (not ifs) {
+      watch.wait(timeout);
+      timeout = std::min(2 * timeout, MAX_WAIT);
+      ifs.clear();
+      ifs.open(filePath(), std::ifstream::in);
+    }
+  }
 
   std::chrono::milliseconds::rep writeTimeStampCount;
 
@@ -57,6 +57,11 @@ public:
 public:
   explicit Publisher(std::string const &fp);
 
+  /// Waits until the file has been written and returns its data.
+  /**
+   * Between two attempts to open the file, it waits for changes in the directory with inotify,
+   * where available, or for an exponentially growing timeout of at most 256ms.
+   */
   std::string read() const;
 
   void write(std::string const &data) const;
@@ -66,9 +71,10 @@ public:
 private:
   static std::string buildFilePath(std::string const &fp);
 
-  static std::string _pdp;
+  /// Prefix directory path, per thread s.t. connections can be set up concurrently
+  static thread_local std::string _pdp;
 
-  static std::stack<std::string> _dps;
+  static thread_local std::stack<std::string> _dps;
 
 private:
   std::string _fp;
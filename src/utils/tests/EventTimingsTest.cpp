@@ -0,0 +1,234 @@
+#include <boost/filesystem.hpp>
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include "testing/Testing.hpp"
+#include "utils/EventTimings.hpp"
+#include "utils/Parallel.hpp"
+
+using namespace precice::utils;
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+BOOST_AUTO_TEST_SUITE(EventTimingsTests)
+
+BOOST_AUTO_TEST_CASE(InternedEvents)
+{
+  EventRegistry & registry = EventRegistry::instance();
+  EventID eventID = registry.getEventID("test.interned");
+  BOOST_TEST(eventID.isValid());
+  BOOST_TEST(registry.getEventID("test.interned").index == eventID.index);
+
+  {
+    Event e(eventID);
+  }
+  {
+    Event e("test.interned");
+  }
+  BOOST_TEST(registry.getEventData("test.interned").getCount() == 2);
+
+  // The prefix is applied when the event is created, not when the name is interned
+  {
+    ScopedEventPrefix sep("prefixed/");
+    Event e(eventID);
+    BOOST_TEST(e.getName() == "prefixed/test.interned");
+  }
+  BOOST_TEST(registry.getEventData("prefixed/test.interned").getCount() == 1);
+  BOOST_TEST(registry.getEventData("test.interned").getCount() == 2);
+
+  Event paused(eventID);
+  paused.pause();
+  paused.start();
+  paused.stop();
+  BOOST_TEST(registry.getEventData("test.interned").getCount() == 3);
+}
+
+BOOST_AUTO_TEST_CASE(Streaming)
+{
+  namespace fs = boost::filesystem;
+  fs::path directory = fs::temp_directory_path() / fs::unique_path("precice-events-%%%%-%%%%");
+  fs::create_directories(directory);
+  std::string const name = (directory / "streaming").string();
+  // Every rank uses its own name, hence it is rank 0 of its own participant
+  std::string const rank = "0";
+
+  EventRegistry & registry = EventRegistry::instance();
+  registry.setStreaming(3600, 4);
+  registry.initialize(name, "StreamingRun");
+  for (int i = 0; i < 10; i++) {
+    Event e("test.streamed");
+    e.data.push_back(i);
+  }
+
+  // At most 4 state changes and data values are held in memory, the rest has been written
+  EventData const & eventData = registry.getEventData("test.streamed");
+  BOOST_TEST(eventData.getCount() == 10);
+  BOOST_TEST(eventData.getData().size() < 4);
+  BOOST_TEST(eventData.stateChanges.empty());
+  int stateChanges = -1; // without the header
+  {
+    std::ifstream events(name + "-events-" + rank + ".log");
+    std::string line;
+    while (std::getline(events, line))
+      stateChanges++;
+  }
+  BOOST_TEST(stateChanges >= 16);
+
+  registry.finalize();
+  registry.setStreaming(0);
+
+  // The attached data is written with the statistics, none of it is lost
+  std::vector<int> data;
+  std::ifstream timings(name + "-eventTimings-" + rank + ".log");
+  std::string line;
+  while (std::getline(timings, line)) {
+    if (line.find(",test.streamed,") == std::string::npos)
+      continue;
+    auto first = line.find("\"[") + 2;
+    std::istringstream values(line.substr(first, line.find("]\"") - first));
+    std::string value;
+    while (std::getline(values, value, ','))
+      data.push_back(std::stoi(value));
+  }
+  std::vector<int> expected{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  BOOST_TEST(data == expected, boost::test_tools::per_element());
+
+  registry.clear();
+  fs::remove_all(directory);
+}
+
+#ifndef PRECICE_NO_MPI
+
+/// Two participants on two ranks each, which share the global communicator as with mpi-single
+BOOST_AUTO_TEST_CASE(ParallelStatistics, * precice::testing::OnSize(4))
+{
+  using std::chrono::milliseconds;
+  auto toMs = [](Event::Clock::duration duration) {
+    return std::chrono::duration_cast<milliseconds>(duration).count();
+  };
+  int const globalRank = Parallel::getProcessRank();
+  std::string const participant = globalRank < 2 ? "A" : "B";
+  std::string const other = globalRank < 2 ? "B" : "A";
+  int const localRank = globalRank % 2;
+  std::string const name = "EventTimingsTest-" + participant;
+  std::string const csvFile = name + "-eventTimings.log";
+  std::string const logFile = name + "-events.log";
+
+  EventRegistry & registry = EventRegistry::instance();
+  for (bool perRankDetail : {false, true}) {
+    if (localRank == 0) {
+      std::remove(csvFile.c_str());
+      std::remove(logFile.c_str());
+    }
+    registry.clear();
+    registry.setPerRankDetail(perRankDetail);
+    registry.initialize(name, "ParallelRun");
+    BOOST_TEST(registry.size == 2);
+    BOOST_TEST(registry.rank == localRank);
+
+    // All ranks of the participant use the start timestamp of rank 0
+    long long start = registry.runStartTimestamp.time_since_epoch().count();
+    long long minStart = 0, maxStart = 0;
+    MPI_Allreduce(&start, &minStart, 1, MPI_LONG_LONG, MPI_MIN, registry.communicator);
+    MPI_Allreduce(&start, &maxStart, 1, MPI_LONG_LONG, MPI_MAX, registry.communicator);
+    BOOST_TEST(minStart == maxStart);
+
+    // A: 1 x 10ms on rank 0, 2 x 20ms on rank 1. B: 3 x 30ms on rank 0, 4 x 40ms on rank 1
+    for (int i = 0; i <= globalRank; i++) {
+      Event e("test.shared", milliseconds(10 * (globalRank + 1)));
+    }
+    if (localRank == 1) {
+      Event e("test." + participant + ".rank1", milliseconds(5));
+    }
+    {
+      Event e("test.timed");
+    }
+    registry.finalize();
+    registry.printAll();
+
+    if (localRank != 0)
+      continue;
+
+    // The table of names holds the events of all ranks of this participant only
+    auto & stats = registry.globalStats;
+    BOOST_TEST(stats.count("test.shared") == 1);
+    BOOST_TEST(stats.count("test." + participant + ".rank1") == 1);
+    BOOST_TEST(stats.count("test." + other + ".rank1") == 0);
+
+    auto & shared = stats.at("test.shared");
+    BOOST_TEST(shared.ranks == 2);
+    BOOST_TEST(shared.minRank == 0);
+    BOOST_TEST(shared.maxRank == 1);
+    if (participant == "A") {
+      BOOST_TEST(shared.count == 3);
+      BOOST_TEST(toMs(shared.total) == 50);
+      BOOST_TEST(toMs(shared.min) == 10);
+      BOOST_TEST(toMs(shared.max) == 20);
+    } else {
+      BOOST_TEST(shared.count == 7);
+      BOOST_TEST(toMs(shared.total) == 250);
+      BOOST_TEST(toMs(shared.min) == 30);
+      BOOST_TEST(toMs(shared.max) == 40);
+    }
+    auto & rank1 = stats.at("test." + participant + ".rank1");
+    BOOST_TEST(rank1.count == 1);
+    BOOST_TEST(rank1.ranks == 1);
+    BOOST_TEST(rank1.minRank == 1);
+    BOOST_TEST(rank1.maxRank == 1);
+
+    // Rows of test.shared hold Rank,Name,Count,Total,Min,Max
+    std::vector<std::string> rows;
+    std::ifstream csv(csvFile);
+    std::string line;
+    while (std::getline(csv, line)) {
+      auto position = line.find(",test.shared,");
+      if (position == std::string::npos)
+        continue;
+      auto rankBegin = line.rfind(',', position - 1) + 1;
+      auto end = position;
+      for (int column = 0; column < 5; column++)
+        end = line.find(',', end + 1);
+      rows.push_back(line.substr(rankBegin, end - rankBegin));
+    }
+    std::vector<std::string> expected;
+    if (perRankDetail and participant == "A")
+      expected = {"0,test.shared,1,10,10,10", "1,test.shared,2,40,20,20"};
+    else if (perRankDetail)
+      expected = {"0,test.shared,3,90,30,30", "1,test.shared,4,160,40,40"};
+    else if (participant == "A")
+      expected = {"-1,test.shared,3,50,10,20"};
+    else
+      expected = {"-1,test.shared,7,250,30,40"};
+    BOOST_TEST(rows == expected, boost::test_tools::per_element());
+
+    // The event log is only written with details, in rank order and with one RunTimestamp
+    std::vector<std::string> ranks;
+    std::set<std::string> runTimestamps;
+    std::ifstream log(logFile);
+    BOOST_TEST(log.is_open() == perRankDetail);
+    while (std::getline(log, line)) {
+      if (line.find(",test.timed,") == std::string::npos)
+        continue;
+      auto position = line.find(",test.timed,") + std::string(",test.timed,").size();
+      ranks.push_back(line.substr(position, line.find(',', position) - position));
+      runTimestamps.insert(line.substr(0, line.find(',')));
+    }
+    if (perRankDetail) {
+      std::vector<std::string> expectedRanks{"0", "0", "1", "1"};
+      BOOST_TEST(ranks == expectedRanks, boost::test_tools::per_element());
+      BOOST_TEST(runTimestamps.size() == 1);
+    }
+  }
+
+  registry.setPerRankDetail(true);
+  registry.clear();
+  if (localRank == 0) {
+    std::remove(csvFile.c_str());
+    std::remove(logFile.c_str());
+  }
+}
+
+#endif // not PRECICE_NO_MPI
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
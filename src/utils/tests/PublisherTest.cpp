@@ -0,0 +1,53 @@
+#include <boost/filesystem.hpp>
+#include <chrono>
+#include <thread>
+#include "testing/Testing.hpp"
+#include "utils/Publisher.hpp"
+
+using namespace precice;
+using precice::utils::Publisher;
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+BOOST_AUTO_TEST_SUITE(PublisherTests)
+
+BOOST_AUTO_TEST_CASE(ReadWaitsForWrite)
+{
+  namespace fs = boost::filesystem;
+  fs::path directory = fs::temp_directory_path() / fs::unique_path("precice-publisher-%%%%-%%%%");
+  fs::create_directories(directory);
+  std::string const file = (directory / "test.address").string();
+
+  std::thread writer([&file]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    Publisher(file).write("address:1234");
+  });
+  BOOST_TEST(Publisher(file).read() == "address:1234");
+  writer.join();
+
+  // The file exists now, hence reading returns immediately
+  BOOST_TEST(Publisher(file).read() == "address:1234");
+  fs::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_CASE(ReadIgnoresOtherFiles)
+{
+  namespace fs = boost::filesystem;
+  fs::path directory = fs::temp_directory_path() / fs::unique_path("precice-publisher-%%%%-%%%%");
+  fs::create_directories(directory);
+  std::string const file  = (directory / "test.address").string();
+  std::string const other = (directory / "other.address").string();
+
+  // Other files published in the same directory must not be mistaken for the awaited one
+  std::thread writer([&file, &other]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    Publisher(other).write("other:1");
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    Publisher(file).write("address:1234");
+  });
+  BOOST_TEST(Publisher(file).read() == "address:1234");
+  writer.join();
+  fs::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,6 +1,9 @@
 #include "ConfigParser.hpp"
 #include <libxml/SAX.h>
+#include <cstring>
 #include <fstream>
+#include <unordered_set>
+#include "utils/assertion.hpp"
 
 namespace precice
 {
@@ -55,6 +58,78 @@ void OnCharacters(void *ctx, const xmlChar *ch, int len)
   pParser->OnTextSection(std::string(reinterpret_cast<const char *>(ch), len));
 }
 
+// ------------------------- Serialization of read tags  -------------------------
+
+namespace
+{
+
+/// Version of the format written by ConfigParser::serialize()
+constexpr int SERIALIZATION_VERSION = 1;
+
+/// Assigns consecutive indices to strings, s.t. every distinct string is stored once
+class StringTable
+{
+public:
+  int index(const std::string &string)
+  {
+    auto inserted = _indices.emplace(string, static_cast<int>(_strings.size()));
+    if (inserted.second) {
+      _strings.push_back(&inserted.first->first);
+    }
+    return inserted.first->second;
+  }
+
+  /// Appends the number of strings and every string as length and characters
+  void write(std::vector<int> &buffer) const
+  {
+    buffer.push_back(_strings.size());
+    for (const std::string *string : _strings) {
+      buffer.push_back(string->size());
+      size_t const start = buffer.size();
+      buffer.resize(start + (string->size() + sizeof(int) - 1) / sizeof(int), 0);
+      std::memcpy(buffer.data() + start, string->data(), string->size());
+    }
+  }
+
+private:
+  std::unordered_map<std::string, int> _indices;
+
+  std::vector<const std::string *> _strings;
+};
+
+int readInt(const std::vector<int> &buffer, size_t &position)
+{
+  assertion(position < buffer.size(), position, buffer.size());
+  return buffer[position++];
+}
+
+std::string readString(const std::vector<int> &buffer, size_t &position)
+{
+  size_t const length = readInt(buffer, position);
+  size_t const ints   = (length + sizeof(int) - 1) / sizeof(int);
+  assertion(position + ints <= buffer.size(), position, ints, buffer.size());
+  std::string string(reinterpret_cast<const char *>(buffer.data() + position), length);
+  position += ints;
+  return string;
+}
+
+void writeTag(const ConfigParser::CTag &tag, StringTable &strings, std::vector<int> &tags)
+{
+  tags.push_back(strings.index(tag.m_Prefix));
+  tags.push_back(strings.index(tag.m_Name));
+  tags.push_back(tag.m_aAttributes.size());
+  for (const auto &attribute : tag.m_aAttributes) {
+    tags.push_back(strings.index(attribute.first));
+    tags.push_back(strings.index(attribute.second));
+  }
+  tags.push_back(tag.m_aSubTags.size());
+  for (const auto &subtag : tag.m_aSubTags) {
+    writeTag(*subtag, strings, tags);
+  }
+}
+
+} // namespace
+
 // ------------------------- ConfigParser implementation  -------------------------
 
 precice::logging::Logger ConfigParser::_log("xml::XMLParser");
@@ -63,9 +138,75 @@ ConfigParser::ConfigParser(const std::string &filePath, std::shared_ptr<precice:
 {
   m_pXmlTag = pXmlTag;
   readXmlFile(filePath);
+  connectRootTag();
+}
 
-  std::vector<std::shared_ptr<XMLTag>> DefTags;
-  DefTags.push_back(m_pXmlTag);
+ConfigParser::ConfigParser(const std::string &filePath)
+{
+  readXmlFile(filePath);
+}
+
+ConfigParser::ConfigParser(const std::vector<int> &serializedTags, std::shared_ptr<XMLTag> pXmlTag)
+{
+  m_pXmlTag = pXmlTag;
+
+  size_t position = 0;
+  CHECK(readInt(serializedTags, position) == SERIALIZATION_VERSION,
+        "The serialized configuration was written by a different version of preCICE");
+  int const stringCount = readInt(serializedTags, position);
+  std::vector<std::string> strings;
+  strings.reserve(stringCount);
+  for (int i = 0; i < stringCount; i++) {
+    strings.push_back(readString(serializedTags, position));
+  }
+  if (readInt(serializedTags, position) > 0) {
+    readSerializedTag(serializedTags, position, strings);
+  }
+  assertion(position == serializedTags.size(), position, serializedTags.size());
+
+  connectRootTag();
+}
+
+std::vector<int> ConfigParser::serialize() const
+{
+  StringTable      strings;
+  std::vector<int> tags;
+  tags.push_back(m_AllTags.empty() ? 0 : 1);
+  if (not m_AllTags.empty()) {
+    writeTag(*m_AllTags[0], strings, tags);
+  }
+
+  std::vector<int> buffer;
+  buffer.push_back(SERIALIZATION_VERSION);
+  strings.write(buffer);
+  buffer.insert(buffer.end(), tags.begin(), tags.end());
+  return buffer;
+}
+
+void ConfigParser::readSerializedTag(const std::vector<int> &buffer, size_t &position, const std::vector<std::string> &strings)
+{
+  std::string const &prefix = strings.at(readInt(buffer, position));
+  std::string const &name   = strings.at(readInt(buffer, position));
+
+  CTag::AttributePair attributes;
+  int const           attributeCount = readInt(buffer, position);
+  for (int i = 0; i < attributeCount; i++) {
+    std::string const &attributeName = strings.at(readInt(buffer, position));
+    attributes[attributeName]        = strings.at(readInt(buffer, position));
+  }
+  OnStartElement(name, prefix, std::move(attributes));
+
+  int const subtagCount = readInt(buffer, position);
+  for (int i = 0; i < subtagCount; i++) {
+    readSerializedTag(buffer, position, strings);
+  }
+  OnEndElement();
+}
+
+void ConfigParser::connectRootTag()
+{
+  DefTagMap DefTags;
+  DefTags.emplace(m_pXmlTag->_fullName, m_pXmlTag);
 
   CTagPtrVec SubTags;
   // Initialize with the root tag, if any.
@@ -79,11 +220,6 @@ ConfigParser::ConfigParser(const std::string &filePath, std::shared_ptr<precice:
   }
 }
 
-ConfigParser::ConfigParser(const std::string &filePath)
-{
-  readXmlFile(filePath);
-}
-
 void ConfigParser::GenericErrorFunc(void *ctx, const char *msg, ...)
 {
   const int TMP_BUF_SIZE = 256;
@@ -128,45 +264,36 @@ int ConfigParser::readXmlFile(std::string const &filePath)
   return 0;
 }
 
-void ConfigParser::connectTags(std::vector<std::shared_ptr<XMLTag>> &DefTags, CTagPtrVec &SubTags)
+void ConfigParser::connectTags(const DefTagMap &DefTags, CTagPtrVec &SubTags)
 {
-  std::vector<std::string> usedTags;
+  std::unordered_set<std::string> usedTags;
 
   for (auto subtag : SubTags) {
 
-    bool found = false;
+    auto match = DefTags.find(subtag->m_FullName);
+    if (match == DefTags.end())
+      ERROR("Tag <" + subtag->m_FullName + "> is unknown");
 
-    for (auto pDefSubTag : DefTags) {
-      
-      if (pDefSubTag->_fullName == ((subtag->m_Prefix.length() ? subtag->m_Prefix + ":" : "") + subtag->m_Name)) {
-        found = true;
-        pDefSubTag->resetAttributes();
+    auto pDefSubTag = match->second;
+    pDefSubTag->resetAttributes();
 
-        if (pDefSubTag->_occurrence == XMLTag::OCCUR_ONCE) {
-          if (std::find(usedTags.begin(), usedTags.end(), pDefSubTag->_fullName) != usedTags.end()) {
-            ERROR("Tag <" + pDefSubTag->_fullName + "> is already used");
-          }
-          usedTags.push_back(pDefSubTag->_fullName);
-        }
-
-        pDefSubTag->_configuredNamespaces[pDefSubTag->_namespace] = true;
-        pDefSubTag->readAttributes(subtag->m_aAttributes);
-        pDefSubTag->_listener.xmlTagCallback(*pDefSubTag);
-        pDefSubTag->_configured = true;
+    if (pDefSubTag->_occurrence == XMLTag::OCCUR_ONCE) {
+      if (not usedTags.insert(pDefSubTag->_fullName).second) {
+        ERROR("Tag <" + pDefSubTag->_fullName + "> is already used");
+      }
+    }
 
-        connectTags(pDefSubTag->_subtags, subtag->m_aSubTags);
+    pDefSubTag->_configuredNamespaces[pDefSubTag->_namespace] = true;
+    pDefSubTag->readAttributes(subtag->m_aAttributes);
+    pDefSubTag->_listener.xmlTagCallback(*pDefSubTag);
+    pDefSubTag->_configured = true;
 
-        if (!pDefSubTag->_subtags.empty()) {
-          pDefSubTag->areAllSubtagsConfigured();
-          pDefSubTag->_listener.xmlEndTagCallback(*pDefSubTag);
-        }
+    connectTags(pDefSubTag->_subtagsByName, subtag->m_aSubTags);
 
-        break;
-      }
+    if (!pDefSubTag->_subtags.empty()) {
+      pDefSubTag->areAllSubtagsConfigured();
+      pDefSubTag->_listener.xmlEndTagCallback(*pDefSubTag);
     }
-
-    if (!found)
-      ERROR("Tag <" + ((subtag->m_Prefix.length() ? subtag->m_Prefix + ":" : "") + subtag->m_Name) + "> is unknown");
   }
 }
 
@@ -179,6 +306,7 @@ void ConfigParser::OnStartElement(
 
   pTag->m_Prefix      = std::move(prefix);
   pTag->m_Name        = std::move(localname);
+  pTag->m_FullName    = pTag->m_Prefix.empty() ? pTag->m_Name : pTag->m_Prefix + ":" + pTag->m_Name;
   pTag->m_aAttributes = std::move(attributes);
 
   if (not m_CurrentTags.empty()) {
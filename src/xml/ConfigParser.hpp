@@ -1,7 +1,9 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "logging/Logger.hpp"
 #include "xml/XMLTag.hpp"
@@ -19,6 +21,8 @@ public:
   struct CTag {
     std::string m_Name;
     std::string m_Prefix;
+    /// Prefix and name as matched against XMLTag::getFullName()
+    std::string m_FullName;
     bool        m_Used = false;
 
     using AttributePair = std::map<std::string, std::string>;
@@ -27,7 +31,10 @@ public:
   };
 
   using CTagPtrVec = std::vector<std::shared_ptr<CTag>>;
-  
+
+  /// Predefined tags by their full name
+  using DefTagMap = std::unordered_map<std::string, std::shared_ptr<XMLTag>>;
+
 private:
   static precice::logging::Logger _log;
 
@@ -38,6 +45,12 @@ private:
 
   static void GenericErrorFunc(void *ctx, const char *msg, ...);
 
+  /// Connects the read root tag, if any, with m_pXmlTag.
+  void connectRootTag();
+
+  /// Reads a tag and its subtags written by serialize() and passes them to the callbacks.
+  void readSerializedTag(const std::vector<int> &buffer, size_t &position, const std::vector<std::string> &strings);
+
 public:
   /// Parser ctor for Callback init
   ConfigParser(const std::string &filePath, std::shared_ptr<XMLTag> pXmlTag);
@@ -45,6 +58,20 @@ public:
   /// Parser ctor without Callbacks
   ConfigParser(const std::string &filePath);
 
+  /**
+   * @brief Parser ctor for Callback init, which reads the tags from a buffer instead of a file.
+   *
+   * @param[in] serializedTags Tags as returned by serialize() of another parser.
+   */
+  ConfigParser(const std::vector<int> &serializedTags, std::shared_ptr<XMLTag> pXmlTag);
+
+  /**
+   * @brief Returns the read tags in a compact binary form.
+   *
+   * Names and attribute values occurring several times are stored only once.
+   */
+  std::vector<int> serialize() const;
+
   /// Reads the xml file
   int readXmlFile(std::string const &filePath);
 
@@ -53,7 +80,7 @@ public:
    * @param DefTags predefined tags
    * @param SubTags actual tags from xml file
    */
-  void connectTags(std::vector<std::shared_ptr<precice::xml::XMLTag>> &DefTags, CTagPtrVec &SubTags);
+  void connectTags(const DefTagMap &DefTags, CTagPtrVec &SubTags);
 
   /// Callback for Start-Tag
   void OnStartElement(
@@ -42,7 +42,9 @@ void XMLTag::addSubtag(const XMLTag &tag)
     _configuredNamespaces[tag._namespace] = false;
   }
 
-  _subtags.push_back(std::make_shared<XMLTag>(tag));
+  auto subtag = std::make_shared<XMLTag>(tag);
+  _subtags.push_back(subtag);
+  _subtagsByName.emplace(subtag->_fullName, subtag);
 }
 
 void XMLTag::addAttribute(const XMLAttribute<double> &attribute)
@@ -331,6 +333,7 @@ void XMLTag::clear()
   _stringAttributes.clear();
   _booleanAttributes.clear();
   _subtags.clear();
+  _subtagsByName.clear();
 }
 
 std::string XMLTag::printDTD(const bool start) const
@@ -532,6 +535,27 @@ void configure(
   root.addSubtag(tag);
 }
 
+std::vector<int> configureAndSerialize(
+    XMLTag &           tag,
+    const std::string &configurationFilename)
+{
+  logging::Logger _log("xml");
+  TRACE(tag.getFullName(), configurationFilename);
+
+  precice::xml::ConfigParser p(configurationFilename, std::make_shared<XMLTag>(tag));
+  return p.serialize();
+}
+
+void configureSerialized(
+    XMLTag &                tag,
+    const std::vector<int> &serializedTags)
+{
+  logging::Logger _log("xml");
+  TRACE(tag.getFullName(), serializedTags.size());
+
+  precice::xml::ConfigParser p(serializedTags, std::make_shared<XMLTag>(tag));
+}
+
 std::string XMLTag::getOccurrenceString(Occurrence occurrence) const
 {
   if (occurrence == OCCUR_ARBITRARY) {
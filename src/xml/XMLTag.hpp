@@ -3,6 +3,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "XMLAttribute.hpp"
 #include "logging/Logger.hpp"
@@ -198,6 +199,9 @@ private:
 
   std::vector<std::shared_ptr<XMLTag>> _subtags;
 
+  /// Subtags by their full name, to match read tags without comparing against all subtags
+  std::unordered_map<std::string, std::shared_ptr<XMLTag>> _subtagsByName;
+
   std::map<std::string, bool> _configuredNamespaces;
 
   std::set<std::string> _attributes;
@@ -246,6 +250,21 @@ void configure(
     XMLTag &           tag,
     const std::string &configurationFilename);
 
+/**
+ * @brief Configures the given configuration from file configurationFilename and returns the read tags.
+ *
+ * The result is in the compact binary form of ConfigParser::serialize(). Other processes pass it to
+ * configureSerialized(), which neither reads nor parses the file.
+ */
+std::vector<int> configureAndSerialize(
+    XMLTag &           tag,
+    const std::string &configurationFilename);
+
+/// Configures the given configuration from tags returned by configureAndSerialize().
+void configureSerialized(
+    XMLTag &                tag,
+    const std::vector<int> &serializedTags);
+
 }} // namespace precice, xml
 
 /**
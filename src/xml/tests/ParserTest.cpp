@@ -1,4 +1,6 @@
+#include <memory>
 #include <string>
+#include <vector>
 #include "testing/Testing.hpp"
 #include "xml/ConfigParser.hpp"
 #include "xml/ValidatorEquals.hpp"
@@ -143,4 +145,77 @@ BOOST_AUTO_TEST_CASE(NamespaceTest)
   configure(rootTag, filename);
 }
 
+/// Records the callbacks of all tags with their attributes
+struct CallbackRecorder : public XMLTag::Listener {
+  std::vector<std::string> callbacks;
+
+  void xmlTagCallback(XMLTag &callingTag)
+  {
+    std::string callback = "start " + callingTag.getFullName();
+    if (callingTag.hasAttribute("name")) {
+      callback += " name=" + callingTag.getStringAttributeValue("name");
+    }
+    if (callingTag.hasAttribute("attribute")) {
+      callback += " attribute=" + std::to_string(callingTag.getDoubleAttributeValue("attribute"));
+    }
+    callbacks.push_back(callback);
+  }
+
+  void xmlEndTagCallback(XMLTag &callingTag)
+  {
+    callbacks.push_back("end " + callingTag.getFullName());
+  }
+};
+
+BOOST_AUTO_TEST_CASE(SerializationTest)
+{
+  std::string filename(getPathToSources() + "/xml/tests/xmlparser_serialization.xml");
+
+  CallbackRecorder cb;
+  XMLTag           rootTag(cb, "configuration", XMLTag::OCCUR_ONCE);
+  XMLTag           testcaseTag(cb, "test-config", XMLTag::OCCUR_ONCE);
+
+  XMLTag intTag(cb, "test-no_ns", XMLTag::OCCUR_ONCE_OR_MORE);
+  XMLTag stringTag(cb, "test-ns", XMLTag::OCCUR_ONCE_OR_MORE, "ns");
+  XMLTag doubleTag(cb, "test-double", XMLTag::OCCUR_ARBITRARY);
+  XMLTag outerTag(cb, "test-outer", XMLTag::OCCUR_NOT_OR_ONCE);
+  XMLTag innerTag(cb, "test-inner", XMLTag::OCCUR_ONCE_OR_MORE);
+
+  XMLAttribute<double>      doubleAttr("attribute");
+  XMLAttribute<std::string> nameAttr("name");
+  doubleTag.addAttribute(doubleAttr);
+  outerTag.addAttribute(nameAttr);
+  innerTag.addAttribute(nameAttr);
+
+  testcaseTag.addNamespace("ns");
+
+  innerTag.addSubtag(doubleTag);
+  outerTag.addSubtag(innerTag);
+
+  testcaseTag.addSubtag(intTag);
+  testcaseTag.addSubtag(stringTag);
+  testcaseTag.addSubtag(doubleTag);
+  testcaseTag.addSubtag(outerTag);
+
+  rootTag.addSubtag(testcaseTag);
+
+  std::vector<int> serializedTags = configureAndSerialize(rootTag, filename);
+  std::vector<std::string> parsedCallbacks = cb.callbacks;
+  BOOST_TEST(parsedCallbacks.size() == 17);
+
+  // Every distinct prefix, name and value is stored once: "", configuration, test-config, test-no_ns,
+  // ns, test-ns, test-double, attribute, 1.5, 2.5, test-outer, name, outer, test-inner, inner, 3.5
+  BOOST_TEST_REQUIRE(serializedTags.size() > 2);
+  BOOST_TEST(serializedTags[1] == 16);
+
+  // Deserialization passes the same tags with the same attributes in the same order to the callbacks
+  cb.callbacks.clear();
+  configureSerialized(rootTag, serializedTags);
+  BOOST_TEST(cb.callbacks == parsedCallbacks, boost::test_tools::per_element());
+
+  // Serializing the deserialized tags reproduces the buffer
+  ConfigParser parser(serializedTags, std::make_shared<XMLTag>(rootTag));
+  BOOST_TEST(parser.serialize() == serializedTags, boost::test_tools::per_element());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
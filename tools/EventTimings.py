@@ -8,12 +8,21 @@ import pandas
 import numpy as np
 
 
-def getDataFrame(file):
-    df = pandas.read_csv(file, index_col = [0, 1, 2], comment = "#", parse_dates = [0])
+def getDataFrame(files):
+    """ Reads one file or a list of files, e.g. the per rank files written in streaming mode. """
+    if isinstance(files, str):
+        files = [files]
+    df = pandas.concat([pandas.read_csv(f, index_col = [0, 1, 2], comment = "#", parse_dates = [0]) for f in files])
     return df.sort_index()
 
 def latestRun(df):
     return df.loc[df.index.max()[0]]
+
+def latestSnapshots(df):
+    """ Returns the most recent statistics of every rank, for files written in streaming mode. """
+    df = df.reset_index()
+    latest = df.groupby("Rank").Timestamp.transform(max)
+    return df[df.Timestamp == latest].set_index(["Timestamp", "RunName", "Rank"])
     
 
 if __name__ == "__main__":
@@ -0,0 +1,104 @@
+#include <m2n/PointToPointCommunication.hpp>
+#include <mesh/Mesh.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace precice;
+
+/// Number of ranks of both participants
+const int RANKS = 64;
+
+/// Distributes size global indices in contiguous blocks over RANKS ranks, shifted by offset
+mesh::Mesh::VertexDistribution createDistribution(int size, int offset)
+{
+  mesh::Mesh::VertexDistribution distribution;
+  for (int i = 0; i < size; i++) {
+    int const shifted = (i + offset) % size;
+    distribution[static_cast<long>(shifted) * RANKS / size].push_back(i);
+  }
+  return distribution;
+}
+
+/// The former implementation, which compares every local index to every remote index
+std::map<int, std::vector<int>> referenceCommunicationMap(
+    mesh::Mesh::VertexDistribution const &thisVertexDistribution,
+    mesh::Mesh::VertexDistribution const &otherVertexDistribution,
+    int                                    thisRank)
+{
+  std::map<int, std::vector<int>> communicationMap;
+  auto const &indices = thisVertexDistribution.at(thisRank);
+  int index = 0;
+  for (int thisIndex : indices) {
+    for (const auto &other : otherVertexDistribution) {
+      for (const auto &otherIndex : other.second) {
+        if (thisIndex == otherIndex) {
+          communicationMap[other.first].push_back(index);
+          break;
+        }
+      }
+    }
+    ++index;
+  }
+  return communicationMap;
+}
+
+template<typename FUNCTION_T>
+double timeRanks(FUNCTION_T function, int ranks)
+{
+  auto start = std::chrono::steady_clock::now();
+  for (int rank = 0; rank < ranks; rank++)
+    function(rank);
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(stop - start).count() / ranks;
+}
+
+int main(int argc, char* argv[])
+{
+  std::vector<int> sizes;
+  for (int i = 1; i < argc; i++)
+    sizes.push_back(std::atoi(argv[i]));
+  if (sizes.empty())
+    sizes = {100000, 1000000, 10000000};
+
+  // The reference is quadratic, it is only run on small meshes and for a single rank
+  int const maxReferenceSize = 200000;
+
+  std::cout << "Time per rank of buildCommunicationMap() and of buildCommunicationMaps() for all ranks,\n"
+            << "with " << RANKS << " ranks on both sides\n"
+            << std::setw(10) << "vertices" << std::setw(12) << "current" << std::setw(12) << "all ranks" << std::setw(12) << "reference"
+            << " [s]" << std::endl;
+
+  for (int size : sizes) {
+    mesh::Mesh::VertexDistribution thisDistribution = createDistribution(size, size / (2 * RANKS));
+    mesh::Mesh::VertexDistribution otherDistribution = createDistribution(size, 0);
+
+    std::cout << std::setw(10) << size << std::flush;
+    double const current = timeRanks([&](int rank) {
+        m2n::buildCommunicationMap(thisDistribution, otherDistribution, rank);
+      }, RANKS);
+    std::cout << std::setw(12) << current << std::flush;
+
+    double const master = timeRanks([&](int) {
+        m2n::buildCommunicationMaps(thisDistribution, otherDistribution);
+      }, 1);
+    std::cout << std::setw(12) << master << std::flush;
+
+    if (size <= maxReferenceSize) {
+      std::map<int, std::vector<int>> referenceMap;
+      double const reference = timeRanks([&](int rank) {
+          referenceMap = referenceCommunicationMap(thisDistribution, otherDistribution, rank);
+        }, 1);
+      bool const equal = referenceMap == m2n::buildCommunicationMap(thisDistribution, otherDistribution, 0);
+      std::cout << std::setw(12) << reference << (equal ? "" : "  MISMATCH");
+    }
+    std::cout << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,95 @@
+#include <mapping/PetRadialBasisFctMapping.hpp>
+#include <mesh/Mesh.hpp>
+#include <mesh/Data.hpp>
+#include <mesh/RTree.hpp>
+#include <utils/Parallel.hpp>
+#include <utils/Petsc.hpp>
+#include <logging/LogConfiguration.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace precice;
+
+/// Creates a wavy surface in 3D with (about) size vertices on a regular grid
+mesh::PtrMesh createSurface(const std::string& name, int size, double shift)
+{
+  mesh::PtrMesh mesh(new mesh::Mesh(name, 3, false));
+  mesh->createData("Data", 1);
+  int const pointsPerAxis = std::ceil(std::sqrt(size));
+  double const h = 1.0 / pointsPerAxis;
+  for (int i = 0; i < pointsPerAxis; i++) {
+    for (int j = 0; j < pointsPerAxis; j++) {
+      double const x = (i + shift) * h;
+      double const y = (j + shift) * h;
+      mesh->createVertex(Eigen::Vector3d(x, y, 0.1 * std::sin(6.0 * x) * std::cos(6.0 * y)));
+    }
+  }
+  for (mesh::Vertex& v : mesh->vertices())
+    v.setGlobalIndex(v.getID());
+  mesh->allocateDataValues();
+  return mesh;
+}
+
+/// Returns the time of computeMapping() in seconds
+double timeComputeMapping(int size, mapping::Preallocation preallocation)
+{
+  mesh::PtrMesh inMesh = createSurface("InMesh", size, 0.0);
+  mesh::PtrMesh outMesh = createSurface("OutMesh", size, 0.5);
+
+  // Three grid spacings, s.t. every row has some tens of entries
+  double const supportRadius = 3.0 / std::ceil(std::sqrt(size));
+  mapping::CompactPolynomialC6 fct(supportRadius);
+  mapping::PetRadialBasisFctMapping<mapping::CompactPolynomialC6> mapping(
+    mapping::Mapping::CONSISTENT, 3, fct, false, false, false, 1e-9,
+    mapping::Polynomial::SEPARATE, preallocation);
+  mapping.setMeshes(inMesh, outMesh);
+
+  auto start = std::chrono::steady_clock::now();
+  mapping.computeMapping();
+  auto stop = std::chrono::steady_clock::now();
+
+  mesh::rtree::clear(*inMesh);
+  mesh::rtree::clear(*outMesh);
+  return std::chrono::duration<double>(stop - start).count();
+}
+
+int main(int argc, char* argv[])
+{
+  logging::setupLogging();
+  utils::Parallel::initializeMPI(&argc, &argv);
+  utils::Petsc::initialize(&argc, &argv);
+
+  std::vector<int> sizes;
+  for (int i = 1; i < argc; i++)
+    sizes.push_back(std::atoi(argv[i]));
+  if (sizes.empty())
+    sizes = {100000, 300000, 1000000};
+
+  std::vector<std::pair<std::string, mapping::Preallocation>> const modes = {
+    {"save", mapping::Preallocation::SAVE},
+    {"compute", mapping::Preallocation::COMPUTE},
+    {"tree", mapping::Preallocation::TREE}};
+
+  std::cout << std::setw(10) << "vertices";
+  for (auto const & mode : modes)
+    std::cout << std::setw(12) << mode.first;
+  std::cout << " [s]" << std::endl;
+
+  for (int size : sizes) {
+    std::cout << std::setw(10) << size << std::flush;
+    for (auto const & mode : modes)
+      std::cout << std::setw(12) << timeComputeMapping(size, mode.second) << std::flush;
+    std::cout << std::endl;
+  }
+
+  utils::Petsc::finalize();
+  utils::Parallel::finalizeMPI();
+  return 0;
+}
@@ -11,7 +11,8 @@ colormap = matplotlib.cm.get_cmap()
 parser = argparse.ArgumentParser(formatter_class=argparse.ArgumentDefaultsHelpFormatter,
                                  description = "Visualize Event logs")
 parser.add_argument('groupby', choices = ['name', 'rank'], help = "Group by event or rank")
-parser.add_argument('--file', help = "File name of log", type = str, default = "Events.log")
+parser.add_argument('--file', help = "File name of log, multiple files (e.g. per rank logs in streaming mode) are merged",
+                    type = str, nargs = '+', default = ["Events.log"])
 parser.add_argument('--filter', help = "Filter expression used on pandas.query", type = str)
 parser.add_argument('--runindex', help = "Index of run, -1 is latest", type = int, default = -1)
 
@@ -21,8 +22,8 @@ if len(sys.argv) < 2:
 
 args = parser.parse_args()
 
-df = pd.read_csv(args.file, index_col = 0, parse_dates = [0])
-df.sort_index()
+df = pd.concat([pd.read_csv(f, index_col = 0, parse_dates = [0]) for f in args.file])
+df = df.sort_index()
 
 # Get one dataset (last by default)
 df = df.loc[df.index.unique()[args.runindex]]